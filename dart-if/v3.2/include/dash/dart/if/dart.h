@@ -124,6 +124,11 @@ extern "C" {
 */
 #include "dart_synchronization.h"
 
+/*
+   --- DART active messages ---
+*/
+#include "dart_active_messages.h"
+
 
 #ifdef __cplusplus
 } // extern "C"
@@ -0,0 +1,146 @@
+#ifndef DART__ACTIVE_MESSAGES_H_
+#define DART__ACTIVE_MESSAGES_H_
+
+#include <dash/dart/if/dart_types.h>
+
+/**
+ * \file dart_active_messages.h
+ *
+ * Active messages: invocation of registered handler functions at remote
+ * units.
+ *
+ * A message consists of a handler id and a payload of raw bytes. Messages
+ * to the same target unit are aggregated and delivered in batches, the
+ * handler is invoked with the payload at the target unit when the target
+ * polls for incoming messages in \c dart_am_progress or
+ * \c dart_am_fence. Messages from one unit to a target unit are processed
+ * in the order they have been sent.
+ *
+ * Handlers are identified by their position in the sequence of calls of
+ * \c dart_am_register, so all units have to register the same handlers in
+ * the same order.
+ *
+ * Implementations without support for active messages return
+ * \c DART_ERR_NOTSUPPORTED from \c dart_am_register and
+ * \c dart_am_send. As no message can be in transit, \c dart_am_flush,
+ * \c dart_am_flush_all, \c dart_am_progress and \c dart_am_fence
+ * succeed without effect.
+ */
+
+/**
+ * \defgroup  DartActiveMessages  Active messages in DART
+ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DART_INTERFACE_ON
+
+/**
+ * Maximum number of registered handlers.
+ *
+ * \ingroup DartActiveMessages
+ */
+#define DART_AM_MAX_HANDLERS 64
+
+/**
+ * Identifier of a registered handler.
+ *
+ * \ingroup DartActiveMessages
+ */
+typedef int32_t dart_am_handler_id_t;
+
+/**
+ * Handler function invoked at the target unit of an active message.
+ *
+ * The payload is only valid during the invocation of the handler and
+ * aligned to 8 bytes. Handlers may send active messages but must not
+ * call \c dart_am_progress or \c dart_am_fence.
+ *
+ * \ingroup DartActiveMessages
+ */
+typedef void (*dart_am_handler_t)(
+  /// Unit that sent the message
+  dart_unit_t   source,
+  /// Payload of the message
+  const void  * payload,
+  /// Size of the payload in bytes
+  size_t        nbytes,
+  /// User data specified in the handler's registration
+  void        * userdata);
+
+/**
+ * Register a handler function for active messages.
+ * Not a collective operation, but all units must register the same
+ * handlers in the same order.
+ *
+ * \ingroup DartActiveMessages
+ */
+dart_ret_t dart_am_register(
+  dart_am_handler_t      handler,
+  /// User data passed to every invocation of the handler
+  void                 * userdata,
+  /// [OUT] Identifier of the registered handler
+  dart_am_handler_id_t * handler_id);
+
+/**
+ * Send an active message to a unit.
+ * The message is appended to the send buffer of the target unit and sent
+ * once the buffer is full or in the next call of \c dart_am_flush,
+ * \c dart_am_flush_all or \c dart_am_fence.
+ * The payload is copied and may be modified after the call returned.
+ *
+ * \ingroup DartActiveMessages
+ */
+dart_ret_t dart_am_send(
+  /// Target unit, relative to \c DART_TEAM_ALL
+  dart_unit_t            unit,
+  dart_am_handler_id_t   handler_id,
+  const void           * payload,
+  size_t                 nbytes);
+
+/**
+ * Send all buffered active messages to the given unit.
+ *
+ * \ingroup DartActiveMessages
+ */
+dart_ret_t dart_am_flush(
+  dart_unit_t unit);
+
+/**
+ * Send all buffered active messages to all units.
+ *
+ * \ingroup DartActiveMessages
+ */
+dart_ret_t dart_am_flush_all();
+
+/**
+ * Process incoming active messages without blocking: invokes the handlers
+ * of all messages that have arrived at the calling unit and completes
+ * sends of buffered messages.
+ * Messages sent by the invoked handlers, e.g. replies, are sent before
+ * the call returns.
+ *
+ * \ingroup DartActiveMessages
+ */
+dart_ret_t dart_am_progress(
+  /// [OUT] Number of processed messages, may be \c NULL
+  size_t * num_processed);
+
+/**
+ * Collective operation on \c DART_TEAM_ALL, blocks until all active
+ * messages that have been sent by any unit before entering the call,
+ * including messages sent by handlers in the meantime, have been
+ * processed at their targets.
+ *
+ * \ingroup DartActiveMessages
+ */
+dart_ret_t dart_am_fence();
+
+#define DART_INTERFACE_OFF
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DART__ACTIVE_MESSAGES_H_ */
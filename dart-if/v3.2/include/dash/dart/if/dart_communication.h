@@ -80,6 +80,73 @@ dart_ret_t dart_reduce_double(
   double *recvbuf,
   dart_team_t team);
 
+/**
+ * DART Equivalent to MPI allreduce.
+ *
+ * \ingroup DartCommuncation
+ */
+dart_ret_t dart_allreduce(
+  void             * sendbuf,
+  void             * recvbuf,
+  size_t             nelem,
+  dart_datatype_t    dtype,
+  dart_operation_t   op,
+  dart_team_t        team);
+
+/**
+ * Reduction function of \c dart_allreduce_custom and
+ * \c dart_exscan_custom, combines every element in \c invec with the
+ * element at the same position in \c inoutvec and stores the result in
+ * \c inoutvec, i.e. <tt>inoutvec[i] = invec[i] (+) inoutvec[i]</tt>.
+ * The function must be associative, and commutative in
+ * \c dart_allreduce_custom.
+ *
+ * \ingroup DartCommuncation
+ */
+typedef void (*dart_reduce_func_t)(
+  const void * invec,
+  void       * inoutvec,
+  size_t       nelem,
+  void       * userdata);
+
+/**
+ * DART Equivalent to MPI allreduce with a user-defined operation on
+ * elements of \c elem_size bytes, e.g. value-location pairs.
+ * Elements are transferred bytewise.
+ * The reduction function is called with the given user data.
+ * Calls do not share state and may be issued by multiple threads on
+ * different teams concurrently.
+ *
+ * \ingroup DartCommuncation
+ */
+dart_ret_t dart_allreduce_custom(
+  const void         * sendbuf,
+  void               * recvbuf,
+  size_t               nelem,
+  size_t               elem_size,
+  dart_reduce_func_t   func,
+  void               * userdata,
+  dart_team_t          team);
+
+/**
+ * DART Equivalent to MPI exscan with a user-defined operation on
+ * elements of \c elem_size bytes.
+ * Every unit receives the reduction of the elements of all units with
+ * lower id in the team in the order of their ids, elements in \c invec
+ * of the reduction function precede elements in \c inoutvec.
+ * The receive buffer of unit 0 is undefined.
+ *
+ * \ingroup DartCommuncation
+ */
+dart_ret_t dart_exscan_custom(
+  const void         * sendbuf,
+  void               * recvbuf,
+  size_t               nelem,
+  size_t               elem_size,
+  dart_reduce_func_t   func,
+  void               * userdata,
+  dart_team_t          team);
+
 typedef struct dart_handle_struct * dart_handle_t;
 
 /**
@@ -120,6 +187,42 @@ dart_ret_t dart_accumulate(
   dart_operation_t op,
   dart_team_t      team);
 
+/**
+ * Atomically applies the reduce operation \c op to the single element
+ * referenced by \c gptr and the given value, and returns the element's
+ * previous value in \c result. Equivalent to \c MPI_Fetch_and_op.
+ * Use \c DART_OP_NO_OP to read the element atomically.
+ *
+ * Blocking, the result is available when the function returns.
+ *
+ * \ingroup DartCommuncation
+ */
+dart_ret_t dart_fetch_and_op(
+  dart_gptr_t      gptr,
+  const void     * value,
+  void           * result,
+  dart_datatype_t  dtype,
+  dart_operation_t op,
+  dart_team_t      team);
+
+/**
+ * Atomically replaces the single element referenced by \c gptr with
+ * \c value if it is equal to \c compare, and returns the element's
+ * previous value in \c result. Equivalent to \c MPI_Compare_and_swap.
+ * The element has been replaced if \c result is equal to \c compare.
+ *
+ * Blocking, the result is available when the function returns.
+ *
+ * \ingroup DartCommuncation
+ */
+dart_ret_t dart_compare_and_swap(
+  dart_gptr_t      gptr,
+  const void     * value,
+  const void     * compare,
+  void           * result,
+  dart_datatype_t  dtype,
+  dart_team_t      team);
+
 /**
  * 'HANDLE' variant of dart_get.
  * Neither local nor remote completion is guaranteed. A later
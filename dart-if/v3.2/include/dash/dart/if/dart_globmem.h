@@ -86,6 +86,17 @@ typedef struct
     gptr2_.addr_or_offs.offset) )
 
 
+/* Inline variants of dart_gptr_setunit and dart_gptr_incaddr for use
+   in performance-critical address arithmetic. Both operate on the
+   global pointer in place and never fail.
+*/
+#define DART_GPTR_SETUNIT(gptr_, unit_)		\
+  ((gptr_).unitid = (unit_))
+
+#define DART_GPTR_INCADDR(gptr_, offs_)		\
+  ((gptr_).addr_or_offs.offset += (offs_))
+
+
 /* get the local memory address for the specified global pointer
    gptr. I.e., if the global pointer has affinity to the local unit,
    return the local memory address.
@@ -104,6 +115,10 @@ dart_ret_t dart_gptr_incaddr(dart_gptr_t *gptr, int32_t offs);
 /* set the unit information for the specified global pointer */
 dart_ret_t dart_gptr_setunit(dart_gptr_t *gptr, dart_unit_t);
 
+/* get the team that allocated the memory referenced by the specified
+   global pointer, DART_TEAM_ALL for non-collective allocations */
+dart_ret_t dart_gptr_getteam(const dart_gptr_t gptr, dart_team_t *teamid);
+
 
 /*
  Allocates nbytes of memory in the global address space of the calling
@@ -22,6 +22,7 @@ typedef enum
     DART_ERR_INVAL    = 2,
     DART_ERR_NOTFOUND = 3,
     DART_ERR_NOTINIT  = 4,
+    DART_ERR_NOTSUPPORTED = 5,
     DART_ERR_OTHER    = 999,
     /* add error codes as needed */
   } dart_ret_t;
@@ -38,7 +39,9 @@ typedef enum
     DART_OP_BOR,
     DART_OP_LOR,
     DART_OP_BXOR,
-    DART_OP_LXOR
+    DART_OP_LXOR,
+    /** Only valid in atomic fetch operations, reads the target value */
+    DART_OP_NO_OP
   } dart_operation_t;
 
 typedef enum
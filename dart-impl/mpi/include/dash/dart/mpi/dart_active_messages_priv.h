@@ -0,0 +1,30 @@
+/** @file dart_active_messages_priv.h
+ *  @brief Initialization and finalization of active message queues.
+ */
+#ifndef DART_ADAPT_ACTIVE_MESSAGES_PRIV_H_INCLUDED
+#define DART_ADAPT_ACTIVE_MESSAGES_PRIV_H_INCLUDED
+
+#include <dash/dart/if/dart_types.h>
+
+/**
+ * Size of the send buffer of active messages to a single target unit in
+ * bytes. Messages exceeding the buffer size are sent separately.
+ */
+#ifndef DART_AM_BUFFER_SIZE
+#define DART_AM_BUFFER_SIZE (64 * 1024)
+#endif
+
+/** @brief Create the communicator and send buffers of active messages.
+ *
+ *  Called in dart_init, after MPI has been initialized.
+ */
+dart_ret_t dart_adapt_amsg_init();
+
+/** @brief Release resources of active messages and reset registered
+ *  handlers.
+ *
+ *  Called in dart_exit, before MPI is finalized.
+ */
+dart_ret_t dart_adapt_amsg_destroy();
+
+#endif /* DART_ADAPT_ACTIVE_MESSAGES_PRIV_H_INCLUDED */
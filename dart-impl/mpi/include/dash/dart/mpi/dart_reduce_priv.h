@@ -0,0 +1,23 @@
+/** @file dart_reduce_priv.h
+ *  @brief Initialization and finalization of user-defined reductions.
+ */
+#ifndef DART_ADAPT_REDUCE_PRIV_H_INCLUDED
+#define DART_ADAPT_REDUCE_PRIV_H_INCLUDED
+
+#include <dash/dart/if/dart_types.h>
+
+/** @brief Create the datatype attribute key that passes the reduction
+ *  function and user data of dart_allreduce_custom and dart_exscan_custom
+ *  to the MPI operation.
+ *
+ *  Called in dart_init, after MPI has been initialized.
+ */
+dart_ret_t dart_adapt_reduce_init();
+
+/** @brief Free the datatype attribute key of user-defined reductions.
+ *
+ *  Called in dart_exit, before MPI is finalized.
+ */
+dart_ret_t dart_adapt_reduce_destroy();
+
+#endif /* DART_ADAPT_REDUCE_PRIV_H_INCLUDED */
@@ -226,5 +226,9 @@ int dart_adapt_teamlist_recycle(uint16_t index, int pos);
  */
 int dart_adapt_teamlist_convert (dart_team_t teamid, uint16_t* index);
 
+/* @brief Locate the teamid related to the given index in the alloated-team-list-array.
+ */
+int dart_adapt_teamlist_teamid (uint16_t index, dart_team_t* teamid);
+
 #endif /*DART_ADAPT_TEAMNODE_H_INCLUDED*/
 
@@ -0,0 +1,424 @@
+/**
+ *  \file  dart_active_messages.c
+ *
+ *  Active messages based on MPI two-sided communication.
+ *
+ *  Messages are appended to a send buffer per target unit. Full buffers
+ *  and buffers flushed explicitly are sent as a single batch in a
+ *  non-blocking send on a communicator dedicated to active messages.
+ *  Incoming batches are received and their handlers are invoked when the
+ *  target unit polls in dart_am_progress.
+ *
+ *  Layout of a batch, every payload is padded to a multiple of 8 bytes:
+ *
+ *    [ header | payload | header | payload | ... ]
+ */
+
+#include <dash/dart/base/logging.h>
+
+#include <dash/dart/if/dart_types.h>
+#include <dash/dart/if/dart_active_messages.h>
+
+#include <dash/dart/mpi/dart_active_messages_priv.h>
+#include <dash/dart/mpi/dart_mpi_util.h>
+
+#include <mpi.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define DART_AM_TAG 1
+
+#define DART_AM_ALIGN(nbytes) (((nbytes) + 7) & ~((size_t)7))
+
+/* Header of a message in a batch */
+typedef struct
+{
+  dart_am_handler_id_t handler_id;
+  uint32_t             nbytes;
+} dart_am_header_t;
+
+/* Buffered messages to a single target unit */
+typedef struct
+{
+  char   * data;
+  size_t   size;
+  /* Whether messages have been sent by handlers in dart_am_progress */
+  int      from_handler;
+} dart_am_sendbuf_t;
+
+/* Batch in transit */
+typedef struct
+{
+  MPI_Request   request;
+  char        * data;
+} dart_am_pending_t;
+
+static dart_am_handler_t   _handlers[DART_AM_MAX_HANDLERS];
+static void              * _handler_userdata[DART_AM_MAX_HANDLERS];
+static int                 _num_handlers   = 0;
+
+static MPI_Comm            _am_comm        = MPI_COMM_NULL;
+static int                 _am_size        = 0;
+static dart_am_sendbuf_t * _sendbufs       = NULL;
+
+static dart_am_pending_t * _pending        = NULL;
+static size_t              _num_pending    = 0;
+static size_t              _pending_cap    = 0;
+
+static char              * _recvbuf        = NULL;
+static size_t              _recvbuf_size   = 0;
+
+/* Number of batches sent and received, used for termination detection */
+static long long           _num_sent       = 0;
+static long long           _num_recv       = 0;
+
+/* Whether handlers are currently being invoked */
+static int                 _in_progress    = 0;
+
+/* Target units of messages sent by handlers in dart_am_progress */
+static dart_unit_t       * _handler_targets     = NULL;
+static size_t              _num_handler_targets = 0;
+
+dart_ret_t dart_adapt_amsg_init()
+{
+  if (MPI_Comm_dup(MPI_COMM_WORLD, &_am_comm) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_adapt_amsg_init: MPI_Comm_dup failed");
+    return DART_ERR_OTHER;
+  }
+  MPI_Comm_size(_am_comm, &_am_size);
+  /* Buffers are allocated on first use: */
+  _sendbufs = (dart_am_sendbuf_t *)calloc(_am_size,
+                                          sizeof(dart_am_sendbuf_t));
+  _handler_targets     = (dart_unit_t *)malloc(_am_size *
+                                               sizeof(dart_unit_t));
+  _num_handler_targets = 0;
+  _num_sent = 0;
+  _num_recv = 0;
+  return DART_OK;
+}
+
+dart_ret_t dart_adapt_amsg_destroy()
+{
+  int u;
+  size_t p;
+  for (p = 0; p < _num_pending; p++) {
+    MPI_Request_free(&_pending[p].request);
+    free(_pending[p].data);
+  }
+  free(_pending);
+  _pending     = NULL;
+  _num_pending = 0;
+  _pending_cap = 0;
+  for (u = 0; u < _am_size; u++) {
+    free(_sendbufs[u].data);
+  }
+  free(_sendbufs);
+  _sendbufs = NULL;
+  free(_handler_targets);
+  _handler_targets     = NULL;
+  _num_handler_targets = 0;
+  free(_recvbuf);
+  _recvbuf      = NULL;
+  _recvbuf_size = 0;
+  if (_am_comm != MPI_COMM_NULL) {
+    MPI_Comm_free(&_am_comm);
+  }
+  _am_size      = 0;
+  _num_handlers = 0;
+  return DART_OK;
+}
+
+dart_ret_t dart_am_register(
+  dart_am_handler_t      handler,
+  void                 * userdata,
+  dart_am_handler_id_t * handler_id)
+{
+  if (handler == NULL) {
+    DART_LOG_ERROR("dart_am_register: handler is NULL");
+    return DART_ERR_INVAL;
+  }
+  if (_num_handlers >= DART_AM_MAX_HANDLERS) {
+    DART_LOG_ERROR("dart_am_register: maximum number of handlers (%d) "
+                   "exceeded", DART_AM_MAX_HANDLERS);
+    return DART_ERR_OTHER;
+  }
+  _handlers[_num_handlers]         = handler;
+  _handler_userdata[_num_handlers] = userdata;
+  *handler_id = _num_handlers++;
+  DART_LOG_DEBUG("dart_am_register: handler id:%d", *handler_id);
+  return DART_OK;
+}
+
+/* Sends the given batch to the target unit, takes ownership of data. */
+static dart_ret_t dart_am_send_batch(
+  dart_unit_t   unit,
+  char        * data,
+  size_t        nbytes)
+{
+  if (_num_pending == _pending_cap) {
+    size_t cap = (_pending_cap == 0) ? 16 : 2 * _pending_cap;
+    dart_am_pending_t * pending = (dart_am_pending_t *)realloc(
+                                    _pending,
+                                    cap * sizeof(dart_am_pending_t));
+    if (pending == NULL) {
+      DART_LOG_ERROR("dart_am_send_batch: out of memory");
+      return DART_ERR_OTHER;
+    }
+    _pending     = pending;
+    _pending_cap = cap;
+  }
+  DART_LOG_TRACE("dart_am_send_batch: unit:%d nbytes:%zu", unit, nbytes);
+  int ret = MPI_Isend(data, (int)nbytes, MPI_BYTE, unit, DART_AM_TAG,
+                      _am_comm, &_pending[_num_pending].request);
+  if (ret != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_am_send_batch: MPI_Isend failed, error %d (%s)",
+                   ret, DART__MPI__ERROR_STR(ret));
+    free(data);
+    return DART_ERR_OTHER;
+  }
+  _pending[_num_pending].data = data;
+  _num_pending++;
+  _num_sent++;
+  return DART_OK;
+}
+
+/* Releases buffers of batches that have been sent. */
+static dart_ret_t dart_am_test_pending()
+{
+  size_t p;
+  size_t num_remaining = 0;
+  for (p = 0; p < _num_pending; p++) {
+    int completed = 0;
+    if (MPI_Test(&_pending[p].request, &completed, MPI_STATUS_IGNORE)
+        != MPI_SUCCESS) {
+      DART_LOG_ERROR("dart_am_test_pending: MPI_Test failed");
+      return DART_ERR_OTHER;
+    }
+    if (completed) {
+      free(_pending[p].data);
+    } else {
+      _pending[num_remaining++] = _pending[p];
+    }
+  }
+  _num_pending = num_remaining;
+  return DART_OK;
+}
+
+dart_ret_t dart_am_send(
+  dart_unit_t            unit,
+  dart_am_handler_id_t   handler_id,
+  const void           * payload,
+  size_t                 nbytes)
+{
+  if (unit < 0 || unit >= _am_size) {
+    DART_LOG_ERROR("dart_am_send: invalid unit %d", unit);
+    return DART_ERR_INVAL;
+  }
+  if (handler_id < 0 || handler_id >= _num_handlers) {
+    DART_LOG_ERROR("dart_am_send: invalid handler id %d", handler_id);
+    return DART_ERR_INVAL;
+  }
+  size_t msg_size = sizeof(dart_am_header_t) + DART_AM_ALIGN(nbytes);
+  dart_am_sendbuf_t * sendbuf = &_sendbufs[unit];
+  char * msg;
+  if (sendbuf->size + msg_size > DART_AM_BUFFER_SIZE) {
+    dart_ret_t ret = dart_am_flush(unit);
+    if (ret != DART_OK) {
+      return ret;
+    }
+  }
+  if (msg_size > DART_AM_BUFFER_SIZE) {
+    /* Message exceeds buffer size, send it in a separate batch: */
+    msg = (char *)malloc(msg_size);
+  } else {
+    if (sendbuf->data == NULL) {
+      sendbuf->data = (char *)malloc(DART_AM_BUFFER_SIZE);
+      sendbuf->size = 0;
+    }
+    msg = sendbuf->data + sendbuf->size;
+  }
+  if (msg == NULL) {
+    DART_LOG_ERROR("dart_am_send: out of memory");
+    return DART_ERR_OTHER;
+  }
+  dart_am_header_t header;
+  header.handler_id = handler_id;
+  header.nbytes     = (uint32_t)nbytes;
+  memcpy(msg, &header, sizeof(dart_am_header_t));
+  if (nbytes > 0) {
+    memcpy(msg + sizeof(dart_am_header_t), payload, nbytes);
+  }
+  if (msg_size > DART_AM_BUFFER_SIZE) {
+    return dart_am_send_batch(unit, msg, msg_size);
+  }
+  sendbuf->size += msg_size;
+  if (_in_progress && !sendbuf->from_handler) {
+    /* Replies of handlers are sent when dart_am_progress returns: */
+    sendbuf->from_handler = 1;
+    _handler_targets[_num_handler_targets++] = unit;
+  }
+  return DART_OK;
+}
+
+dart_ret_t dart_am_flush(
+  dart_unit_t unit)
+{
+  if (unit < 0 || unit >= _am_size) {
+    DART_LOG_ERROR("dart_am_flush: invalid unit %d", unit);
+    return DART_ERR_INVAL;
+  }
+  dart_am_sendbuf_t * sendbuf = &_sendbufs[unit];
+  if (sendbuf->size == 0) {
+    return DART_OK;
+  }
+  char * data   = sendbuf->data;
+  size_t nbytes = sendbuf->size;
+  /* Buffer is released when the send has completed: */
+  sendbuf->data = NULL;
+  sendbuf->size = 0;
+  return dart_am_send_batch(unit, data, nbytes);
+}
+
+dart_ret_t dart_am_flush_all()
+{
+  dart_unit_t u;
+  for (u = 0; u < _am_size; u++) {
+    dart_ret_t ret = dart_am_flush(u);
+    if (ret != DART_OK) {
+      return ret;
+    }
+  }
+  return DART_OK;
+}
+
+/* Invokes the handlers of all messages in a received batch. */
+static void dart_am_process_batch(
+  dart_unit_t   source,
+  const char  * data,
+  size_t        nbytes,
+  size_t      * num_processed)
+{
+  size_t offset = 0;
+  while (offset + sizeof(dart_am_header_t) <= nbytes) {
+    dart_am_header_t header;
+    memcpy(&header, data + offset, sizeof(dart_am_header_t));
+    offset += sizeof(dart_am_header_t);
+    if (header.handler_id < 0 || header.handler_id >= _num_handlers) {
+      DART_LOG_ERROR("dart_am_process_batch: unknown handler id %d "
+                     "from unit %d", header.handler_id, source);
+    } else {
+      _handlers[header.handler_id](
+        source,
+        data + offset,
+        header.nbytes,
+        _handler_userdata[header.handler_id]);
+      (*num_processed)++;
+    }
+    offset += DART_AM_ALIGN(header.nbytes);
+  }
+}
+
+dart_ret_t dart_am_progress(
+  size_t * num_processed)
+{
+  size_t nprocessed = 0;
+  if (_in_progress) {
+    DART_LOG_ERROR("dart_am_progress: called from active message handler");
+    return DART_ERR_OTHER;
+  }
+  _in_progress = 1;
+  for (;;) {
+    int        arrived = 0;
+    int        nbytes;
+    MPI_Status status;
+    if (MPI_Iprobe(MPI_ANY_SOURCE, DART_AM_TAG, _am_comm, &arrived,
+                   &status) != MPI_SUCCESS) {
+      DART_LOG_ERROR("dart_am_progress: MPI_Iprobe failed");
+      _in_progress = 0;
+      return DART_ERR_OTHER;
+    }
+    if (!arrived) {
+      break;
+    }
+    MPI_Get_count(&status, MPI_BYTE, &nbytes);
+    if ((size_t)nbytes > _recvbuf_size) {
+      free(_recvbuf);
+      _recvbuf_size = ((size_t)nbytes > DART_AM_BUFFER_SIZE)
+                      ? (size_t)nbytes
+                      : DART_AM_BUFFER_SIZE;
+      _recvbuf      = (char *)malloc(_recvbuf_size);
+    }
+    if (MPI_Recv(_recvbuf, nbytes, MPI_BYTE, status.MPI_SOURCE,
+                 DART_AM_TAG, _am_comm, MPI_STATUS_IGNORE) != MPI_SUCCESS) {
+      DART_LOG_ERROR("dart_am_progress: MPI_Recv failed");
+      _in_progress = 0;
+      return DART_ERR_OTHER;
+    }
+    _num_recv++;
+    dart_am_process_batch(status.MPI_SOURCE, _recvbuf, nbytes, &nprocessed);
+  }
+  _in_progress = 0;
+  if (num_processed != NULL) {
+    *num_processed = nprocessed;
+  }
+  while (_num_handler_targets > 0) {
+    dart_unit_t unit = _handler_targets[--_num_handler_targets];
+    _sendbufs[unit].from_handler = 0;
+    dart_ret_t ret = dart_am_flush(unit);
+    if (ret != DART_OK) {
+      return ret;
+    }
+  }
+  return dart_am_test_pending();
+}
+
+dart_ret_t dart_am_fence()
+{
+  /*
+   * Termination detection: batches are flushed and the global numbers of
+   * sent and received batches are reduced while processing incoming
+   * messages. Once two consecutive reductions yield equal numbers of sent
+   * and received batches, no messages are in transit and no handler sent
+   * messages in between.
+   */
+  long long prev[2] = { -1, -1 };
+  for (;;) {
+    long long   local[2];
+    long long   global[2];
+    int         completed = 0;
+    MPI_Request request;
+    dart_ret_t  ret = dart_am_flush_all();
+    if (ret != DART_OK) {
+      return ret;
+    }
+    local[0] = _num_sent;
+    local[1] = _num_recv;
+    if (MPI_Iallreduce(local, global, 2, MPI_LONG_LONG, MPI_SUM, _am_comm,
+                       &request) != MPI_SUCCESS) {
+      DART_LOG_ERROR("dart_am_fence: MPI_Iallreduce failed");
+      return DART_ERR_OTHER;
+    }
+    while (!completed) {
+      ret = dart_am_progress(NULL);
+      if (ret != DART_OK) {
+        return ret;
+      }
+      MPI_Test(&request, &completed, MPI_STATUS_IGNORE);
+    }
+    if (global[0] == global[1] &&
+        global[0] == prev[0] && global[1] == prev[1]) {
+      break;
+    }
+    prev[0] = global[0];
+    prev[1] = global[1];
+  }
+  /* All batches have been received, complete their sends: */
+  while (_num_pending > 0) {
+    dart_ret_t ret = dart_am_test_pending();
+    if (ret != DART_OK) {
+      return ret;
+    }
+  }
+  return DART_OK;
+}
@@ -21,6 +21,7 @@
 #include <dash/dart/if/dart_team_group.h>
 #include <dash/dart/if/dart_communication.h>
 #include <dash/dart/mpi/dart_communication_priv.h>
+#include <dash/dart/mpi/dart_reduce_priv.h>
 #include <dash/dart/mpi/dart_translation.h>
 #include <dash/dart/mpi/dart_team_private.h>
 #include <dash/dart/mpi/dart_mem.h>
@@ -277,6 +278,132 @@ dart_ret_t dart_accumulate(
   return DART_OK;
 }
 
+dart_ret_t dart_fetch_and_op(
+  dart_gptr_t      gptr,
+  const void     * value,
+  void           * result,
+  dart_datatype_t  dtype,
+  dart_operation_t op,
+  dart_team_t      team)
+{
+  MPI_Aint     disp_s,
+               disp_rel;
+  MPI_Win      win;
+  MPI_Datatype mpi_dtype;
+  MPI_Op       mpi_op;
+  dart_unit_t  target_unitid_abs;
+  dart_unit_t  target_unitid_rel;
+  uint64_t offset   = gptr.addr_or_offs.offset;
+  int16_t  seg_id   = gptr.segid;
+  target_unitid_abs = gptr.unitid;
+  target_unitid_rel = target_unitid_abs;
+  mpi_dtype         = dart_mpi_datatype(dtype);
+  mpi_op            = dart_mpi_op(op);
+
+  (void)(team); // To prevent compiler warning from unused parameter.
+
+  DART_LOG_DEBUG("dart_fetch_and_op() dtype:%d op:%d unit:%d",
+                 dtype, op, target_unitid_abs);
+  if (seg_id) {
+    uint16_t index = gptr.flags;
+    win            = dart_win_lists[index];
+    unit_g2l(index,
+             target_unitid_abs,
+             &target_unitid_rel);
+    if (dart_adapt_transtable_get_disp(
+          seg_id,
+          target_unitid_rel,
+          &disp_s) == -1) {
+      DART_LOG_ERROR("dart_fetch_and_op ! "
+                     "dart_adapt_transtable_get_disp failed");
+      return DART_ERR_INVAL;
+    }
+    disp_rel = disp_s + offset;
+  } else {
+    win      = dart_win_local_alloc;
+    disp_rel = offset;
+  }
+  if (MPI_Fetch_and_op(
+        value,             // Origin address
+        result,            // Result address
+        mpi_dtype,         // Data type of origin, result and target
+        target_unitid_rel, // Rank of target
+        disp_rel,          // Displacement from start of window to target
+        mpi_op,            // Reduce operation
+        win) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_fetch_and_op ! MPI_Fetch_and_op failed");
+    return DART_ERR_INVAL;
+  }
+  if (MPI_Win_flush(target_unitid_rel, win) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_fetch_and_op ! MPI_Win_flush failed");
+    return DART_ERR_INVAL;
+  }
+  DART_LOG_DEBUG("dart_fetch_and_op > finished");
+  return DART_OK;
+}
+
+dart_ret_t dart_compare_and_swap(
+  dart_gptr_t      gptr,
+  const void     * value,
+  const void     * compare,
+  void           * result,
+  dart_datatype_t  dtype,
+  dart_team_t      team)
+{
+  MPI_Aint     disp_s,
+               disp_rel;
+  MPI_Win      win;
+  MPI_Datatype mpi_dtype;
+  dart_unit_t  target_unitid_abs;
+  dart_unit_t  target_unitid_rel;
+  uint64_t offset   = gptr.addr_or_offs.offset;
+  int16_t  seg_id   = gptr.segid;
+  target_unitid_abs = gptr.unitid;
+  target_unitid_rel = target_unitid_abs;
+  mpi_dtype         = dart_mpi_datatype(dtype);
+
+  (void)(team); // To prevent compiler warning from unused parameter.
+
+  DART_LOG_DEBUG("dart_compare_and_swap() dtype:%d unit:%d",
+                 dtype, target_unitid_abs);
+  if (seg_id) {
+    uint16_t index = gptr.flags;
+    win            = dart_win_lists[index];
+    unit_g2l(index,
+             target_unitid_abs,
+             &target_unitid_rel);
+    if (dart_adapt_transtable_get_disp(
+          seg_id,
+          target_unitid_rel,
+          &disp_s) == -1) {
+      DART_LOG_ERROR("dart_compare_and_swap ! "
+                     "dart_adapt_transtable_get_disp failed");
+      return DART_ERR_INVAL;
+    }
+    disp_rel = disp_s + offset;
+  } else {
+    win      = dart_win_local_alloc;
+    disp_rel = offset;
+  }
+  if (MPI_Compare_and_swap(
+        value,             // Origin address
+        compare,           // Compare address
+        result,            // Result address
+        mpi_dtype,         // Data type of origin, compare and result
+        target_unitid_rel, // Rank of target
+        disp_rel,          // Displacement from start of window to target
+        win) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_compare_and_swap ! MPI_Compare_and_swap failed");
+    return DART_ERR_INVAL;
+  }
+  if (MPI_Win_flush(target_unitid_rel, win) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_compare_and_swap ! MPI_Win_flush failed");
+    return DART_ERR_INVAL;
+  }
+  DART_LOG_DEBUG("dart_compare_and_swap > finished");
+  return DART_OK;
+}
+
 /* -- Non-blocking dart one-sided operations -- */
 
 dart_ret_t dart_get_handle(
@@ -309,7 +436,7 @@ dart_ret_t dart_get_handle(
 
   *handle = (dart_handle_t) malloc(sizeof(struct dart_handle_struct));
 
-  if (seg_id > 0) {
+  if (seg_id) {
     unit_g2l(index, target_unitid_abs, &target_unitid_rel);
   }
   DART_LOG_DEBUG("dart_get_handle() uid_abs:%d uid_rel:%d "
@@ -555,7 +682,7 @@ dart_ret_t dart_put_blocking(
     DART_LOG_ERROR("dart_put_blocking ! failed: nbytes > INT_MAX");
     return DART_ERR_INVAL;
   }
-  if (seg_id > 0) {
+  if (seg_id) {
     unit_g2l(index, target_unitid_abs, &target_unitid_rel);
   }
 
@@ -1153,29 +1280,29 @@ dart_ret_t dart_waitall(
     DART_LOG_DEBUG("dart_waitall: waiting for remote completion");
     for (i = 0; i < num_handles; i++) {
       if (handle[i]) {
+        /*
+         * Completed requests have been set to MPI_REQUEST_NULL by
+         * MPI_Waitall which only guarantees local completion.
+         * MPI_Win_flush to wait for remote completion:
+         */
+        DART_LOG_DEBUG("dart_waitall: -- MPI_Win_flush(handle[%d]: %p))",
+                       i, (void*)handle[i]);
+        DART_LOG_TRACE("dart_waitall:      handle[%d]->dest: %d",
+                       i, handle[i]->dest);
+        DART_LOG_TRACE("dart_waitall:      handle[%d]->win:  %"PRIu64"",
+                       i, (uint64_t)handle[i]->win);
+        if (MPI_Win_flush(handle[i]->dest, handle[i]->win) != MPI_SUCCESS) {
+          DART_LOG_ERROR("dart_waitall: MPI_Win_flush failed");
+          DART_LOG_TRACE("dart_waitall: free MPI_Request temporaries");
+          free(mpi_req);
+          DART_LOG_TRACE("dart_waitall: free MPI_Status temporaries");
+          free(mpi_sta);
+          return DART_ERR_INVAL;
+        }
         if (handle[i]->request == MPI_REQUEST_NULL) {
           DART_LOG_TRACE("dart_waitall: -- handle[%d] done (MPI_REQUEST_NULL)",
                          i);
         } else {
-          DART_LOG_DEBUG("dart_waitall: -- MPI_Win_flush(handle[%d]: %p))",
-                         i, (void*)handle[i]);
-          DART_LOG_TRACE("dart_waitall:      handle[%d]->dest: %d",
-                         i, handle[i]->dest);
-          DART_LOG_TRACE("dart_waitall:      handle[%d]->win:  %"PRIu64"",
-                         i, (uint64_t)handle[i]->win);
-          DART_LOG_TRACE("dart_waitall:      handle[%d]->req:  %"PRIu64"",
-                         i, (uint64_t)handle[i]->request);
-          /*
-           * MPI_Win_flush to wait for remote completion:
-           */
-          if (MPI_Win_flush(handle[i]->dest, handle[i]->win) != MPI_SUCCESS) {
-            DART_LOG_ERROR("dart_waitall: MPI_Win_flush failed");
-            DART_LOG_TRACE("dart_waitall: free MPI_Request temporaries");
-            free(mpi_req);
-            DART_LOG_TRACE("dart_waitall: free MPI_Status temporaries");
-            free(mpi_sta);
-            return DART_ERR_INVAL;
-          }
           DART_LOG_TRACE("dart_waitall: -- MPI_Request_free");
           if (MPI_Request_free(&handle[i]->request) != MPI_SUCCESS) {
             DART_LOG_ERROR("dart_waitall: MPI_Request_free failed");
@@ -1390,3 +1517,222 @@ dart_ret_t dart_reduce_double(
            0,
            comm);
 }
+
+dart_ret_t dart_allreduce(
+  void             * sendbuf,
+  void             * recvbuf,
+  size_t             nelem,
+  dart_datatype_t    dtype,
+  dart_operation_t   op,
+  dart_team_t        teamid)
+{
+  MPI_Comm     comm;
+  MPI_Op       mpi_op    = dart_mpi_op(op);
+  MPI_Datatype mpi_dtype = dart_mpi_datatype(dtype);
+  uint16_t     index;
+  int result = dart_adapt_teamlist_convert (teamid, &index);
+  if (result == -1) {
+    return DART_ERR_INVAL;
+  }
+  if (nelem > INT_MAX) {
+    DART_LOG_ERROR("dart_allreduce ! number of elements > INT_MAX");
+    return DART_ERR_INVAL;
+  }
+  comm = dart_teams[index];
+  if (MPI_Allreduce(
+        sendbuf,
+        recvbuf,
+        (int)nelem,
+        mpi_dtype,
+        mpi_op,
+        comm) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_allreduce ! MPI_Allreduce failed");
+    return DART_ERR_INVAL;
+  }
+  return DART_OK;
+}
+
+/** Reduction function and user data of a call of dart_allreduce_custom
+ *  or dart_exscan_custom.
+ *  Attached to the call's element datatype, so concurrent calls in
+ *  multiple threads do not share state. */
+typedef struct {
+  dart_reduce_func_t   func;
+  void               * userdata;
+} dart_custom_op_t;
+
+/** Datatype attribute key of the dart_custom_op_t of a call, created in
+ *  dart_init and read-only afterwards. */
+static int _dart_custom_op_keyval = MPI_KEYVAL_INVALID;
+
+dart_ret_t dart_adapt_reduce_init()
+{
+  if (MPI_Type_create_keyval(
+        MPI_TYPE_NULL_COPY_FN,
+        MPI_TYPE_NULL_DELETE_FN,
+        &_dart_custom_op_keyval,
+        NULL) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_adapt_reduce_init ! MPI_Type_create_keyval failed");
+    return DART_ERR_OTHER;
+  }
+  return DART_OK;
+}
+
+dart_ret_t dart_adapt_reduce_destroy()
+{
+  if (_dart_custom_op_keyval != MPI_KEYVAL_INVALID &&
+      MPI_Type_free_keyval(&_dart_custom_op_keyval) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_adapt_reduce_destroy ! MPI_Type_free_keyval failed");
+    return DART_ERR_OTHER;
+  }
+  return DART_OK;
+}
+
+static void dart__mpi__custom_op(
+  void         * invec,
+  void         * inoutvec,
+  int          * len,
+  MPI_Datatype * dtype)
+{
+  dart_custom_op_t * custom_op;
+  int                found = 0;
+  if (MPI_Type_get_attr(
+        *dtype, _dart_custom_op_keyval, &custom_op, &found)
+      != MPI_SUCCESS || !found) {
+    DART_LOG_ERROR("dart__mpi__custom_op ! reduction function not found");
+    return;
+  }
+  custom_op->func(
+    invec, inoutvec, (size_t)(*len), custom_op->userdata);
+}
+
+/**
+ * Create the element datatype and MPI operation of a user-defined
+ * reduction, the datatype refers to \c custom_op.
+ */
+static dart_ret_t dart__mpi__custom_op_create(
+  size_t             elem_size,
+  int                commute,
+  dart_custom_op_t * custom_op,
+  MPI_Datatype     * mpi_dtype,
+  MPI_Op           * mpi_op)
+{
+  if (MPI_Type_contiguous((int)elem_size, MPI_BYTE, mpi_dtype)
+      != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart__mpi__custom_op_create ! "
+                   "MPI_Type_contiguous failed");
+    return DART_ERR_OTHER;
+  }
+  if (MPI_Type_commit(mpi_dtype) != MPI_SUCCESS ||
+      MPI_Type_set_attr(*mpi_dtype, _dart_custom_op_keyval, custom_op)
+      != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart__mpi__custom_op_create ! "
+                   "MPI_Type_commit or MPI_Type_set_attr failed");
+    MPI_Type_free(mpi_dtype);
+    return DART_ERR_OTHER;
+  }
+  if (MPI_Op_create(&dart__mpi__custom_op, commute, mpi_op)
+      != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart__mpi__custom_op_create ! MPI_Op_create failed");
+    MPI_Type_free(mpi_dtype);
+    return DART_ERR_OTHER;
+  }
+  return DART_OK;
+}
+
+dart_ret_t dart_allreduce_custom(
+  const void         * sendbuf,
+  void               * recvbuf,
+  size_t               nelem,
+  size_t               elem_size,
+  dart_reduce_func_t   func,
+  void               * userdata,
+  dart_team_t          teamid)
+{
+  MPI_Comm         comm;
+  MPI_Datatype     mpi_dtype;
+  MPI_Op           mpi_op;
+  uint16_t         index;
+  int              mpi_ret;
+  dart_ret_t       ret;
+  dart_custom_op_t custom_op;
+  int result = dart_adapt_teamlist_convert (teamid, &index);
+  if (result == -1) {
+    return DART_ERR_INVAL;
+  }
+  if (nelem > INT_MAX || elem_size > INT_MAX) {
+    DART_LOG_ERROR("dart_allreduce_custom ! element count or size > INT_MAX");
+    return DART_ERR_INVAL;
+  }
+  comm               = dart_teams[index];
+  custom_op.func     = func;
+  custom_op.userdata = userdata;
+  ret = dart__mpi__custom_op_create(
+          elem_size, 1, &custom_op, &mpi_dtype, &mpi_op);
+  if (ret != DART_OK) {
+    return ret;
+  }
+  mpi_ret = MPI_Allreduce(
+              (void *)(sendbuf),
+              recvbuf,
+              (int)nelem,
+              mpi_dtype,
+              mpi_op,
+              comm);
+  MPI_Op_free(&mpi_op);
+  MPI_Type_free(&mpi_dtype);
+  if (mpi_ret != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_allreduce_custom ! MPI_Allreduce failed");
+    return DART_ERR_INVAL;
+  }
+  return DART_OK;
+}
+
+dart_ret_t dart_exscan_custom(
+  const void         * sendbuf,
+  void               * recvbuf,
+  size_t               nelem,
+  size_t               elem_size,
+  dart_reduce_func_t   func,
+  void               * userdata,
+  dart_team_t          teamid)
+{
+  MPI_Comm         comm;
+  MPI_Datatype     mpi_dtype;
+  MPI_Op           mpi_op;
+  uint16_t         index;
+  int              mpi_ret;
+  dart_ret_t       ret;
+  dart_custom_op_t custom_op;
+  int result = dart_adapt_teamlist_convert (teamid, &index);
+  if (result == -1) {
+    return DART_ERR_INVAL;
+  }
+  if (nelem > INT_MAX || elem_size > INT_MAX) {
+    DART_LOG_ERROR("dart_exscan_custom ! element count or size > INT_MAX");
+    return DART_ERR_INVAL;
+  }
+  comm               = dart_teams[index];
+  custom_op.func     = func;
+  custom_op.userdata = userdata;
+  /* Not commutative, operands are combined in the order of units: */
+  ret = dart__mpi__custom_op_create(
+          elem_size, 0, &custom_op, &mpi_dtype, &mpi_op);
+  if (ret != DART_OK) {
+    return ret;
+  }
+  mpi_ret = MPI_Exscan(
+              (void *)(sendbuf),
+              recvbuf,
+              (int)nelem,
+              mpi_dtype,
+              mpi_op,
+              comm);
+  MPI_Op_free(&mpi_op);
+  MPI_Type_free(&mpi_dtype);
+  if (mpi_ret != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_exscan_custom ! MPI_Exscan failed");
+    return DART_ERR_INVAL;
+  }
+  return DART_OK;
+}
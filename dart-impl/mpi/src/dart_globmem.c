@@ -88,6 +88,16 @@ dart_ret_t dart_gptr_setunit (dart_gptr_t* gptr, dart_unit_t unit_id)
 	return DART_OK;
 }
 
+dart_ret_t dart_gptr_getteam (const dart_gptr_t gptr, dart_team_t* teamid)
+{
+	/* For local allocation, the flag is '0' which is the index of
+	 * DART_TEAM_ALL. */
+	if (dart_adapt_teamlist_teamid (gptr.flags, teamid) == -1) {
+		return DART_ERR_INVAL;
+	}
+	return DART_OK;
+}
+
 dart_ret_t dart_memalloc (size_t nbytes, dart_gptr_t *gptr)
 {
 	dart_unit_t unitid;
@@ -13,6 +13,8 @@
 #include <dash/dart/mpi/dart_team_private.h>
 #include <dash/dart/mpi/dart_translation.h>
 #include <dash/dart/mpi/dart_globmem_priv.h>
+#include <dash/dart/mpi/dart_active_messages_priv.h>
+#include <dash/dart/mpi/dart_reduce_priv.h>
 
 #define DART_BUDDY_ORDER 24
 
@@ -243,6 +245,17 @@ dart_ret_t dart_init(
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
 	MPI_Info_free(&win_info);
 #endif
+
+	/* Create send queues of active messages. */
+	if (dart_adapt_amsg_init() != DART_OK) {
+    DART_LOG_ERROR("dart_init: dart_adapt_amsg_init failed");
+    return DART_ERR_OTHER;
+  }
+	/* Create the attribute key of user-defined reductions. */
+	if (dart_adapt_reduce_init() != DART_OK) {
+    DART_LOG_ERROR("dart_init: dart_adapt_reduce_init failed");
+    return DART_ERR_OTHER;
+  }
 	DART_LOG_DEBUG("dart_init: Initialization finished");
 
   _dart_initialized = 1;
@@ -278,6 +291,8 @@ dart_ret_t dart_exit()
     return DART_ERR_OTHER;
   }
 	/* -- Free up all the resources for dart programme -- */
+	dart_adapt_amsg_destroy();
+	dart_adapt_reduce_destroy();
 	MPI_Win_free(&dart_win_local_alloc);
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
 	MPI_Win_free(&dart_sharedmem_win_local_alloc);
@@ -163,3 +163,20 @@ int dart_adapt_teamlist_convert (dart_team_t teamid, uint16_t* index)
 		return -1;	
 	}
 }
+
+int dart_adapt_teamlist_teamid (uint16_t index, dart_team_t* teamid)
+{
+	int i;
+	if (index == 0) {
+		*teamid = DART_TEAM_ALL;
+		return 0;
+	}
+	for (i = 0; i < dart_allocated_teamlist_size; i ++) {
+		if (dart_allocated_teamlist_array[i].index == index) {
+			*teamid = dart_allocated_teamlist_array[i].allocated_teamid;
+			return i;
+		}
+	}
+	DART_LOG_ERROR ("Invalid team index input: %d", index);
+	return -1;
+}
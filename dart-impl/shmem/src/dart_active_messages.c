@@ -0,0 +1,56 @@
+
+#include <dash/dart/base/logging.h>
+#include <dash/dart/if/dart.h>
+#include <dash/dart/if/dart_types.h>
+#include <dash/dart/if/dart_active_messages.h>
+
+/*
+ * Active messages are not supported by DART-SHMEM: handlers cannot be
+ * registered and messages cannot be sent. Operations completing
+ * messages succeed as no message can be in transit.
+ */
+
+dart_ret_t dart_am_register(
+  dart_am_handler_t      handler,
+  void                 * userdata,
+  dart_am_handler_id_t * handler_id)
+{
+  DART_LOG_DEBUG("dart_am_register: not supported by DART-SHMEM");
+  *handler_id = -1;
+  return DART_ERR_NOTSUPPORTED;
+}
+
+dart_ret_t dart_am_send(
+  dart_unit_t            unit,
+  dart_am_handler_id_t   handler_id,
+  const void           * payload,
+  size_t                 nbytes)
+{
+  DART_LOG_ERROR("dart_am_send: not supported by DART-SHMEM");
+  return DART_ERR_NOTSUPPORTED;
+}
+
+dart_ret_t dart_am_flush(
+  dart_unit_t unit)
+{
+  return DART_OK;
+}
+
+dart_ret_t dart_am_flush_all()
+{
+  return DART_OK;
+}
+
+dart_ret_t dart_am_progress(
+  size_t * num_processed)
+{
+  if (num_processed != NULL) {
+    *num_processed = 0;
+  }
+  return DART_OK;
+}
+
+dart_ret_t dart_am_fence()
+{
+  return DART_OK;
+}
@@ -1,4 +1,7 @@
 
+#include <stdlib.h>
+#include <string.h>
+
 #include <dash/dart/if/dart_types.h>
 #include <dash/dart/if/dart_globmem.h>
 #include <dash/dart/if/dart_communication.h>
@@ -137,3 +140,67 @@ dart_ret_t dart_allgather(void *sendbuf, void *recvbuf, size_t nbytes,
   dart_bcast(recvbuf,nbytes,root,team);
   return DART_OK;
 }
+
+dart_ret_t dart_allreduce_custom(const void *sendbuf, void *recvbuf,
+				 size_t nelem, size_t elem_size,
+				 dart_reduce_func_t func, void *userdata,
+				 dart_team_t team)
+{
+  size_t tsize;
+  size_t nbytes = nelem * elem_size;
+  size_t i;
+  char  *all;
+  dart_ret_t ret = dart_team_size(team, &tsize);
+  if (ret != DART_OK) {
+    return ret;
+  }
+  DEBUG("dart_allreduce_custom on team %d, tsize=%d", team, tsize);
+  all = malloc(nbytes * tsize);
+  if (all == NULL) {
+    return DART_ERR_OTHER;
+  }
+  ret = dart_allgather((void *)sendbuf, all, nbytes, team);
+  if (ret == DART_OK) {
+    memcpy(recvbuf, all, nbytes);
+    for (i = 1; i < tsize; i++) {
+      func(all + i * nbytes, recvbuf, nelem, userdata);
+    }
+  }
+  free(all);
+  return ret;
+}
+
+dart_ret_t dart_exscan_custom(const void *sendbuf, void *recvbuf,
+			      size_t nelem, size_t elem_size,
+			      dart_reduce_func_t func, void *userdata,
+			      dart_team_t team)
+{
+  size_t tsize;
+  size_t nbytes = nelem * elem_size;
+  size_t i;
+  dart_unit_t myid;
+  char  *all;
+  dart_ret_t ret = dart_team_size(team, &tsize);
+  if (ret != DART_OK) {
+    return ret;
+  }
+  ret = dart_team_myid(team, &myid);
+  if (ret != DART_OK) {
+    return ret;
+  }
+  DEBUG("dart_exscan_custom on team %d, tsize=%d", team, tsize);
+  all = malloc(nbytes * tsize);
+  if (all == NULL) {
+    return DART_ERR_OTHER;
+  }
+  ret = dart_allgather((void *)sendbuf, all, nbytes, team);
+  if (ret == DART_OK && myid > 0) {
+    /* combine elements of preceding units in order of their ids: */
+    memcpy(recvbuf, all + (myid - 1) * nbytes, nbytes);
+    for (i = myid - 1; i > 0; i--) {
+      func(all + (i - 1) * nbytes, recvbuf, nelem, userdata);
+    }
+  }
+  free(all);
+  return ret;
+}
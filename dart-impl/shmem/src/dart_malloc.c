@@ -67,6 +67,15 @@ dart_ret_t dart_gptr_setunit(
   return DART_OK;
 }
 
+dart_ret_t dart_gptr_getteam(
+  const dart_gptr_t gptr,
+  dart_team_t *teamid) {
+  (void)(gptr);
+  /* Teams are not recorded in global pointers of the shmem backend */
+  *teamid = DART_TEAM_ALL;
+  return DART_OK;
+}
+
 dart_ret_t dart_gptr_incaddr(
   dart_gptr_t *gptr,
   int offs) {
@@ -1,4 +1,6 @@
 
+#include <string.h>
+
 #include <dash/dart/if/dart.h>
 
 #include <dash/dart/shmem/dart_membucket.h>
@@ -43,6 +45,11 @@ dart_ret_t dart_mempool_create(dart_mempoolptr pool,
   dart_membucket membucket;
   int myoffset = myid * localsz;
 
+  // First touch of the unit's partition of the segment by its owner
+  // so its pages are placed on the owner's NUMA node. Units are
+  // pinned by dartrun before the segment is attached:
+  memset(((char*)attach_addr)+myoffset, 0, localsz);
+
   membucket = 
     dart_membucket_create( ((char*)attach_addr)+myoffset, 
 			   localsz );
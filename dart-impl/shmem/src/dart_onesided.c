@@ -40,6 +40,7 @@ inline int dart_shmem_reduce_int(int a, int b, dart_operation_t op) {
     case DART_OP_LOR  : return a || b;
     case DART_OP_BXOR : return a ^ b;
     case DART_OP_LXOR : return (!a) ? b : !b;
+    case DART_OP_NO_OP: return a;
     default           : DART_LOG_ERROR("Unknown reduce operation (%d)",
                                        (int)op);
                         return 0;
@@ -108,6 +109,88 @@ dart_ret_t dart_accumulate(
   return DART_OK;
 }
 
+dart_ret_t dart_fetch_and_op(
+  dart_gptr_t      ptr_dest,
+  const void     * value,
+  void           * result,
+  dart_datatype_t  dtype,
+  dart_operation_t op,
+  dart_team_t      team)
+{
+  int             * addr;
+  int               poolid;
+  dart_unit_t       myid;
+  dart_mempoolptr   pool;
+
+  if (dtype != DART_TYPE_INT) {
+    DART_LOG_ERROR("dart_fetch_and_op: "
+                   "only datatype DART_TYPE_INT supported");
+    return DART_ERR_INVAL;
+  }
+
+  dart_myid(&myid);
+  poolid = ptr_dest.segid;
+  pool   = dart_memarea_get_mempool_by_id(poolid);
+  if(!pool) {
+    return DART_ERR_OTHER;
+  }
+  addr   = ((int*)(pool->localbase_addr)) +               /* pool base addr */
+           ((ptr_dest.unitid - myid) * (pool->localsz)) + /* unit offset    */
+           ptr_dest.addr_or_offs.offset;                  /* element offset */
+  int exp_value = *addr;
+  int new_value;
+  int old_value;
+  /* Compare-and-Swap until no concurrent update intervened */
+  for(;;) {
+    new_value = dart_shmem_reduce_int(exp_value, *((const int *)value), op);
+    old_value = __sync_val_compare_and_swap(
+      addr,
+      exp_value,
+      new_value);
+    if (old_value == exp_value) {
+      break;
+    }
+    exp_value = old_value;
+  }
+  *((int *)result) = old_value;
+  return DART_OK;
+}
+
+dart_ret_t dart_compare_and_swap(
+  dart_gptr_t      ptr_dest,
+  const void     * value,
+  const void     * compare,
+  void           * result,
+  dart_datatype_t  dtype,
+  dart_team_t      team)
+{
+  int             * addr;
+  int               poolid;
+  dart_unit_t       myid;
+  dart_mempoolptr   pool;
+
+  if (dtype != DART_TYPE_INT) {
+    DART_LOG_ERROR("dart_compare_and_swap: "
+                   "only datatype DART_TYPE_INT supported");
+    return DART_ERR_INVAL;
+  }
+
+  dart_myid(&myid);
+  poolid = ptr_dest.segid;
+  pool   = dart_memarea_get_mempool_by_id(poolid);
+  if(!pool) {
+    return DART_ERR_OTHER;
+  }
+  addr   = ((int*)(pool->localbase_addr)) +               /* pool base addr */
+           ((ptr_dest.unitid - myid) * (pool->localsz)) + /* unit offset    */
+           ptr_dest.addr_or_offs.offset;                  /* element offset */
+  *((int *)result) = __sync_val_compare_and_swap(
+                       addr,
+                       *((const int *)compare),
+                       *((const int *)value));
+  return DART_OK;
+}
+
 dart_ret_t dart_get_handle(
   void *dest,
   dart_gptr_t ptr,
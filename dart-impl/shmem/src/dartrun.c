@@ -1,5 +1,5 @@
 
-#define _POSIX_SOURCE
+#define _GNU_SOURCE
 
 
 #include <stdio.h>
@@ -10,6 +10,7 @@
 #include <sys/wait.h>
 #include <dirent.h>
 #include <signal.h>
+#include <sched.h>
 
 #include <dash/dart/shmem/dart_shmem.h>
 #include <dash/dart/shmem/shmem_logger.h>
@@ -24,11 +25,38 @@ typedef struct
 
 spawn_t spawntable[MAXNUM_UNITS];
 
+/*
+ * Placement policies for pinning units to CPUs:
+ *
+ *   none    : no affinity, placement is left to the OS scheduler
+ *   compact : unit i is pinned to the i-th available CPU
+ *   scatter : units are distributed round-robin over sockets
+ *   list    : units are pinned to CPUs in an explicit core list,
+ *             e.g. "0,2,4-7"
+ */
+typedef enum
+{
+  PLACEMENT_NONE = 0,
+  PLACEMENT_COMPACT,
+  PLACEMENT_SCATTER,
+  PLACEMENT_LIST
+} placement_t;
+
+#define DART_SYSFS_CPU_PKG_ID \
+  "/sys/devices/system/cpu/cpu%d/topology/physical_package_id"
+
 int  dart_start(int argc, char* argv[]);
 dart_ret_t dart_usage(char *s);
 
+int dart_placement_parse(const char *spec, placement_t *policy,
+			 int *cpulist, int *ncpus);
+int dart_placement_resolve(placement_t policy, int nprocs,
+			   const int *cpulist, int ncpus,
+			   int *unit_cpus);
+
 pid_t dart_spawn(int id, int nprocs, int shm_id, 
 		 size_t syncarea_size,
+		 int cpu,
 		 char *exec, int argc, char **argv,
 		 int nargs);
 
@@ -52,20 +80,34 @@ int dart_start(int argc, char* argv[])
   DEBUG("dart_start %s", "called");
   
   int nargs=0;
-  int nprocs;      // number of processes to start
+  int nprocs=1;    // number of processes to start
   char *dashapp;   // path to app executable
-  
-  if( argc>=2 && !strncmp("-n", argv[1], 2) ) {
-    nprocs = argc>=3?atoi(argv[2]):0;
-    if (nprocs <= 0) {
-      fprintf(stderr, "Error: Enter a positive integer %s\n", 
-	      argv[2]?argv[2]:"");
+  placement_t placement = PLACEMENT_NONE;
+  int cpulist[CPU_SETSIZE];
+  int ncpus = 0;
+  int unit_cpus[MAXNUM_UNITS];
+
+  while( argc>=nargs+2 && argv[nargs+1][0]=='-' ) {
+    if( !strcmp("-n", argv[nargs+1]) ) {
+      nprocs = argc>=nargs+3?atoi(argv[nargs+2]):0;
+      if (nprocs <= 0 || nprocs > MAXNUM_UNITS) {
+	fprintf(stderr, "Error: Enter a positive integer <= %d %s\n",
+		MAXNUM_UNITS, argv[nargs+2]?argv[nargs+2]:"");
+	return 1;
+      }
+    } else if( !strcmp("-b", argv[nargs+1]) ) {
+      if( argc<nargs+3 ||
+	  dart_placement_parse(argv[nargs+2], &placement,
+			       cpulist, &ncpus) != 0 ) {
+	fprintf(stderr, "Error: Invalid placement policy %s\n",
+		argc>=nargs+3?argv[nargs+2]:"");
+	return 1;
+      }
+    } else {
+      fprintf(stderr, "Error: Unknown option %s\n", argv[nargs+1]);
       return 1;
     }
-    nargs=2;
-  } else {
-    nprocs=1;
-    nargs=0;
+    nargs+=2;
   }
 
   dashapp = argc>=nargs+2?argv[nargs+1]:0;
@@ -75,6 +117,12 @@ int dart_start(int argc, char* argv[])
 	      dashapp);
     return 1;
   }
+
+  if( dart_placement_resolve(placement, nprocs,
+			     cpulist, ncpus, unit_cpus) != 0 ) {
+    fprintf(stderr, "Error: Could not resolve unit placement\n");
+    return 1;
+  }
   
   size_t syncarea_size = 4096*64; 
   
@@ -91,6 +139,7 @@ int dart_start(int argc, char* argv[])
              nprocs,
              shm_id,
              syncarea_size,
+             unit_cpus[i],
              dashapp,
              argc,
              argv,
@@ -140,16 +189,180 @@ int dart_start(int argc, char* argv[])
 dart_ret_t dart_usage(char *s)
 {
   fprintf(stderr, 
-	  "Usage: %s [-n <n>] <executable> <args> \n"
-	  "       runs n copies of executable\n", s);
+	  "Usage: %s [-n <n>] [-b <policy>] <executable> <args> \n"
+	  "       runs n copies of executable\n"
+	  "       -b pins units to CPUs, policy is one of:\n"
+	  "          none    : no pinning (default)\n"
+	  "          compact : fill CPUs in order of their id\n"
+	  "          scatter : round-robin over sockets\n"
+	  "          <list>  : explicit core list, e.g. 0,2,4-7\n", s);
   return DART_OK;
 }
 
+/*
+ * Parse a placement specification, either a policy name or an
+ * explicit core list like "0,2,4-7".
+ */
+int dart_placement_parse(
+  const char  *spec,
+  placement_t *policy,
+  int         *cpulist,
+  int         *ncpus)
+{
+  const char *c = spec;
+  char *end;
+  long first, last, cpu;
+
+  *ncpus = 0;
+  if (!strcmp(spec, "none")) {
+    *policy = PLACEMENT_NONE;
+    return 0;
+  }
+  if (!strcmp(spec, "compact")) {
+    *policy = PLACEMENT_COMPACT;
+    return 0;
+  }
+  if (!strcmp(spec, "scatter")) {
+    *policy = PLACEMENT_SCATTER;
+    return 0;
+  }
+  while (*c != '\0') {
+    first = strtol(c, &end, 10);
+    if (end == c || first < 0 || first >= CPU_SETSIZE) {
+      return -1;
+    }
+    last = first;
+    c    = end;
+    if (*c == '-') {
+      c++;
+      last = strtol(c, &end, 10);
+      if (end == c || last < first || last >= CPU_SETSIZE) {
+	return -1;
+      }
+      c = end;
+    }
+    for (cpu = first; cpu <= last && *ncpus < CPU_SETSIZE; cpu++) {
+      cpulist[(*ncpus)++] = (int)cpu;
+    }
+    if (*c == ',') {
+      c++;
+    } else if (*c != '\0') {
+      return -1;
+    }
+  }
+  *policy = PLACEMENT_LIST;
+  return (*ncpus > 0) ? 0 : -1;
+}
+
+/*
+ * Socket of the given CPU from sysfs, 0 if unknown.
+ */
+static int dart_cpu_socket(int cpu)
+{
+  char fname[128];
+  int  socket = 0;
+  FILE *f;
+
+  sprintf(fname, DART_SYSFS_CPU_PKG_ID, cpu);
+  f = fopen(fname, "r");
+  if (f) {
+    if (fscanf(f, "%d", &socket) != 1 || socket < 0) {
+      socket = 0;
+    }
+    fclose(f);
+  }
+  return socket;
+}
+
+/*
+ * Resolve the CPU each unit is pinned to, -1 if the unit is
+ * not pinned.
+ * Only CPUs in the affinity mask of dartrun itself are used, so
+ * units respect restrictions imposed by a batch system or by
+ * taskset/numactl.
+ */
+int dart_placement_resolve(
+  placement_t  policy,
+  int          nprocs,
+  const int   *cpulist,
+  int          ncpus,
+  int         *unit_cpus)
+{
+  cpu_set_t avail;
+  int cpus[CPU_SETSIZE];
+  int cpu_sockets[CPU_SETSIZE];
+  int sockets[CPU_SETSIZE];
+  int navail   = 0;
+  int nsockets = 0;
+  int i, j, s, socket, n, k;
+
+  for (i = 0; i < nprocs; i++) {
+    unit_cpus[i] = -1;
+  }
+  if (policy == PLACEMENT_NONE) {
+    return 0;
+  }
+  if (policy == PLACEMENT_LIST) {
+    for (i = 0; i < nprocs; i++) {
+      unit_cpus[i] = cpulist[i % ncpus];
+    }
+    return 0;
+  }
+  CPU_ZERO(&avail);
+  if (sched_getaffinity(0, sizeof(avail), &avail) != 0) {
+    ERRNO("sched_getaffinity%s", "");
+    return -1;
+  }
+  for (i = 0; i < CPU_SETSIZE; i++) {
+    if (CPU_ISSET(i, &avail)) {
+      cpus[navail++] = i;
+    }
+  }
+  if (navail == 0) {
+    return -1;
+  }
+  if (policy == PLACEMENT_COMPACT) {
+    for (i = 0; i < nprocs; i++) {
+      unit_cpus[i] = cpus[i % navail];
+    }
+    return 0;
+  }
+  // PLACEMENT_SCATTER: collect distinct sockets in order of
+  // their first CPU:
+  for (i = 0; i < navail; i++) {
+    cpu_sockets[i] = dart_cpu_socket(cpus[i]);
+    for (s = 0; s < nsockets; s++) {
+      if (sockets[s] == cpu_sockets[i]) break;
+    }
+    if (s == nsockets) {
+      sockets[nsockets++] = cpu_sockets[i];
+    }
+  }
+  // Unit i is placed on socket i % nsockets, at the
+  // (i / nsockets)-th CPU of that socket:
+  for (i = 0; i < nprocs; i++) {
+    socket = sockets[i % nsockets];
+    n      = 0;
+    for (j = 0; j < navail; j++) {
+      if (cpu_sockets[j] == socket) n++;
+    }
+    k = (i / nsockets) % n;
+    for (j = 0; j < navail; j++) {
+      if (cpu_sockets[j] == socket && k-- == 0) {
+	unit_cpus[i] = cpus[j];
+	break;
+      }
+    }
+  }
+  return 0;
+}
+
 pid_t dart_spawn(
   int id,
   int nprocs,
   int shm_id, 
   size_t syncarea_size,
+  int cpu,
   char *exec,
   int argc,
   char **argv,
@@ -180,6 +393,16 @@ pid_t dart_spawn(
   
   pid = fork();
   if (pid == 0) {
+    // Pin the unit before it attaches to any shared memory segment,
+    // the affinity mask is inherited across execv:
+    if (cpu >= 0) {
+      cpu_set_t cpuset;
+      CPU_ZERO(&cpuset);
+      CPU_SET(cpu, &cpuset);
+      if (sched_setaffinity(0, sizeof(cpuset), &cpuset) != 0) {
+        ERRNO("sched_setaffinity(cpu:%d)", cpu);
+      }
+    }
     int result = execv(exec, dartv);
     if (result == -1) {
       char* s = strerror(errno);
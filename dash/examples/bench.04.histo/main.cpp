@@ -57,11 +57,6 @@ int main(int argc, char **argv)
     work_buf[ key_array.local[i] ]++; 
   }
 
-  // turn it into a cumulative histogram
-  for(int i=0; i<MAX_KEY-1; i++ ) {
-    //work_buf[i+1] += work_buf[i];
-  }
-
   // compute the offset of this unit's local part in 
   // the global key_histo array
   auto& pat = key_histo.pattern();
@@ -78,6 +73,11 @@ int main(int argc, char **argv)
       key_histo.local[i] += remote[goffs+i];
     }
   }
+
+  // turn it into a cumulative histogram
+  dash::inclusive_scan(key_histo.begin(), key_histo.end(),
+                       key_histo.begin());
+
   dash::barrier();
   TIMESTAMP(tstop);
 
@@ -989,6 +989,25 @@ public:
     return std::array<IndexType, 1> { index };
   }
 
+  /**
+   * Index of block at given global coordinates.
+   *
+   * \see  DashPatternConcept
+   */
+  index_type block_at(
+    /// Global coordinates of element
+    const std::array<index_type, NumDimensions> & g_coords) const
+  {
+    dart_unit_t block_idx = 0;
+    auto g_coord         = g_coords[0];
+    for (; block_idx < _nunits - 1; ++block_idx) {
+      if (_block_offsets[block_idx+1] > g_coord) {
+        return block_idx;
+      }
+    }
+    return _nunits-1;
+  }
+
   /**
    * View spec (offset and extents) of block at global linear block index in
    * cartesian element space.
@@ -58,6 +58,9 @@ void init_values(Iter begin, Iter end, unsigned);
 template<class ArrayType>
 double test_pattern_gups(ArrayType & a, unsigned, unsigned);
 
+template<class ArrayType>
+double test_gptr_gups(ArrayType & a, unsigned, unsigned);
+
 void perform_test(unsigned ELEM_PER_UNIT, unsigned REPEAT);
 
 double gups(
@@ -126,6 +129,9 @@ void perform_test(
            << ", "
            << std::setw(11)
            << "tiled"
+           << ", "
+           << std::setw(11)
+           << "gptr"
            << endl;
     }
     return;
@@ -161,6 +167,7 @@ void perform_test(
   double t_mock  = test_pattern_gups(arr_mock_dist,  ELEM_PER_UNIT, REPEAT);
   double t_irreg = test_pattern_gups(arr_irreg_dist, ELEM_PER_UNIT, REPEAT);
   double t_tiled = test_pattern_gups(arr_tiled_dist, ELEM_PER_UNIT, REPEAT);
+  double t_gptr  = test_gptr_gups(arr_tiled_dist,    ELEM_PER_UNIT, REPEAT);
 
   dash::barrier();
   
@@ -168,6 +175,7 @@ void perform_test(
     double gups_mock  = gups(num_units, t_mock,  ELEM_PER_UNIT, REPEAT);
     double gups_irreg = gups(num_units, t_irreg, ELEM_PER_UNIT, REPEAT);
     double gups_tiled = gups(num_units, t_tiled, ELEM_PER_UNIT, REPEAT);
+    double gups_gptr  = gups(num_units, t_gptr,  ELEM_PER_UNIT, REPEAT);
 
     cout << std::setw(10)
          << num_units
@@ -186,6 +194,9 @@ void perform_test(
          << ", "
          << std::setw(11) << std::fixed << std::setprecision(4)
          << gups_tiled
+         << ", "
+         << std::setw(11) << std::fixed << std::setprecision(4)
+         << gups_gptr
          << endl;
   }
 }
@@ -232,4 +243,37 @@ double test_pattern_gups(
   return Timer::ElapsedSince(ts_start);
 }
 
+/**
+ * Measures resolution of global pointers from unit and local offset,
+ * as performed in every dereference of a global iterator.
+ */
+template<
+  class ArrayType
+>
+double test_gptr_gups(
+  ArrayType & a,
+  unsigned ELEM_PER_UNIT,
+  unsigned REPEAT)
+{
+  auto & globmem   = a.begin().globmem();
+  auto   num_units = dash::size();
+  // Accumulate offsets so resolution of global pointers cannot be
+  // eliminated by the compiler:
+  uint64_t offs_sum = 0;
+
+  auto ts_start = Timer::Now();
+  for (auto i = 0; i < REPEAT; ++i) {
+    for (auto unit_id = 0; unit_id < num_units; ++unit_id) {
+      for (auto l_idx = 0; l_idx < ELEM_PER_UNIT; ++l_idx) {
+        dart_gptr_t gptr = globmem.index_to_gptr(unit_id, l_idx);
+        offs_sum += gptr.addr_or_offs.offset + gptr.unitid;
+      }
+    }
+  }
+  double elapsed = Timer::ElapsedSince(ts_start);
+  if (offs_sum == 0) {
+    cout << "";
+  }
+  return elapsed;
+}
 
@@ -35,6 +35,7 @@ void perform_test(long long NELEM, int REPEAT)
 {
   Timer::timestamp_t ts_start;
   double duration_us;
+  double duration_minmax_us;
 
   dash::Array<T, long long> arr(NELEM);
 
@@ -50,11 +51,19 @@ void perform_test(long long NELEM, int REPEAT)
   }
   duration_us = Timer::ElapsedSince(ts_start);
 
+  ts_start = Timer::Now();
+  for( auto i=0; i<REPEAT; i++ ) {
+    auto minmax = dash::minmax_element(arr.begin(), arr.end());
+    dash__unused(minmax);
+  }
+  duration_minmax_us = Timer::ElapsedSince(ts_start);
+
   if (dash::myid() == 0) {
     cout << "NUNIT: "        << setw(10) << dash::size()
          << " NELEM: "       << setw(16) << arr.size()
          << " REPEAT: "      << setw(16) << REPEAT
          << " TIME [msec]: " << setw(12) << 1.0e-3 * duration_us
+         << " MINMAX [msec]: " << setw(12) << 1.0e-3 * duration_minmax_us
          << endl;
   }
 }
@@ -0,0 +1,75 @@
+/*
+ * Strong and weak scaling benchmark for dash::sort.
+ *
+ * Strong scaling: total number of keys is fixed, weak scaling: number of
+ * keys per unit is fixed.
+ */
+/* @DASH_HEADER@ */
+
+#include <libdash.h>
+
+#include <iostream>
+#include <iomanip>
+#include <cstdlib>
+#include <string>
+
+using std::cout;
+using std::endl;
+using std::setw;
+
+typedef dash::util::Timer<dash::util::TimeMeasure::Clock> Timer;
+
+template<typename T>
+void perform_test(const std::string & mode, long long NELEM, int REPEAT);
+
+int main(int argc, char **argv)
+{
+  dash::init(&argc, &argv);
+  Timer::Calibrate(0);
+
+  long long nunits = dash::size();
+
+  // Strong scaling, fixed total number of keys:
+  perform_test<int>("strong", 1000000ll,            10);
+  perform_test<int>("strong", 10000000ll,           10);
+  perform_test<int>("strong", 100000000ll,          5);
+  // Weak scaling, fixed number of keys per unit:
+  perform_test<int>("weak",   1000000ll * nunits,   10);
+  perform_test<int>("weak",   10000000ll * nunits,  5);
+
+  dash::finalize();
+
+  return 0;
+}
+
+template<typename T>
+void perform_test(const std::string & mode, long long NELEM, int REPEAT)
+{
+  Timer::timestamp_t ts_start;
+  double duration_us = 0;
+
+  dash::Array<T, long long> arr(NELEM);
+
+  for (int i = 0; i < REPEAT; i++) {
+    std::srand(dash::myid() * REPEAT + i);
+    for (auto & el: arr.local) {
+      el = std::rand();
+    }
+    arr.barrier();
+
+    ts_start = Timer::Now();
+    dash::sort(arr.begin(), arr.end());
+    duration_us += Timer::ElapsedSince(ts_start);
+  }
+
+  if (dash::myid() == 0) {
+    cout << "MODE: "         << setw(6)  << mode
+         << " NUNIT: "       << setw(10) << dash::size()
+         << " NELEM: "       << setw(16) << arr.size()
+         << " REPEAT: "      << setw(6)  << REPEAT
+         << " TIME [msec]: " << setw(12) << 1.0e-3 * duration_us / REPEAT
+         << " MKEYS/S: "     << setw(12) << arr.size() * REPEAT
+                                            / duration_us
+         << endl;
+  }
+}
@@ -0,0 +1,117 @@
+/*
+ * Throughput benchmark for dash::UnorderedMap.
+ *
+ * Every round consists of a batch of inserts of new keys followed by a
+ * batch of lookups of random existing keys, the fraction of inserts in
+ * all operations is varied from insert-heavy to lookup-heavy mixes.
+ */
+/* @DASH_HEADER@ */
+
+#include <libdash.h>
+
+#include <iostream>
+#include <iomanip>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+using std::cout;
+using std::endl;
+using std::setw;
+
+typedef dash::util::Timer<dash::util::TimeMeasure::Clock> Timer;
+
+typedef dash::UnorderedMap<long, long> map_t;
+
+void perform_test(long NOPS, double INSERT_RATIO, int ROUNDS);
+
+int main(int argc, char **argv)
+{
+  dash::init(&argc, &argv);
+  Timer::Calibrate(0);
+
+  // Insert-heavy to lookup-heavy mixes, operations per unit and round:
+  perform_test(100000, 1.0,  5);
+  perform_test(100000, 0.9,  5);
+  perform_test(100000, 0.5,  5);
+  perform_test(100000, 0.1,  5);
+  perform_test(100000, 0.01, 5);
+
+  dash::finalize();
+
+  return 0;
+}
+
+void perform_test(long NOPS, double INSERT_RATIO, int ROUNDS)
+{
+  long nunits   = dash::size();
+  long myid     = dash::myid();
+  long ninsert  = static_cast<long>(NOPS * INSERT_RATIO);
+  long nlookup  = NOPS - ninsert;
+  // Keys inserted in all rounds, load factor 0.5:
+  map_t map(2 * std::max(ninsert, 1L) * ROUNDS * nunits);
+
+  std::vector< std::pair<long, long> > elements(ninsert);
+  std::vector<long>                    keys(nlookup);
+  std::vector<long>                    values(nlookup);
+  std::unique_ptr<bool[]>              found(new bool[nlookup]);
+  // Initial keys, lookups require existing keys:
+  long nkeys = 0;
+  if (ninsert == 0) {
+    elements.resize(1);
+  }
+
+  unsigned int seed         = 23 + myid;
+  double       insert_us    = 0;
+  double       lookup_us    = 0;
+  long         total_found  = 0;
+  for (int r = 0; r < ROUNDS; ++r) {
+    for (size_t i = 0; i < elements.size(); ++i) {
+      // Keys are unique across units and rounds:
+      long key    = (nkeys + i) * nunits + myid;
+      elements[i] = std::make_pair(key, key);
+    }
+    nkeys += elements.size();
+
+    map.barrier();
+    auto ts_start = Timer::Now();
+    map.insert(elements.begin(), elements.end()).wait();
+    map.barrier();
+    insert_us += Timer::ElapsedSince(ts_start);
+
+    for (long i = 0; i < nlookup; ++i) {
+      keys[i] = rand_r(&seed) % (nkeys * nunits);
+    }
+    ts_start = Timer::Now();
+    total_found += map.find(keys.begin(), keys.end(), values.data(),
+                            found.get());
+    map.barrier();
+    lookup_us += Timer::ElapsedSince(ts_start);
+  }
+
+  long nops_insert = ninsert * ROUNDS * nunits;
+  long nops_lookup = nlookup * ROUNDS * nunits;
+  if (myid == 0) {
+    cout << "NUNIT: "          << setw(6)  << nunits
+         << " INSERT RATIO: "  << setw(6)  << INSERT_RATIO
+         << " ROUNDS: "        << setw(4)  << ROUNDS
+         << " INSERTS: "       << setw(10) << nops_insert
+         << " LOOKUPS: "       << setw(10) << nops_lookup
+         << " TIME [msec]: "   << setw(10)
+         << 1.0e-3 * (insert_us + lookup_us)
+         << " MOPS/S: "        << setw(10)
+         << (nops_insert + nops_lookup) / (insert_us + lookup_us)
+         << " INSERT MOPS/S: " << setw(10)
+         << (insert_us > 0 ? nops_insert / insert_us : 0)
+         << " LOOKUP MOPS/S: " << setw(10)
+         << (lookup_us > 0 ? nops_lookup / lookup_us : 0)
+         << endl;
+  }
+  if (total_found != nlookup * ROUNDS) {
+    cout << "Unit " << myid << ": "
+         << total_found << " of " << nlookup * ROUNDS << " keys found"
+         << endl;
+  }
+}
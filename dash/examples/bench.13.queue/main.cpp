@@ -0,0 +1,122 @@
+/*
+ * Throughput benchmark for dash::Queue.
+ *
+ * Every unit enqueues elements in the rings of random units and then
+ * dequeues elements until all rings are empty, stealing elements from
+ * other units when its local ring is empty. The number of elements in
+ * bulk operations is varied to show amortization of atomic operations.
+ */
+/* @DASH_HEADER@ */
+
+#include <libdash.h>
+
+#include <iostream>
+#include <iomanip>
+#include <cstdlib>
+#include <vector>
+
+using std::cout;
+using std::endl;
+using std::setw;
+
+typedef dash::util::Timer<dash::util::TimeMeasure::Clock> Timer;
+
+typedef dash::Queue<long> queue_t;
+
+void perform_test(long NELEM, long BULK, int ROUNDS);
+
+int main(int argc, char **argv)
+{
+  dash::init(&argc, &argv);
+  Timer::Calibrate(0);
+
+  // Elements per unit and round, elements per bulk operation:
+  perform_test(20000, 1,    5);
+  perform_test(20000, 8,    5);
+  perform_test(20000, 64,   5);
+  perform_test(20000, 512,  5);
+
+  dash::finalize();
+
+  return 0;
+}
+
+void perform_test(long NELEM, long BULK, int ROUNDS)
+{
+  long    nunits = dash::size();
+  long    myid   = dash::myid();
+  // Rings are large enough for imbalanced random targets:
+  queue_t queue(2 * NELEM);
+
+  std::vector<long> values(NELEM);
+  std::vector<long> buf(BULK);
+  for (long i = 0; i < NELEM; ++i) {
+    values[i] = myid * NELEM + i;
+  }
+
+  unsigned int seed       = 31 + myid;
+  double       push_us    = 0;
+  double       pop_us     = 0;
+  long         npushed    = 0;
+  long         npopped    = 0;
+  long         nsteals    = 0;
+  for (int r = 0; r < ROUNDS; ++r) {
+    queue.barrier();
+    auto ts_start = Timer::Now();
+    for (long i = 0; i < NELEM; i += BULK) {
+      long last   = std::min(i + BULK, NELEM);
+      long target = rand_r(&seed) % nunits;
+      npushed    += queue.push(values.data() + i, values.data() + last,
+                               target);
+    }
+    queue.barrier();
+    push_us += Timer::ElapsedSince(ts_start);
+
+    ts_start = Timer::Now();
+    for (;;) {
+      auto n = queue.pop_from(myid, buf.data(), buf.data() + BULK);
+      if (n == 0) {
+        n = queue.pop(buf.data(), buf.data() + BULK);
+        if (n == 0) {
+          break;
+        }
+        ++nsteals;
+      }
+      npopped += n;
+    }
+    queue.barrier();
+    pop_us += Timer::ElapsedSince(ts_start);
+  }
+
+  long nops = NELEM * ROUNDS * nunits;
+  if (myid == 0) {
+    cout << "NUNIT: "        << setw(6)  << nunits
+         << " BULK: "        << setw(6)  << BULK
+         << " ROUNDS: "      << setw(4)  << ROUNDS
+         << " ELEMENTS: "    << setw(10) << nops
+         << " TIME [msec]: " << setw(10)
+         << 1.0e-3 * (push_us + pop_us)
+         << " PUSH MOPS/S: " << setw(10) << nops / push_us
+         << " POP MOPS/S: "  << setw(10) << nops / pop_us
+         << " STEALS (unit 0): " << setw(8) << nsteals
+         << endl;
+  }
+  // Every enqueued element has been dequeued once:
+  dash::Array<long> counts(2 * nunits);
+  counts.local[0] = npushed;
+  counts.local[1] = npopped;
+  counts.barrier();
+  if (myid == 0) {
+    long total_pushed = 0;
+    long total_popped = 0;
+    for (long u = 0; u < nunits; ++u) {
+      total_pushed += counts[2 * u];
+      total_popped += counts[2 * u + 1];
+    }
+    if (total_pushed != total_popped) {
+      cout << "Enqueued " << total_pushed << " elements, "
+           << "dequeued " << total_popped << " elements" << endl;
+    }
+  }
+  counts.barrier();
+}
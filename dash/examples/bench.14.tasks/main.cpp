@@ -0,0 +1,132 @@
+/*
+ * Benchmark of the task runtime dash::tasks.
+ *
+ * Adaptive integration of an oscillating function: every task bisects
+ * its interval until the trapezoidal rule converges, so the task tree is
+ * irregular. All tasks are created at unit 0, other units receive work
+ * by stealing task descriptors. Steal rates are reported for varying
+ * tolerances.
+ */
+/* @DASH_HEADER@ */
+
+#include <libdash.h>
+
+#include <iostream>
+#include <iomanip>
+#include <atomic>
+#include <cmath>
+#include <mutex>
+
+using std::cout;
+using std::endl;
+using std::setw;
+
+typedef dash::util::Timer<dash::util::TimeMeasure::Clock> Timer;
+
+void perform_test(double EPSILON, int ROUNDS);
+
+namespace {
+
+std::mutex _sum_mutex;
+double     _sum = 0;
+
+double f(double x)
+{
+  return std::sin(1.0 / (x + 0.01)) * std::exp(-x);
+}
+
+struct integrate {
+  void operator()(double a, double b, double fa, double fb, double eps) {
+    double m      = 0.5 * (a + b);
+    double fm     = f(m);
+    double coarse = 0.5 * (b - a) * (fa + fb);
+    double fine   = 0.25 * (b - a) * (fa + 2 * fm + fb);
+    if (std::fabs(fine - coarse) < eps || b - a < 1.0e-12) {
+      std::lock_guard<std::mutex> lock(_sum_mutex);
+      _sum += fine;
+      return;
+    }
+    dash::tasks::async_stealable<integrate>(a, m, fa, fm, 0.5 * eps);
+    dash::tasks::async_stealable<integrate>(m, b, fm, fb, 0.5 * eps);
+  }
+};
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+  dash::init(&argc, &argv);
+  Timer::Calibrate(0);
+
+  if (dash::myid() == 0) {
+    cout << "THREADS PER UNIT: " << dash::tasks::num_threads() << endl;
+  }
+  perform_test(1.0e-6, 5);
+  perform_test(1.0e-7, 5);
+  perform_test(1.0e-8, 5);
+
+  dash::finalize();
+
+  return 0;
+}
+
+void perform_test(double EPSILON, int ROUNDS)
+{
+  long nunits = dash::size();
+  long myid   = dash::myid();
+  dash::Array<double> sums(nunits);
+  dash::Array<long>   counts(3 * nunits);
+
+  double total_us = 0;
+  double integral = 0;
+  dash::tasks::reset_statistics();
+  for (int r = 0; r < ROUNDS; ++r) {
+    _sum = 0;
+    dash::Team::All().barrier();
+    auto ts_start = Timer::Now();
+    if (myid == 0) {
+      dash::tasks::async_stealable<integrate>(0.0, 1.0, f(0.0), f(1.0),
+                                              EPSILON);
+    }
+    dash::tasks::complete();
+    total_us += Timer::ElapsedSince(ts_start);
+
+    sums.local[0] = _sum;
+    sums.barrier();
+    if (myid == 0) {
+      integral = 0;
+      for (long u = 0; u < nunits; ++u) {
+        integral += sums[u];
+      }
+    }
+    sums.barrier();
+  }
+
+  auto stats = dash::tasks::statistics();
+  counts.local[0] = stats.executed;
+  counts.local[1] = stats.remote_steal_attempts;
+  counts.local[2] = stats.remote_tasks_stolen;
+  counts.barrier();
+  if (myid == 0) {
+    long ntasks   = 0;
+    long attempts = 0;
+    long nstolen  = 0;
+    for (long u = 0; u < nunits; ++u) {
+      ntasks   += counts[3 * u];
+      attempts += counts[3 * u + 1];
+      nstolen  += counts[3 * u + 2];
+    }
+    cout << "NUNIT: "           << setw(6)  << nunits
+         << " EPSILON: "        << setw(8)  << EPSILON
+         << " ROUNDS: "         << setw(4)  << ROUNDS
+         << " TASKS: "          << setw(10) << ntasks
+         << " TIME [msec]: "    << setw(10) << 1.0e-3 * total_us
+         << " MTASKS/S: "       << setw(10) << ntasks / total_us
+         << " STEAL ATTEMPTS: " << setw(10) << attempts
+         << " STOLEN: "         << setw(10) << nstolen
+         << " INTEGRAL: "       << std::setprecision(10) << integral
+         << std::setprecision(6)
+         << endl;
+  }
+  counts.barrier();
+}
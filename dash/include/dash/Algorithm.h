@@ -7,13 +7,19 @@
 
 #include <dash/algorithm/Operation.h>
 #include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/ExecutionPolicy.h>
 #include <dash/algorithm/ForEach.h>
 #include <dash/algorithm/MinMax.h>
 #include <dash/algorithm/Transform.h>
 #include <dash/algorithm/Accumulate.h>
 #include <dash/algorithm/Copy.h>
+#include <dash/algorithm/CopyPlan.h>
 #include <dash/algorithm/Fill.h>
 #include <dash/algorithm/Generate.h>
+#include <dash/algorithm/Sort.h>
+#include <dash/algorithm/Scan.h>
+#include <dash/algorithm/Find.h>
+#include <dash/algorithm/Gather.h>
 
 #include <dash/algorithm/SUMMA.h>
 
@@ -6,6 +6,7 @@
 #include <dash/GlobIter.h>
 #include <dash/GlobRef.h>
 #include <dash/GlobAsyncRef.h>
+#include <dash/GlobAsyncBatch.h>
 #include <dash/Team.h>
 #include <dash/Pattern.h>
 #include <dash/HView.h>
@@ -274,6 +275,8 @@ public:
 
 private:
   Array<T, IndexType, PatternType> * const _array;
+  /// Queued element accesses
+  GlobAsyncBatch<T>                        _batch;
 
 public:
   /**
@@ -333,7 +336,7 @@ public:
   inline const_async_reference operator[](const size_t n) const  {
     return async_reference(
              _array->m_globmem,
-             (*(_array->begin() + n)).dart_gptr());
+             dart_gptr(n));
   }
 
   /**
@@ -342,33 +345,79 @@ public:
   async_reference operator[](const size_t n) {
     return async_reference(
              _array->m_globmem,
-             (*(_array->begin() + n)).dart_gptr());
+             dart_gptr(n));
+  }
+
+  /**
+   * Global pointer to the array element at the given global index.
+   * Resolved from the array's pattern and global memory without creating
+   * a global iterator.
+   */
+  dart_gptr_t dart_gptr(const size_t n) const {
+    auto l_pos = _array->m_pattern.local(n);
+    return _array->m_globmem->index_to_gptr(l_pos.unit, l_pos.index);
+  }
+
+  /**
+   * Queues a write of the given value to the array element at the given
+   * global index. Queued writes are submitted in bulk by \c push and
+   * \c flush.
+   *
+   * \see  dash::GlobAsyncBatch
+   */
+  void put(const size_t n, const T & value) {
+    _batch.put(dart_gptr(n), value);
+  }
+
+  /**
+   * Queues a read of the array element at the given global index.
+   *
+   * \returns  Position of the element's value in the result of the next
+   *           call of \c fetch_values
+   * \see      dash::GlobAsyncBatch
+   */
+  size_type get(const size_t n) {
+    return _batch.get(dart_gptr(n));
+  }
+
+  /**
+   * Submits all queued reads in bulk.
+   *
+   * \returns  Future of the values of all elements read, in the order of
+   *           calls of \c get
+   */
+  dash::Future< std::vector<T> > fetch_values() {
+    return _batch.fetch_values();
   }
 
   /**
    * Complete all outstanding asynchronous operations on the referenced array
-   * on all units.
+   * on all units, including queued writes.
    */
   void flush() {
     DASH_LOG_TRACE("AsyncArrayRef.flush()");
+    _batch.flush();
     // could also call _array->flush();
     _array->m_globmem->flush();
   }
 
   void flush_local() {
     DASH_LOG_TRACE("AsyncArrayRef.flush_local()");
+    _batch.push();
     // could also call _array->flush_local();
     _array->m_globmem->flush_local();
   }
 
   void flush_all() {
     DASH_LOG_TRACE("AsyncArrayRef.flush()");
+    _batch.flush();
     // could also call _array->flush();
     _array->m_globmem->flush_all();
   }
 
   void flush_local_all() {
     DASH_LOG_TRACE("AsyncArrayRef.flush_local_all()");
+    _batch.push();
     // could also call _array->flush_local_all();
     _array->m_globmem->flush_local_all();
   }
@@ -81,7 +81,7 @@ private:
     MemoryLayout_t;
   typedef CartesianIndexSpace<NumDimensions, Arrangement, IndexType>
     LocalMemoryLayout_t;
-  typedef CartesianSpace<NumDimensions, SizeType>
+  typedef CartesianIndexSpace<NumDimensions, Arrangement, SizeType>
     BlockSpec_t;
   typedef CartesianSpace<NumDimensions, SizeType>
     BlockSizeSpec_t;
@@ -998,7 +998,7 @@ public:
     dart_unit_t block_idx = 0;
     auto g_coord         = g_coords[0];
     for (; block_idx < _nunits - 1; ++block_idx) {
-      if (_block_offsets[block_idx+1] >= g_coord) {
+      if (_block_offsets[block_idx+1] > g_coord) {
         DASH_LOG_TRACE_VAR("CSRPattern.block_at >", block_idx);
         return block_idx;
       }
@@ -2382,7 +2382,7 @@ public:
     dart_unit_t block_idx = 0;
     auto g_coord         = g_coords[0];
     for (; block_idx < _nunits - 1; ++block_idx) {
-      if (_block_offsets[block_idx+1] >= g_coord) {
+      if (_block_offsets[block_idx+1] > g_coord) {
         DASH_LOG_TRACE_VAR("CSRPattern.block_at >", block_idx);
         return block_idx;
       }
@@ -60,5 +60,8 @@
 
 #include<dash/Array.h>
 #include<dash/Matrix.h>
+#include<dash/UnorderedMap.h>
+#include<dash/Vector.h>
+#include<dash/Queue.h>
 
 #endif // DASH__CONTAINER_H_
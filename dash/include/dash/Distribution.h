@@ -5,6 +5,8 @@
 #include <dash/Enums.h>
 #include <dash/internal/Logging.h>
 
+#include <iostream>
+
 namespace dash {
 
 /**
@@ -206,6 +208,10 @@ Distribution TILE(int blockSize);
  */
 Distribution BLOCKCYCLIC(int blockSize);
 
+std::ostream & operator<<(
+  std::ostream       & os,
+  const Distribution & distribution);
+
 } // namespace dash
 
 #endif // DASH__DISTRIBUTION_H_
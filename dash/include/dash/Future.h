@@ -1,25 +1,296 @@
 #ifndef DASH__FUTURE_H__INCLUDED
 #define DASH__FUTURE_H__INCLUDED
 
+#include <dash/Exception.h>
+#include <dash/internal/Logging.h>
+#include <dash/dart/if/dart_communication.h>
+
 #include <cstddef>
-#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
 #include <sstream>
 #include <iostream>
+#include <typeinfo>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace dash {
 
+namespace internal {
+
+/**
+ * Move-only function object of signature \c R(), used for the deferred
+ * functions and continuations of futures.
+ *
+ * Callables of up to \c InlineSize bytes are stored in the object itself
+ * without heap allocation, larger callables like the continuations of
+ * chained \c dash::Future::then calls are allocated in heap memory.
+ */
+template<typename R>
+class future_func
+{
+public:
+  /// Maximum size of callables stored in place
+  static const size_t InlineSize = 128;
+
+private:
+  typedef future_func<R> self_t;
+  typedef typename std::aligned_storage<
+            InlineSize, alignof(std::max_align_t)>::type storage_t;
+
+  /// Type-erased operations on the stored callable
+  typedef struct {
+    R    (*call)(void * storage);
+    void (*move)(void * dst, void * src);
+    void (*destroy)(void * storage);
+  } ops_t;
+
+  template<class F>
+  struct inline_ops
+  {
+    static R call(void * storage)
+    {
+      return (*static_cast<F *>(storage))();
+    }
+    static void move(void * dst, void * src)
+    {
+      new (dst) F(std::move(*static_cast<F *>(src)));
+      static_cast<F *>(src)->~F();
+    }
+    static void destroy(void * storage)
+    {
+      static_cast<F *>(storage)->~F();
+    }
+  };
+
+  template<class F>
+  struct heap_ops
+  {
+    static R call(void * storage)
+    {
+      return (**static_cast<F **>(storage))();
+    }
+    static void move(void * dst, void * src)
+    {
+      *static_cast<F **>(dst) = *static_cast<F **>(src);
+    }
+    static void destroy(void * storage)
+    {
+      delete *static_cast<F **>(storage);
+    }
+  };
+
+  template<class F>
+  struct is_inline
+  : std::integral_constant<
+      bool,
+      sizeof(F) <= InlineSize &&
+      alignof(F) <= alignof(storage_t) &&
+      std::is_nothrow_move_constructible<F>::value >
+  { };
+
+private:
+  storage_t     _storage;
+  const ops_t * _ops = nullptr;
+
+public:
+  future_func()
+  { }
+
+  /**
+   * Stores the given callable, in place if it fits into \c InlineSize
+   * bytes.
+   */
+  template<
+    class F,
+    class = typename std::enable_if<
+              !std::is_same<typename std::decay<F>::type, self_t>::value
+            >::type,
+    class = decltype(static_cast<R>(
+              std::declval<typename std::decay<F>::type &>()())) >
+  future_func(F && func)
+  {
+    typedef typename std::decay<F>::type func_t;
+    store<func_t>(std::forward<F>(func), is_inline<func_t>());
+  }
+
+  future_func(const self_t & other) = delete;
+  self_t & operator=(const self_t & other) = delete;
+
+  future_func(self_t && other)
+  {
+    move_from(other);
+  }
+
+  self_t & operator=(self_t && other)
+  {
+    if (this != &other) {
+      reset();
+      move_from(other);
+    }
+    return *this;
+  }
+
+  ~future_func()
+  {
+    reset();
+  }
+
+  explicit operator bool() const
+  {
+    return _ops != nullptr;
+  }
+
+  R operator()()
+  {
+    return _ops->call(&_storage);
+  }
+
+private:
+  template<class F, class G>
+  void store(G && func, std::true_type)
+  {
+    static const ops_t ops = {
+      &inline_ops<F>::call, &inline_ops<F>::move, &inline_ops<F>::destroy
+    };
+    new (&_storage) F(std::forward<G>(func));
+    _ops = &ops;
+  }
+
+  template<class F, class G>
+  void store(G && func, std::false_type)
+  {
+    static const ops_t ops = {
+      &heap_ops<F>::call, &heap_ops<F>::move, &heap_ops<F>::destroy
+    };
+    *reinterpret_cast<F **>(&_storage) = new F(std::forward<G>(func));
+    _ops = &ops;
+  }
+
+  void move_from(self_t & other)
+  {
+    _ops = other._ops;
+    if (_ops != nullptr) {
+      _ops->move(&_storage, &other._storage);
+      other._ops = nullptr;
+    }
+  }
+
+  void reset()
+  {
+    if (_ops != nullptr) {
+      _ops->destroy(&_storage);
+      _ops = nullptr;
+    }
+  }
+};
+
+} // namespace internal
+
+template<typename ResultT>
+class Future;
+
+template<typename ResultT>
+Future<ResultT> make_ready_future(const ResultT & value);
+
+template<class InputIt>
+Future< std::vector<typename std::iterator_traits<InputIt>::value_type
+                      ::value_type> >
+when_all(InputIt first, InputIt last);
+
+template<class InputIt>
+InputIt when_any(InputIt first, InputIt last);
+
+/**
+ * Result of an asynchronous operation.
+ *
+ * A future either holds the DART handles of one-sided communication
+ * requests, or a function that is evaluated when waiting for the result
+ * (deferred future).
+ *
+ * Futures of communication requests are completed by testing or waiting
+ * for the requests' handles. Up to \c NumInlineHandles handles are stored
+ * in the future object itself without heap allocation. The result is
+ * either known in advance, like the end of a copy operation's output
+ * range, or computed by a continuation when the requests have completed.
+ *
+ * Futures are move-only, every request is completed by exactly one
+ * future. A future that is destroyed or assigned before its result has
+ * been waited for completes pending requests and evaluates its function
+ * or continuation, discarding the result. Operations that complete in a
+ * collective function, like \c dash::copy_async of global ranges, are
+ * therefore also completed at units that do not wait for the future.
+ *
+ * Functions and continuations are stored in the future object without
+ * heap allocation if their size does not exceed
+ * \c dash::internal::future_func::InlineSize.
+ *
+ * Example:
+ *
+ * \code
+ *     std::vector< dash::Future<double *> > futs;
+ *     futs.push_back(dash::copy_async(blk_a.begin(), blk_a.end(), buf_a));
+ *     futs.push_back(dash::copy_async(blk_b.begin(), blk_b.end(), buf_b));
+ *     while (!futs[0].test()) {
+ *       // Overlap computation with communication of block A
+ *     }
+ *     auto fut_all = dash::when_all(futs.begin(), futs.end());
+ *     fut_all.wait();
+ * \endcode
+ */
 template<typename ResultT>
 class Future
 {
+  template<typename ResultT_>
+  friend class Future;
+
+  template<typename ResultT_>
+  friend Future<ResultT_> make_ready_future(const ResultT_ & value);
+
+  template<class InputIt>
+  friend Future< std::vector<typename std::iterator_traits<InputIt>
+                               ::value_type::value_type> >
+  when_all(InputIt first, InputIt last);
+
+  template<class InputIt>
+  friend InputIt when_any(InputIt first, InputIt last);
+
+public:
+  typedef ResultT                       value_type;
+
+  /// Number of request handles stored in the future object, larger
+  /// numbers of handles are stored in heap memory
+  static const size_t NumInlineHandles = 4;
+
 private:
-  typedef Future<ResultT>               self_t;
-  typedef std::function<ResultT (void)> func_t;
+  typedef Future<ResultT>                 self_t;
+  typedef internal::future_func<ResultT>  func_t;
 
 private:
-  func_t    _func;
-  ResultT   _value;
-  bool      _ready     = false;
-  bool      _has_func  = false;
+  /// Handles of pending requests if there are at most
+  /// \c NumInlineHandles handles
+  dart_handle_t              _inline_handles[NumInlineHandles];
+  /// Handles of pending requests if there are more than
+  /// \c NumInlineHandles handles
+  std::vector<dart_handle_t> _ext_handles;
+  /// Number of handles of pending requests
+  size_t                     _num_handles = 0;
+  /// Whether requests are completed remotely, e.g. for put operations
+  bool                       _remote      = false;
+  /// Function evaluated when waiting for the result, or continuation
+  /// evaluated on completion of requests
+  func_t                     _func;
+  ResultT                    _value;
+  bool                       _ready       = false;
+  bool                       _has_func    = false;
+  /// Whether the future has been initialized with a result, function or
+  /// requests and has not been moved from
+  bool                       _valid       = false;
+  /// Whether completion can only be determined by evaluating the future's
+  /// function in a blocking wait
+  bool                       _deferred    = false;
 
 public:
   // For ostream output
@@ -30,57 +301,154 @@ public:
 
 public:
   Future()
-  : _ready(false),
-    _has_func(false)
   { }
 
-  Future(const func_t & func)
-  : _func(func),
-    _ready(false),
-    _has_func(true)
+  /**
+   * Creates a deferred future, the given function is evaluated when
+   * waiting for the result.
+   */
+  Future(func_t && func)
+  : _func(std::move(func)),
+    _has_func(true),
+    _valid(true),
+    _deferred(true)
   { }
 
+  /**
+   * Creates a future of pending one-sided communication requests with
+   * a result that is valid once all requests have completed.
+   */
   Future(
-    const self_t & other)
-  : _func(other._func),
-    _value(other._value),
-    _ready(other._ready),
-    _has_func(other._has_func)
-  { }
+    /// Handles of pending requests, null handles are ignored
+    const std::vector<dart_handle_t> & handles,
+    /// Result of the operation
+    const ResultT                    & value,
+    /// Whether requests must be completed at their targets, e.g. put
+    /// operations, instead of locally only
+    bool                               remote_completion = false)
+  : _remote(remote_completion),
+    _value(value),
+    _valid(true)
+  {
+    set_handles(handles.begin(), handles.end());
+  }
 
-  Future<ResultT> & operator=(const self_t & other)
+  /**
+   * Creates a future of pending one-sided communication requests with
+   * a result that is computed by the given continuation once all
+   * requests have completed.
+   * The continuation must not block.
+   */
+  Future(
+    /// Handles of pending requests, null handles are ignored
+    const std::vector<dart_handle_t> & handles,
+    /// Continuation computing the result
+    func_t                          && func,
+    /// Whether requests must be completed at their targets, e.g. put
+    /// operations, instead of locally only
+    bool                               remote_completion = false)
+  : _remote(remote_completion),
+    _func(std::move(func)),
+    _has_func(true),
+    _valid(true)
+  {
+    set_handles(handles.begin(), handles.end());
+  }
+
+  Future(const self_t & other) = delete;
+
+  Future(self_t && other)
+  {
+    move_from(other);
+  }
+
+  self_t & operator=(const self_t & other) = delete;
+
+  self_t & operator=(self_t && other)
   {
     if (this != &other) {
-      _func      = other._func;
-      _value     = other._value;
-      _ready     = other._ready;
-      _has_func  = other._has_func;
+      complete_pending();
+      move_from(other);
     }
     return *this;
   }
 
+  /**
+   * Completes pending requests and evaluates a pending function or
+   * continuation, the result is discarded.
+   */
+  ~Future()
+  {
+    complete_pending();
+  }
+
+  /**
+   * Whether the future refers to a result, i.e. it has been initialized
+   * and has not been moved from.
+   */
+  bool valid() const
+  {
+    return _valid;
+  }
+
+  /**
+   * Blocks until the result is available.
+   */
   void wait()
   {
     DASH_LOG_TRACE_VAR("Future.wait()", _ready);
     if (_ready) {
       return;
     }
-    if (!_has_func) {
+    if (!_valid) {
       DASH_LOG_ERROR("Future.wait()", "No function");
       DASH_THROW(
         dash::exception::RuntimeError,
         "Future not initialized with function");
     }
-    _value = _func();
+    complete_handles(true);
+    if (_has_func) {
+      _value = _func();
+      _func  = func_t();
+    }
     _ready = true;
     DASH_LOG_TRACE_VAR("Future.wait >", _ready);
   }
 
-  bool test() const
+  /**
+   * Tests for completion of the operation without blocking on pending
+   * requests.
+   * Completes the future if all requests have completed locally. The
+   * result of a deferred future is only available after \c wait.
+   *
+   * \returns  \c true if the result is available
+   */
+  bool test()
   {
-    return _ready;
+    if (_ready) {
+      return true;
+    }
+    if (!_valid || _deferred) {
+      return false;
+    }
+    if (_num_handles > 0) {
+      int32_t finished = 0;
+      DASH_ASSERT_RETURNS(
+        dart_testall_local(handles(), _num_handles, &finished),
+        DART_OK);
+      if (!finished) {
+        return false;
+      }
+    }
+    // Requests have completed locally, waiting for remote completion of
+    // put requests does not depend on other units:
+    wait();
+    return true;
   }
 
+  /**
+   * Blocks until the result is available and returns it.
+   */
   ResultT & get()
   {
     DASH_LOG_TRACE_VAR("Future.get()", _ready);
@@ -89,8 +457,293 @@ public:
     return _value;
   }
 
+  /**
+   * Creates a future of the result of the given continuation which is
+   * invoked with the result of this future once it is available.
+   * Pending requests are transferred to the returned future, this future
+   * is invalid afterwards.
+   *
+   * \tparam  Continuation  Function object of signature
+   *                        <tt>R(ResultT)</tt>, must not block
+   */
+  template<class Continuation>
+  Future<typename std::result_of<Continuation(ResultT)>::type>
+  then(Continuation cont)
+  {
+    typedef typename std::result_of<Continuation(ResultT)>::type
+      cont_result_t;
+    Future<cont_result_t> fut;
+    fut._remote   = _remote;
+    fut._deferred = _deferred;
+    fut._valid    = _valid;
+    fut._has_func = true;
+    fut.set_handles(handles(), handles() + _num_handles);
+    _num_handles  = 0;
+    fut._func     = then_func<Continuation>(cont, release_result());
+    return fut;
+  }
+
+private:
+  /**
+   * Continuation invoked with the result of a future.
+   */
+  template<class Continuation>
+  struct then_func
+  {
+    typedef typename std::result_of<Continuation(ResultT)>::type
+      result_t;
+
+    then_func(const Continuation & cont, func_t && result)
+    : cont(cont),
+      result(std::move(result))
+    { }
+
+    result_t operator()()
+    {
+      return cont(result());
+    }
+
+    Continuation cont;
+    func_t       result;
+  };
+
+  /**
+   * Function returning a result that is known in advance.
+   */
+  struct value_func
+  {
+    ResultT operator()()
+    {
+      return value;
+    }
+
+    ResultT value;
+  };
+
+private:
+  dart_handle_t * handles()
+  {
+    return (_num_handles > NumInlineHandles)
+           ? _ext_handles.data()
+           : _inline_handles;
+  }
+
+  template<class HandleIt>
+  void set_handles(HandleIt first, HandleIt last)
+  {
+    _num_handles = 0;
+    _ext_handles.clear();
+    size_t num_handles = 0;
+    for (auto it = first; it != last; ++it) {
+      if (*it != NULL) {
+        ++num_handles;
+      }
+    }
+    if (num_handles > NumInlineHandles) {
+      _ext_handles.reserve(num_handles);
+    }
+    for (auto it = first; it != last; ++it) {
+      if (*it == NULL) {
+        continue;
+      }
+      if (num_handles > NumInlineHandles) {
+        _ext_handles.push_back(*it);
+      } else {
+        _inline_handles[_num_handles] = *it;
+      }
+      ++_num_handles;
+    }
+  }
+
+  /**
+   * Completes pending requests and evaluates a pending function without
+   * throwing, used if the result is discarded.
+   */
+  void complete_pending()
+  {
+    complete_handles(false);
+    if (_valid && !_ready && _has_func) {
+      try {
+        _func();
+      } catch (const std::exception & e) {
+        DASH_LOG_ERROR("Future.complete_pending", e.what());
+      }
+    }
+    _func     = func_t();
+    _has_func = false;
+  }
+
+  /**
+   * Waits for completion of pending requests and releases their handles.
+   */
+  void complete_handles(bool throw_on_error)
+  {
+    if (_num_handles == 0) {
+      return;
+    }
+    dart_ret_t ret = _remote
+                     ? dart_waitall(handles(), _num_handles)
+                     : dart_waitall_local(handles(), _num_handles);
+    _num_handles = 0;
+    _ext_handles.clear();
+    if (ret != DART_OK && throw_on_error) {
+      DASH_LOG_ERROR("Future.complete_handles", "dart_waitall failed");
+      DASH_THROW(
+        dash::exception::RuntimeError,
+        "Future: waiting for completion of requests failed");
+    }
+  }
+
+  /**
+   * Function producing the result of the future once all requests have
+   * completed. Invalidates the future.
+   */
+  func_t release_result()
+  {
+    func_t result;
+    if (_has_func && !_ready) {
+      result = std::move(_func);
+    } else {
+      result = value_func { _value };
+    }
+    _func     = func_t();
+    _has_func = false;
+    _valid    = false;
+    return result;
+  }
+
+  void move_from(self_t & other)
+  {
+    for (size_t h = 0; h < NumInlineHandles; ++h) {
+      _inline_handles[h] = other._inline_handles[h];
+    }
+    _ext_handles       = std::move(other._ext_handles);
+    _num_handles       = other._num_handles;
+    _remote            = other._remote;
+    _func              = std::move(other._func);
+    _value             = std::move(other._value);
+    _ready             = other._ready;
+    _has_func          = other._has_func;
+    _valid             = other._valid;
+    _deferred          = other._deferred;
+    other._num_handles = 0;
+    other._func        = func_t();
+    other._ready       = false;
+    other._has_func    = false;
+    other._valid       = false;
+    other._ext_handles.clear();
+  }
+
 }; // class Future
 
+/**
+ * Creates a future with the given result that is immediately available.
+ */
+template<typename ResultT>
+Future<ResultT> make_ready_future(const ResultT & value)
+{
+  Future<ResultT> fut;
+  fut._value = value;
+  fut._ready = true;
+  fut._valid = true;
+  return fut;
+}
+
+/**
+ * Combines the futures in the range [first, last) to a single future of
+ * the vector of their results.
+ * Pending requests of all futures are tested and completed together in
+ * a single operation. The futures in the range are invalid afterwards.
+ */
+template<class InputIt>
+Future< std::vector<typename std::iterator_traits<InputIt>::value_type
+                      ::value_type> >
+when_all(InputIt first, InputIt last)
+{
+  typedef typename std::iterator_traits<InputIt>::value_type future_t;
+  typedef typename future_t::value_type                     result_t;
+  typedef std::vector<result_t>                             results_t;
+  typedef internal::future_func<result_t>                   func_t;
+
+  // Evaluates the result functions of all combined futures:
+  struct results_func
+  {
+    results_t operator()()
+    {
+      results_t values;
+      values.reserve(results.size());
+      for (auto & result : results) {
+        values.push_back(result());
+      }
+      return values;
+    }
+
+    std::vector<func_t> results;
+  };
+
+  Future<results_t>          fut;
+  std::vector<dart_handle_t> handles;
+  std::vector<func_t>        results;
+  fut._valid    = true;
+  fut._has_func = true;
+  for (auto it = first; it != last; ++it) {
+    future_t & f = *it;
+    if (!f.valid()) {
+      continue;
+    }
+    handles.insert(handles.end(),
+                   f.handles(), f.handles() + f._num_handles);
+    f._num_handles = 0;
+    fut._remote    = fut._remote   || f._remote;
+    fut._deferred  = fut._deferred || f._deferred;
+    results.push_back(f.release_result());
+  }
+  fut.set_handles(handles.begin(), handles.end());
+  fut._func = results_func { std::move(results) };
+  return fut;
+}
+
+/**
+ * Waits until any of the futures in the range [first, last) has
+ * completed, polling the futures' requests without blocking on a single
+ * future.
+ * Deferred futures are waited for if no other future has completed.
+ *
+ * \returns  Iterator to a completed future, or \c last if the range does
+ *           not contain a valid future
+ */
+template<class InputIt>
+InputIt when_any(InputIt first, InputIt last)
+{
+  while (true) {
+    // First valid future that can only be completed in a blocking wait:
+    InputIt deferred = last;
+    bool    polled   = false;
+    for (auto it = first; it != last; ++it) {
+      if (!it->valid()) {
+        continue;
+      }
+      if (it->test()) {
+        return it;
+      }
+      if (it->_deferred) {
+        if (deferred == last) {
+          deferred = it;
+        }
+      } else {
+        polled = true;
+      }
+    }
+    if (!polled) {
+      // No future with pending requests left:
+      if (deferred != last) {
+        deferred->wait();
+      }
+      return deferred;
+    }
+  }
+}
+
 template<typename ResultT>
 std::ostream & operator<<(
   std::ostream & os,
@@ -101,7 +754,7 @@ std::ostream & operator<<(
   if (future._ready) {
     ss << future._value;
   } else {
-    ss << "not ready";
+    ss << "not ready, requests: " << future._num_handles;
   }
   ss << ")";
   return operator<<(os, ss.str());
@@ -0,0 +1,353 @@
+#ifndef DASH__GLOB_ASYNC_BATCH_H__
+#define DASH__GLOB_ASYNC_BATCH_H__
+
+#include <dash/Future.h>
+#include <dash/Exception.h>
+#include <dash/internal/Logging.h>
+#include <dash/dart/if/dart_communication.h>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace dash {
+
+/**
+ * Batch of non-blocking accesses to single elements in global memory.
+ *
+ * Writes and reads are recorded in queues and submitted together:
+ * queued accesses are grouped by target unit and memory segment and
+ * sorted by offset, and every run of accesses to contiguous elements is
+ * transferred in a single one-sided operation. Scattered single-element
+ * accesses to a unit's local block, e.g. in graph or histogram kernels,
+ * therefore result in a small number of bulk transfers per target unit
+ * instead of one round trip per element.
+ *
+ * Example:
+ * \code
+ *   dash::GlobAsyncBatch<int> batch;
+ *   for (auto e : edges) {
+ *     batch.put(array.async.dart_gptr(e.target), e.weight);
+ *     batch.get(array.async.dart_gptr(e.source));
+ *   }
+ *   // Submit all writes, wait for their completion at target units:
+ *   batch.flush();
+ *   // Submit all reads, values are in order of get requests:
+ *   auto values = batch.fetch_values().get();
+ * \endcode
+ *
+ * If an element is written more than once in a batch, the value of the
+ * last write is stored.
+ * Accesses of a batch must not overlap with other accesses to the same
+ * elements before the batch has been completed.
+ *
+ * \see  dash::AsyncArrayRef
+ */
+template<typename T>
+class GlobAsyncBatch
+{
+private:
+  typedef GlobAsyncBatch<T> self_t;
+
+  /**
+   * Queued access to a single element.
+   */
+  typedef struct {
+    /// Global pointer to the accessed element
+    dart_gptr_t gptr;
+    /// Position of the access in its queue
+    size_t      pos;
+  } request_t;
+
+public:
+  typedef T      value_type;
+  typedef size_t size_type;
+
+public:
+  /**
+   * Completes submitted writes, queued accesses are discarded.
+   */
+  ~GlobAsyncBatch()
+  {
+    wait_puts(false);
+  }
+
+  /**
+   * Queues a write of the given value to the element referenced by the
+   * global pointer.
+   */
+  void put(dart_gptr_t gptr, const value_type & value)
+  {
+    _put_requests.push_back(request_t { gptr, _put_values.size() });
+    _put_values.push_back(value);
+  }
+
+  /**
+   * Queues a read of the element referenced by the global pointer.
+   *
+   * \returns  Position of the element's value in the result of the next
+   *           call of \c fetch_values
+   */
+  size_type get(dart_gptr_t gptr)
+  {
+    size_type pos = _get_requests.size();
+    _get_requests.push_back(request_t { gptr, pos });
+    return pos;
+  }
+
+  /**
+   * Number of queued writes.
+   */
+  size_type num_puts() const
+  {
+    return _put_requests.size();
+  }
+
+  /**
+   * Number of queued reads.
+   */
+  size_type num_gets() const
+  {
+    return _get_requests.size();
+  }
+
+  /**
+   * Submits all queued writes and blocks until they have completed
+   * locally, i.e. their values have been sent.
+   * Writes are not guaranteed to be visible at their targets, see
+   * \c flush.
+   */
+  void push()
+  {
+    submit_puts();
+    wait_puts(true);
+  }
+
+  /**
+   * Submits all queued writes and blocks until they have completed at
+   * their target units.
+   */
+  void flush()
+  {
+    push();
+    for (auto & target : _flush_targets) {
+      DASH_ASSERT_RETURNS(
+        dart_flush(target),
+        DART_OK);
+    }
+    _flush_targets.clear();
+  }
+
+  /**
+   * Submits all queued reads.
+   *
+   * \returns  Future of the values of all elements read, in the order of
+   *           calls of \c get
+   */
+  dash::Future< std::vector<value_type> > fetch_values()
+  {
+    DASH_LOG_TRACE("GlobAsyncBatch.fetch_values()", _get_requests.size());
+    typedef std::vector<value_type> values_t;
+    // Receive buffer of elements in order of runs:
+    auto recv_buffer = std::make_shared< std::vector<value_type> >();
+    // Position of every request's value in the receive buffer:
+    auto recv_pos    = std::make_shared< std::vector<size_type> >(
+                         _get_requests.size());
+    std::vector<dart_handle_t> handles;
+    sort_requests(_get_requests);
+    // Reads of the same element are resolved by a single transfer:
+    size_type nunique = 0;
+    for (size_type r = 0; r < _get_requests.size(); ++r) {
+      if (r == 0 ||
+          !same_element(_get_requests[r - 1], _get_requests[r])) {
+        ++nunique;
+      }
+    }
+    recv_buffer->resize(nunique);
+    size_type buf_pos = 0;
+    for_each_run(
+      _get_requests,
+      [&](size_type first, size_type last) {
+        size_type run_begin = buf_pos;
+        for (size_type r = first; r < last; ++r) {
+          if (r > first &&
+              same_element(_get_requests[r - 1], _get_requests[r])) {
+            --buf_pos;
+          }
+          (*recv_pos)[_get_requests[r].pos] = buf_pos++;
+        }
+        dart_handle_t handle;
+        DASH_ASSERT_RETURNS(
+          dart_get_handle(
+            recv_buffer->data() + run_begin,
+            _get_requests[first].gptr,
+            (buf_pos - run_begin) * sizeof(value_type),
+            &handle),
+          DART_OK);
+        handles.push_back(handle);
+      });
+    _get_requests.clear();
+    return dash::Future<values_t>(
+             handles,
+             [=]() {
+               values_t values;
+               values.reserve(recv_pos->size());
+               for (auto pos : *recv_pos) {
+                 values.push_back((*recv_buffer)[pos]);
+               }
+               return values;
+             });
+  }
+
+private:
+  /**
+   * Orders requests by target unit, memory segment and offset. The order
+   * of requests to the same element is preserved.
+   */
+  static void sort_requests(std::vector<request_t> & requests)
+  {
+    std::stable_sort(
+      requests.begin(), requests.end(),
+      [](const request_t & a, const request_t & b) {
+        if (a.gptr.unitid != b.gptr.unitid) {
+          return a.gptr.unitid < b.gptr.unitid;
+        }
+        if (a.gptr.segid != b.gptr.segid) {
+          return a.gptr.segid < b.gptr.segid;
+        }
+        if (a.gptr.flags != b.gptr.flags) {
+          return a.gptr.flags < b.gptr.flags;
+        }
+        return a.gptr.addr_or_offs.offset < b.gptr.addr_or_offs.offset;
+      });
+  }
+
+  static bool same_segment(const dart_gptr_t & a, const dart_gptr_t & b)
+  {
+    return a.unitid == b.unitid &&
+           a.segid  == b.segid  &&
+           a.flags  == b.flags;
+  }
+
+  static bool same_segment(const request_t & a, const request_t & b)
+  {
+    return same_segment(a.gptr, b.gptr);
+  }
+
+  static bool same_element(const request_t & a, const request_t & b)
+  {
+    return same_segment(a, b) &&
+           a.gptr.addr_or_offs.offset == b.gptr.addr_or_offs.offset;
+  }
+
+  /**
+   * Invokes \c run_func on the bounds of every run of sorted requests to
+   * contiguous elements. Requests to the same element are contained in a
+   * single run.
+   */
+  template<class RunFunction>
+  static void for_each_run(
+    const std::vector<request_t> & requests,
+    RunFunction                    run_func)
+  {
+    size_type run_first = 0;
+    for (size_type r = 1; r <= requests.size(); ++r) {
+      if (r < requests.size() &&
+          same_segment(requests[r - 1], requests[r])) {
+        auto prev_offset = requests[r - 1].gptr.addr_or_offs.offset;
+        auto offset      = requests[r].gptr.addr_or_offs.offset;
+        if (offset == prev_offset ||
+            offset == prev_offset + sizeof(value_type)) {
+          continue;
+        }
+      }
+      if (run_first < r) {
+        run_func(run_first, r);
+      }
+      run_first = r;
+    }
+  }
+
+  /**
+   * Issues one put operation for every run of queued writes to
+   * contiguous elements.
+   */
+  void submit_puts()
+  {
+    if (_put_requests.empty()) {
+      return;
+    }
+    DASH_LOG_TRACE("GlobAsyncBatch.submit_puts()", _put_requests.size());
+    // Values of previously submitted writes must remain valid until the
+    // writes have completed:
+    wait_puts(true);
+    sort_requests(_put_requests);
+    _put_buffer.reserve(_put_requests.size());
+    for_each_run(
+      _put_requests,
+      [&](size_type first, size_type last) {
+        size_type run_begin = _put_buffer.size();
+        for (size_type r = first; r < last; ++r) {
+          auto & value = _put_values[_put_requests[r].pos];
+          if (r > first &&
+              same_element(_put_requests[r - 1], _put_requests[r])) {
+            // Last write to an element wins:
+            _put_buffer.back() = value;
+          } else {
+            _put_buffer.push_back(value);
+          }
+        }
+        dart_handle_t handle;
+        DASH_ASSERT_RETURNS(
+          dart_put_handle(
+            _put_requests[first].gptr,
+            _put_buffer.data() + run_begin,
+            (_put_buffer.size() - run_begin) * sizeof(value_type),
+            &handle),
+          DART_OK);
+        _put_handles.push_back(handle);
+        if (_flush_targets.empty() ||
+            !same_segment(_flush_targets.back(), _put_requests[first].gptr)) {
+          _flush_targets.push_back(_put_requests[first].gptr);
+        }
+      });
+    _put_requests.clear();
+    _put_values.clear();
+  }
+
+  /**
+   * Waits for local completion of submitted writes.
+   */
+  void wait_puts(bool throw_on_error)
+  {
+    if (!_put_handles.empty()) {
+      dart_ret_t ret = dart_waitall_local(_put_handles.data(),
+                                          _put_handles.size());
+      _put_handles.clear();
+      if (ret != DART_OK && throw_on_error) {
+        DASH_THROW(
+          dash::exception::RuntimeError,
+          "GlobAsyncBatch: waiting for completion of writes failed");
+      }
+    }
+    _put_buffer.clear();
+  }
+
+private:
+  /// Queued writes
+  std::vector<request_t>     _put_requests;
+  /// Values of queued writes in order of calls of put
+  std::vector<value_type>    _put_values;
+  /// Values of submitted writes in order of runs
+  std::vector<value_type>    _put_buffer;
+  /// Handles of submitted writes
+  std::vector<dart_handle_t> _put_handles;
+  /// Global pointers to targets of writes submitted since the last flush
+  std::vector<dart_gptr_t>   _flush_targets;
+  /// Queued reads
+  std::vector<request_t>     _get_requests;
+};
+
+}  // namespace dash
+
+#endif // DASH__GLOB_ASYNC_BATCH_H__
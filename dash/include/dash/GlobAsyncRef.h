@@ -193,7 +193,7 @@ public:
    */
   bool operator==(const self_t & other) const {
     return (_lptr == other._lptr &&
-            _gptr == other._gptr);
+            DART_GPTR_EQUAL(_gptr, other._gptr));
   }
 
   /**
@@ -6,11 +6,21 @@
 #include <dash/GlobPtr.h>
 
 #include <functional>
+#include <algorithm>
 #include <sstream>
 #include <iostream>
 
 namespace dash {
 
+/**
+ * Iterator on global memory, dereferenced via the pattern's mapping of
+ * global to local indices.
+ *
+ * The iterator caches the range of indices around its last resolved
+ * position that is contiguous in local memory and updates it in const
+ * accessors. A single iterator instance must therefore not be shared by
+ * concurrent threads; every thread must use its own copy.
+ */
 template<
   typename ElementType,
   class    PatternType   = Pattern<1>,
@@ -28,6 +38,8 @@ private:
     self_t;
   typedef typename PatternType::index_type
     IndexType;
+  typedef typename PatternType::local_index_t
+    local_pos_t;
 
 public:
   typedef       ReferenceType                      reference;
@@ -69,6 +81,16 @@ protected:
   dart_unit_t            _myid;
   /// Pointer to first element in local memory
   ElementType          * _lbegin          = nullptr;
+  /// Global index of the first element in the cached range of elements
+  /// that are contiguous in the local memory of a single unit.
+  /// The cached range is updated when dereferencing the iterator, so
+  /// concurrent dereference of a single iterator instance by multiple
+  /// threads is a data race; every thread must use its own copy.
+  mutable IndexType      _lrange_gbegin   = 0;
+  /// Global index past the last element in the cached local range.
+  mutable IndexType      _lrange_gend     = 0;
+  /// Unit and local offset of the first element in the cached local range.
+  mutable local_pos_t    _lrange_lbegin;
 
 public:
   /**
@@ -129,8 +151,6 @@ public:
    */
   operator PointerType() const {
     DASH_LOG_TRACE_VAR("GlobIter.GlobPtr()", _idx);
-    typedef typename pattern_type::local_index_t
-      local_pos_t;
     IndexType idx    = _idx;
     IndexType offset = 0;
     DASH_LOG_TRACE_VAR("GlobIter.GlobPtr()", _max_idx);
@@ -144,7 +164,7 @@ public:
     DASH_LOG_TRACE_VAR("GlobIter.GlobPtr", idx);
     DASH_LOG_TRACE_VAR("GlobIter.GlobPtr", offset);
     // Global index to local index and unit:
-    local_pos_t local_pos = _pattern->local(idx);
+    local_pos_t local_pos = local_pos_at(idx);
     DASH_LOG_TRACE_VAR("GlobIter.GlobPtr >", local_pos.unit);
     DASH_LOG_TRACE_VAR("GlobIter.GlobPtr >", local_pos.index);
     // Create global pointer from unit and local offset:
@@ -162,8 +182,6 @@ public:
    */
   dart_gptr_t dart_gptr() const {
     DASH_LOG_TRACE_VAR("GlobIter.dart_gptr()", _idx);
-    typedef typename pattern_type::local_index_t
-      local_pos_t;
     IndexType idx    = _idx;
     IndexType offset = 0;
     // Convert iterator position (_idx) to local index and unit.
@@ -177,7 +195,7 @@ public:
       DASH_LOG_TRACE_VAR("GlobIter.dart_gptr", offset);
     }
     // Global index to local index and unit:
-    local_pos_t local_pos = _pattern->local(idx);
+    local_pos_t local_pos = local_pos_at(idx);
     DASH_LOG_TRACE("GlobIter.dart_gptr",
                    "unit:",        local_pos.unit,
                    "local index:", local_pos.index);
@@ -198,11 +216,9 @@ public:
    */
   ReferenceType operator*() const {
     DASH_LOG_TRACE("GlobIter.*", _idx);
-    typedef typename pattern_type::local_index_t
-      local_pos_t;
     IndexType idx = _idx;
     // Global index to local index and unit:
-    local_pos_t local_pos = _pattern->local(idx);
+    local_pos_t local_pos = local_pos_at(idx);
     DASH_LOG_TRACE_VAR("GlobIter.*", local_pos.unit);
     DASH_LOG_TRACE_VAR("GlobIter.*", local_pos.index);
     // Global pointer to element at given position:
@@ -222,8 +238,6 @@ public:
     IndexType g_index) const {
     DASH_LOG_TRACE("GlobIter.[]", g_index);
     IndexType idx = g_index;
-    typedef typename pattern_type::local_index_t
-      local_pos_t;
     // Global index to local index and unit:
     local_pos_t local_pos = _pattern->local(idx);
     DASH_LOG_TRACE_VAR("GlobIter.[]", local_pos.unit);
@@ -249,8 +263,6 @@ public:
    */
   ElementType * local() const {
     DASH_LOG_TRACE_VAR("GlobIter.local=()", _idx);
-    typedef typename pattern_type::local_index_t
-      local_pos_t;
     IndexType idx    = _idx;
     IndexType offset = 0;
     DASH_LOG_TRACE_VAR("GlobIter.local=", _max_idx);
@@ -264,7 +276,7 @@ public:
     DASH_LOG_TRACE_VAR("GlobIter.local=", idx);
     DASH_LOG_TRACE_VAR("GlobIter.local=", offset);
     // Global index to local index and unit:
-    local_pos_t local_pos = _pattern->local(idx);
+    local_pos_t local_pos = local_pos_at(idx);
     DASH_LOG_TRACE_VAR("GlobIter.local= >", local_pos.unit);
     DASH_LOG_TRACE_VAR("GlobIter.local= >", local_pos.index);
     if (_myid != local_pos.unit) {
@@ -304,8 +316,6 @@ public:
   inline typename pattern_type::local_index_t lpos() const
   {
     DASH_LOG_TRACE_VAR("GlobIter.lpos()", _idx);
-    typedef typename pattern_type::local_index_t
-      local_pos_t;
     IndexType idx    = _idx;
     IndexType offset = 0;
     // Convert iterator position (_idx) to local index and unit.
@@ -319,7 +329,7 @@ public:
       DASH_LOG_TRACE_VAR("GlobIter.lpos", offset);
     }
     // Global index to local index and unit:
-    local_pos_t local_pos = _pattern->local(idx);
+    local_pos_t local_pos = local_pos_at(idx);
     local_pos.index += offset;
     DASH_LOG_TRACE("GlobIter.lpos >",
                    "unit:",        local_pos.unit,
@@ -405,19 +415,16 @@ public:
 
   self_t operator+(IndexType n) const
   {
-    self_t res(
-      _globmem,
-      *_pattern,
-      _idx + static_cast<IndexType>(n));
+    // Copy retains the cached local range of this iterator:
+    self_t res(*this);
+    res._idx += static_cast<IndexType>(n);
     return res;
   }
 
   self_t operator-(IndexType n) const
   {
-    self_t res(
-      _globmem,
-      *_pattern,
-      _idx - static_cast<IndexType>(n));
+    self_t res(*this);
+    res._idx -= static_cast<IndexType>(n);
     return res;
   }
 
@@ -468,6 +475,65 @@ public:
     return *_pattern;
   }
 
+private:
+  /**
+   * Unit and local offset of the element at the given global index.
+   *
+   * Resolves the position from the cached local range if it contains the
+   * given index, so the pattern only has to be queried when the iterator
+   * crosses the boundary of a block.
+   */
+  inline local_pos_t local_pos_at(IndexType g_index) const
+  {
+    if (g_index < _lrange_gbegin || g_index >= _lrange_gend) {
+      update_local_range(g_index);
+    }
+    local_pos_t local_pos = _lrange_lbegin;
+    local_pos.index      += g_index - _lrange_gbegin;
+    return local_pos;
+  }
+
+  /**
+   * Resolve the range of global indices around the given index that are
+   * contiguous in the local memory of a single unit.
+   *
+   * For patterns with linear layout in blocks, this is the block's extent
+   * in the fastest-changing dimension.
+   */
+  void update_local_range(IndexType g_index) const
+  {
+    DASH_LOG_TRACE_VAR("GlobIter.update_local_range()", g_index);
+    _lrange_lbegin = _pattern->local(g_index);
+    _lrange_gbegin = g_index;
+    _lrange_gend   = g_index + 1;
+    // Dimension in which consecutive global indices are adjacent:
+    const dim_t dim = (PatternType::memory_order() == ROW_MAJOR)
+                      ? PatternType::ndim() - 1
+                      : 0;
+    if (!PatternType::layout_properties::linear ||
+        _pattern->blocksize(dim) < 2) {
+      // No contiguous ranges in local memory or blocks of single
+      // elements, e.g. in cyclic distributions:
+      return;
+    }
+    auto g_coords  = _pattern->coords(g_index);
+    auto block     = _pattern->block(_pattern->block_at(g_coords));
+    // Offset of the element from the block's first element in dimension
+    // dim:
+    IndexType phase     = g_coords[dim] - block.offset(dim);
+    IndexType block_end = std::min<IndexType>(
+                            block.offset(dim) + block.extent(dim),
+                            _pattern->extent(dim));
+    _lrange_gbegin       -= phase;
+    _lrange_lbegin.index -= phase;
+    _lrange_gend          = g_index + (block_end - g_coords[dim]);
+    DASH_LOG_TRACE("GlobIter.update_local_range >",
+                   "unit:",   _lrange_lbegin.unit,
+                   "lbegin:", _lrange_lbegin.index,
+                   "gbegin:", _lrange_gbegin,
+                   "gend:",   _lrange_gend);
+  }
+
 }; // class GlobIter
 
 /**
@@ -6,18 +6,22 @@
 #include <dash/Team.h>
 #include <dash/Onesided.h>
 
+#include <vector>
+
 namespace dash {
 
 namespace internal {
 
 enum class GlobMemKind {
   COLLECTIVE,
-  LOCAL
+  LOCAL,
+  REGISTERED
 };
 
 constexpr GlobMemKind COLLECTIVE { GlobMemKind::COLLECTIVE };
 constexpr GlobMemKind COLL       { GlobMemKind::COLLECTIVE };
 constexpr GlobMemKind LOCAL      { GlobMemKind::LOCAL };
+constexpr GlobMemKind REGISTERED { GlobMemKind::REGISTERED };
 
 } // namespace internal
 
@@ -31,6 +35,9 @@ private:
   internal::GlobMemKind   m_kind;
   ElementType           * m_lbegin;
   ElementType           * m_lend;
+  /// Global pointers to the start of every unit's local memory, indexed
+  /// by unit id relative to the team, with global unit ids resolved.
+  std::vector<dart_gptr_t> m_unit_gptrs;
 
 public:
   /**
@@ -64,6 +71,7 @@ public:
       DART_OK);
     m_lbegin     = lbegin(dash::myid());
     m_lend       = lend(dash::myid());
+    init_unit_gptrs();
   }
 
   /**
@@ -86,6 +94,43 @@ public:
       DART_OK);
     m_lbegin     = lbegin(dash::myid());
     m_lend       = lend(dash::myid());
+    init_unit_gptrs();
+  }
+
+  /**
+   * Constructor, collectively registers memory allocated by the caller
+   * in the global memory of a team.
+   * The number of local elements may differ between units.
+   * Registered memory is not deallocated by the destructor.
+   */
+  GlobMem(
+    /// Team containing all units operating on global memory
+    Team        & team,
+    /// Native pointer to the local memory to register
+    ElementType * lbegin,
+    /// Number of local elements to register
+    size_t        nlelem)
+  {
+    DASH_LOG_TRACE("GlobMem(nunits,lbegin,nelem)", team.size(), nlelem);
+    DASH_ASSERT_GT(nlelem, 0, "Requested to register 0 bytes");
+    m_begptr     = DART_GPTR_NULL;
+    m_teamid     = team.dart_id();
+    m_nlelem     = nlelem;
+    m_kind       = dash::internal::REGISTERED;
+    size_t lsize = sizeof(ElementType) * m_nlelem;
+    DASH_ASSERT_RETURNS(
+      dart_team_size(m_teamid, &m_nunits),
+      DART_OK);
+    DASH_ASSERT_RETURNS(
+      dart_team_memregister_aligned(
+        m_teamid,
+        lsize,
+        lbegin,
+        &m_begptr),
+      DART_OK);
+    m_lbegin     = lbegin;
+    m_lend       = lbegin + m_nlelem;
+    init_unit_gptrs();
   }
 
   /**
@@ -107,6 +152,11 @@ public:
         DASH_ASSERT_RETURNS(
           dart_team_memfree(m_teamid, m_begptr),
           DART_OK);
+      } else if (m_kind == dash::internal::REGISTERED) {
+        DASH_LOG_TRACE_VAR("GlobMem.~GlobMem()", m_teamid);
+        DASH_ASSERT_RETURNS(
+          dart_team_memderegister(m_teamid, m_begptr),
+          DART_OK);
       } else {
         DASH_ASSERT_RETURNS(
           dart_memfree(m_begptr),
@@ -331,40 +381,56 @@ public:
    * local memory.
    */
   template<typename IndexType>
-  dart_gptr_t index_to_gptr(
+  inline dart_gptr_t index_to_gptr(
     /// The unit id
     dart_unit_t unit,
     /// The unit's local address offset
     IndexType local_index) const
   {
-    DASH_LOG_DEBUG("GlobMem.index_to_gptr(unit,l_idx)", unit, local_index);
-    // Initialize with global pointer to start address:
-    dart_gptr_t gptr = m_begptr;
-    // Resolve global unit id
-    dart_unit_t lunit, gunit;
-    DASH_LOG_DEBUG("GlobMem.index_to_gptr (=g_begp)  ", gptr);
-    DASH_LOG_TRACE_VAR("GlobMem.index_to_gptr", gptr.unitid);
-    // Resolve local unit id from global unit id in global pointer:
-    dart_team_unit_g2l(m_teamid, gptr.unitid, &lunit);
-    DASH_LOG_TRACE_VAR("GlobMem.index_to_gptr", lunit);
-    lunit = (lunit + unit) % m_nunits;
-    DASH_LOG_TRACE_VAR("GlobMem.index_to_gptr", lunit);
-    if (m_teamid != dash::Team::All().dart_id()) {
-      // Unit is member of a split team, resolve global unit id:
-      dart_team_unit_l2g(m_teamid, lunit, &gunit);
-    } else {
-      // Unit is member of top level team, no conversion to global unit id
-      // necessary:
-      gunit = lunit;
-    }
-    DASH_LOG_TRACE_VAR("GlobMem.index_to_gptr", gunit);
-    // Apply global unit to global pointer:
-    dart_gptr_setunit(&gptr, gunit);
+    DASH_LOG_TRACE("GlobMem.index_to_gptr(unit,l_idx)", unit, local_index);
+    DASH_ASSERT_RANGE(
+      0, unit, static_cast<dart_unit_t>(m_nunits) - 1,
+      "Unit id out of range in GlobMem.index_to_gptr");
+    // Global pointer to start of the unit's local memory:
+    dart_gptr_t gptr = m_unit_gptrs[unit];
     // Apply local offset to global pointer:
-    dart_gptr_incaddr(&gptr, local_index * sizeof(ElementType));
-    DASH_LOG_DEBUG("GlobMem.index_to_gptr (+g_unit) >", gptr);
+    DART_GPTR_INCADDR(gptr, local_index * sizeof(ElementType));
+    DASH_LOG_TRACE("GlobMem.index_to_gptr >", gptr);
     return gptr;
   }
+
+private:
+  /**
+   * Resolve the global pointers to the start of every unit's local
+   * memory once, so \c index_to_gptr does not have to convert between
+   * team-relative and global unit ids.
+   */
+  void init_unit_gptrs()
+  {
+    DASH_LOG_TRACE("GlobMem.init_unit_gptrs()", m_nunits);
+    m_unit_gptrs.resize(m_nunits, m_begptr);
+    if (m_kind == dash::internal::LOCAL) {
+      // Single unit, start address is allocation start:
+      return;
+    }
+    dart_unit_t lunit_begin;
+    // Resolve local unit id from global unit id in global pointer:
+    DASH_ASSERT_RETURNS(
+      dart_team_unit_g2l(m_teamid, m_begptr.unitid, &lunit_begin),
+      DART_OK);
+    for (size_t unit = 0; unit < m_nunits; ++unit) {
+      dart_unit_t lunit = (lunit_begin + unit) % m_nunits;
+      dart_unit_t gunit = lunit;
+      if (m_teamid != dash::Team::All().dart_id()) {
+        // Unit is member of a split team, resolve global unit id:
+        DASH_ASSERT_RETURNS(
+          dart_team_unit_l2g(m_teamid, lunit, &gunit),
+          DART_OK);
+      }
+      DART_GPTR_SETUNIT(m_unit_gptrs[unit], gunit);
+    }
+    DASH_LOG_TRACE("GlobMem.init_unit_gptrs >");
+  }
 };
 
 template<typename T>
@@ -77,24 +77,15 @@ public:
 
   /**
    * Copy constructor.
+   * Global pointers are trivially copyable, e.g. to be transferred in
+   * collective operations and remote procedure calls.
    */
-  GlobPtr(const self_t & other)
-  : _dart_gptr(other._dart_gptr) {
-    DASH_LOG_TRACE("GlobPtr()", "GlobPtr<T> other");
-  }
+  GlobPtr(const self_t & other)             = default;
 
   /**
    * Assignment operator.
    */
-  self_t & operator=(const self_t & rhs) {
-    DASH_LOG_TRACE("GlobPtr.=()", "GlobPtr<T> rhs");
-    DASH_LOG_TRACE_VAR("GlobPtr.=", rhs);
-    if (this != &rhs) {
-      _dart_gptr = rhs._dart_gptr;
-    }
-    DASH_LOG_TRACE("GlobPtr.= >");
-    return *this;
-  }
+  self_t & operator=(const self_t & rhs)    = default;
 
   /**
    * Converts pointer to its underlying global address.
@@ -123,9 +114,7 @@ public:
    * Prefix increment operator.
    */
   self_t & operator++() {
-    DASH_ASSERT_RETURNS(
-      dart_gptr_incaddr(&_dart_gptr, sizeof(ElementType)),
-      DART_OK);
+    DART_GPTR_INCADDR(_dart_gptr, sizeof(ElementType));
     return *this;
   }
 
@@ -134,9 +123,7 @@ public:
    */
   self_t operator++(int) {
     self_t result = *this;
-    DASH_ASSERT_RETURNS(
-      dart_gptr_incaddr(&_dart_gptr, sizeof(ElementType)),
-      DART_OK);
+    DART_GPTR_INCADDR(_dart_gptr, sizeof(ElementType));
     return result;
   }
 
@@ -145,9 +132,7 @@ public:
    */
   self_t operator+(gptrdiff_t n) const {
     dart_gptr_t gptr = _dart_gptr;
-    DASH_ASSERT_RETURNS(
-      dart_gptr_incaddr(&gptr, n * sizeof(ElementType)),
-      DART_OK);
+    DART_GPTR_INCADDR(gptr, n * sizeof(ElementType));
     return self_t(gptr);
   }
 
@@ -156,9 +141,7 @@ public:
    */
   self_t operator+=(gptrdiff_t n) {
     self_t result = *this;
-    DASH_ASSERT_RETURNS(
-      dart_gptr_incaddr(&_dart_gptr, n * sizeof(ElementType)),
-      DART_OK);
+    DART_GPTR_INCADDR(_dart_gptr, n * sizeof(ElementType));
     return result;
   }
 
@@ -166,9 +149,7 @@ public:
    * Prefix decrement operator.
    */
   self_t & operator--() {
-    DASH_ASSERT_RETURNS(
-      dart_gptr_incaddr(&_dart_gptr, -sizeof(ElementType)),
-      DART_OK);
+    DART_GPTR_INCADDR(_dart_gptr, -sizeof(ElementType));
     return *this;
   }
 
@@ -177,9 +158,7 @@ public:
    */
   self_t operator--(int) {
     self_t result = *this;
-    DASH_ASSERT_RETURNS(
-      dart_gptr_incaddr(&_dart_gptr, -sizeof(ElementType)),
-      DART_OK);
+    DART_GPTR_INCADDR(_dart_gptr, -sizeof(ElementType));
     return result;
   }
 
@@ -198,9 +177,7 @@ public:
    */
   self_t operator-(index_type n) const {
     dart_gptr_t gptr = _dart_gptr;
-    DASH_ASSERT_RETURNS(
-      dart_gptr_incaddr(&gptr, -(n * sizeof(ElementType))),
-      DART_OK);
+    DART_GPTR_INCADDR(gptr, -(n * sizeof(ElementType)));
     return self_t(gptr);
   }
 
@@ -209,9 +186,7 @@ public:
    */
   self_t operator-=(index_type n) {
     self_t result = *this;
-    DASH_ASSERT_RETURNS(
-      dart_gptr_incaddr(&_dart_gptr, -(n * sizeof(ElementType))),
-      DART_OK);
+    DART_GPTR_INCADDR(_dart_gptr, -(n * sizeof(ElementType)));
     return result;
   }
 
@@ -389,9 +364,7 @@ public:
    * Set the global pointer's associated unit.
    */
   void set_unit(dart_unit_t unit_id) {
-    DASH_ASSERT_RETURNS(
-      dart_gptr_setunit(&_dart_gptr, unit_id),
-      DART_OK);
+    DART_GPTR_SETUNIT(_dart_gptr, unit_id);
   }
 
   /**
@@ -3,8 +3,12 @@
 
 #include <dash/GlobMem.h>
 #include <dash/Init.h>
+#include <dash/Types.h>
 #include <dash/algorithm/Operation.h>
 
+#include <functional>
+#include <type_traits>
+
 namespace dash {
 
 // Forward declaration
@@ -130,69 +134,73 @@ public:
     return *this;
   }
 
+  /**
+   * Adds the given value to the referenced element in a single atomic
+   * remote operation that has completed when the operator returns.
+   */
   GlobRef<T> & operator+=(const T& ref) {
-#if 0
-    T add_val = ref;
-    dart_ret_t result = dart_accumulate(
-                          _gptr,
-                          reinterpret_cast<char *>(add_val),
-                          1,
-                          dash::dart_datatype<T>::value,
-                          dash::plus<T>().dart_operation(),
-                          dash::Team::All().dart_id());
-    dart_flush(_gptr);
-#else
-    T val  = operator T();
-    val   += ref;
-    operator=(val);
-#endif
+    update(ref, DART_OP_SUM, std::plus<T>());
     return *this;
   }
 
+  /**
+   * Subtracts the given value from the referenced element in a single
+   * atomic remote operation.
+   */
   GlobRef<T> & operator-=(const T& ref) {
-    T val  = operator T();
-    val   -= ref;
-    operator=(val);
+    // Sums remain exact for unsigned types in modular arithmetic:
+    update(-ref, DART_OP_SUM, std::plus<T>());
     return *this;
   }
 
+  /**
+   * Prefix increment, single atomic remote operation.
+   */
   GlobRef<T> & operator++() {
-    T val = operator T();
-    ++val;
-    operator=(val);
+    update(T(1), DART_OP_SUM, std::plus<T>());
     return *this;
   }
 
-  GlobRef<T> operator++(int) {
-    GlobRef<T> result = *this;
-    T val = operator T();
-    ++val;
-    operator=(val);
-    return result;
+  /**
+   * Postfix increment, single atomic remote operation.
+   *
+   * \returns  The value of the referenced element before the increment
+   */
+  T operator++(int) {
+    return fetch_op(T(1), DART_OP_SUM, std::plus<T>());
   }
 
+  /**
+   * Prefix decrement, single atomic remote operation.
+   */
   GlobRef<T> & operator--() {
-    T val = operator T();
-    --val;
-    operator=(val);
+    update(-T(1), DART_OP_SUM, std::plus<T>());
     return *this;
   }
 
-  GlobRef<T> operator--(int) {
-    GlobRef<T> result = *this;
-    T val = operator T();
-    --val;
-    operator=(val);
-    return result;
+  /**
+   * Postfix decrement, single atomic remote operation.
+   *
+   * \returns  The value of the referenced element before the decrement
+   */
+  T operator--(int) {
+    return fetch_op(-T(1), DART_OP_SUM, std::plus<T>());
   }
 
+  /**
+   * Multiplies the referenced element by the given value in a single
+   * atomic remote operation.
+   */
   GlobRef<T> & operator*=(const T& ref) {
-    T val  = operator T();
-    val   *= ref;
-    operator=(val);
+    update(ref, DART_OP_PROD, std::multiplies<T>());
     return *this;
   }
 
+  /**
+   * Divides the referenced element by the given value.
+   * There is no atomic remote division, the element is read and written
+   * in two blocking operations.
+   */
   GlobRef<T> & operator/=(const T& ref) {
     T val  = operator T();
     val   /= ref;
@@ -200,13 +208,54 @@ public:
     return *this;
   }
 
+  /**
+   * Applies bitwise exclusive or with the given value to the referenced
+   * element in a single atomic remote operation.
+   */
   GlobRef<T> & operator^=(const T& ref) {
-    T val  = operator T();
-    val   ^= ref;
-    operator=(val);
+    update(ref, DART_OP_BXOR, std::bit_xor<T>());
     return *this;
   }
 
+  /**
+   * Adds the given value to the referenced element in a single atomic
+   * remote operation and returns the element's previous value.
+   */
+  T fetch_add(const T& val) {
+    return fetch_op(val, DART_OP_SUM, std::plus<T>());
+  }
+
+  /**
+   * Adds the given value to the referenced element without waiting for
+   * completion of the atomic remote operation at the target.
+   * The update is completed by \c flush or any other flush of the
+   * referenced memory, use for fire-and-forget updates like counters
+   * and histograms.
+   */
+  void add(const T& val) {
+    update_async(val, DART_OP_SUM, std::plus<T>());
+  }
+
+  /**
+   * Subtracts the given value from the referenced element without waiting
+   * for completion of the atomic remote operation at the target.
+   *
+   * \see  add
+   */
+  void sub(const T& val) {
+    update_async(-val, DART_OP_SUM, std::plus<T>());
+  }
+
+  /**
+   * Waits for completion of all updates of the calling unit at the unit
+   * owning the referenced element, e.g. after \c add and \c sub.
+   */
+  void flush() const {
+    DASH_ASSERT_RETURNS(
+      dart_flush(_gptr),
+      DART_OK);
+  }
+
 #if 0
   // Might lead to unintended behaviour
   GlobPtr<T> operator &() {
@@ -262,6 +311,103 @@ public:
     size_t offs = (size_t) &( reinterpret_cast<P*>(0)->*mem);
     return member<MEMTYPE>(offs);
   }
+
+private:
+  /**
+   * DART id of the team that allocated the referenced element.
+   */
+  dart_team_t dart_team() const {
+    dart_team_t team;
+    DASH_ASSERT_RETURNS(
+      dart_gptr_getteam(_gptr, &team),
+      DART_OK);
+    return team;
+  }
+
+  /**
+   * Applies the reduce operation to the referenced element and waits for
+   * its completion.
+   */
+  template<class BinaryOp>
+  void update(const T & val, dart_operation_t op, BinaryOp binary_op) {
+    update_async(val, op, binary_op);
+    flush();
+  }
+
+  /**
+   * Applies the reduce operation to the referenced element in an atomic
+   * accumulate operation that is completed locally only.
+   * Falls back to a non-atomic read and write for element types without
+   * DART data type.
+   */
+  template<class BinaryOp>
+  void update_async(const T & val, dart_operation_t op, BinaryOp binary_op) {
+    update_async(val, op, binary_op,
+                 std::integral_constant<
+                   bool, dash::has_dart_datatype<T>::value>());
+  }
+
+  template<class BinaryOp>
+  void update_async(const T & val, dart_operation_t op, BinaryOp,
+                    std::true_type) {
+    T value = val;
+    DASH_ASSERT_RETURNS(
+      dart_accumulate(
+        _gptr,
+        reinterpret_cast<char *>(&value),
+        1,
+        dash::dart_datatype<T>::value,
+        op,
+        dart_team()),
+      DART_OK);
+    // Value buffer must not go out of scope before local completion:
+    DASH_ASSERT_RETURNS(
+      dart_flush_local(_gptr),
+      DART_OK);
+  }
+
+  template<class BinaryOp>
+  void update_async(const T & val, dart_operation_t, BinaryOp binary_op,
+                    std::false_type) {
+    operator=(binary_op(operator T(), val));
+  }
+
+  /**
+   * Applies the reduce operation to the referenced element in a single
+   * atomic fetch-and-op operation.
+   *
+   * \returns  The value of the referenced element before the operation
+   */
+  template<class BinaryOp>
+  T fetch_op(const T & val, dart_operation_t op, BinaryOp binary_op) {
+    return fetch_op(val, op, binary_op,
+                    std::integral_constant<
+                      bool, dash::has_dart_datatype<T>::value>());
+  }
+
+  template<class BinaryOp>
+  T fetch_op(const T & val, dart_operation_t op, BinaryOp,
+             std::true_type) {
+    T prev;
+    DASH_ASSERT_RETURNS(
+      dart_fetch_and_op(
+        _gptr,
+        &val,
+        &prev,
+        dash::dart_datatype<T>::value,
+        op,
+        dart_team()),
+      DART_OK);
+    return prev;
+  }
+
+  template<class BinaryOp>
+  T fetch_op(const T & val, dart_operation_t, BinaryOp binary_op,
+             std::false_type) {
+    T prev = operator T();
+    operator=(binary_op(prev, val));
+    return prev;
+  }
 };
 
 template<typename T>
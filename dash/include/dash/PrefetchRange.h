@@ -0,0 +1,363 @@
+#ifndef DASH__PREFETCH_RANGE_H__
+#define DASH__PREFETCH_RANGE_H__
+
+#include <dash/GlobIter.h>
+#include <dash/algorithm/LocalRange.h>
+#include <dash/Exception.h>
+#include <dash/internal/Logging.h>
+#include <dash/dart/if/dart_communication.h>
+
+#include <iterator>
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <utility>
+#include <type_traits>
+
+namespace dash {
+
+template<class GlobInputIt>
+class PrefetchRange;
+
+/**
+ * Input iterator on a \c dash::PrefetchRange.
+ *
+ * Dereferences read from the range's local read-ahead buffer.
+ * Advancing the iterator into a block of the buffer that has not been
+ * consumed before waits for completion of the block's pending transfers
+ * and reuses the previously consumed block to fetch the next block of
+ * the range.
+ *
+ * \see dash::prefetch_range
+ */
+template<class GlobInputIt>
+class PrefetchIter
+: public std::iterator<
+           std::input_iterator_tag,
+           typename GlobInputIt::value_type,
+           typename GlobInputIt::index_type,
+           const typename GlobInputIt::value_type *,
+           const typename GlobInputIt::value_type & > {
+private:
+  typedef PrefetchIter<GlobInputIt>                 self_t;
+  typedef PrefetchRange<GlobInputIt>               range_t;
+  typedef typename range_t::state_t                state_t;
+
+public:
+  typedef typename GlobInputIt::value_type      value_type;
+  typedef typename GlobInputIt::index_type      index_type;
+
+public:
+  /**
+   * Default constructor, creates an iterator not associated with a range.
+   */
+  PrefetchIter() = default;
+
+  /**
+   * Constructor, creates an iterator at the given offset in a prefetched
+   * range.
+   */
+  PrefetchIter(
+    state_t    * state,
+    index_type   pos)
+  : _state(state),
+    _pos(pos)
+  {
+    if (_state != nullptr && _pos < _state->size) {
+      acquire();
+    }
+  }
+
+  PrefetchIter(const self_t & other)             = default;
+  self_t & operator=(const self_t & other)       = default;
+
+  inline const value_type & operator*() const
+  {
+    return *_cur;
+  }
+
+  inline const value_type * operator->() const
+  {
+    return _cur;
+  }
+
+  inline self_t & operator++()
+  {
+    ++_pos;
+    if (++_cur == _block_end && _pos < _state->size) {
+      acquire();
+    }
+    return *this;
+  }
+
+  inline self_t operator++(int)
+  {
+    self_t result = *this;
+    ++(*this);
+    return result;
+  }
+
+  inline bool operator==(const self_t & other) const
+  {
+    return _pos == other._pos;
+  }
+
+  inline bool operator!=(const self_t & other) const
+  {
+    return _pos != other._pos;
+  }
+
+  /**
+   * Offset of the iterator in the prefetched range.
+   */
+  inline index_type pos() const
+  {
+    return _pos;
+  }
+
+private:
+  void acquire()
+  {
+    _cur       = _state->acquire(_pos);
+    _block_end = _cur + (_state->block_size - (_pos % _state->block_size));
+  }
+
+private:
+  /// Shared state of the prefetched range
+  state_t          * _state     = nullptr;
+  /// Offset of the iterator in the prefetched range
+  index_type         _pos       = 0;
+  /// Pointer to the referenced element in the read-ahead buffer
+  const value_type * _cur       = nullptr;
+  /// Pointer past the last element in the current block of the buffer
+  const value_type * _block_end = nullptr;
+};
+
+/**
+ * Adapter for a global input range that fetches elements ahead of the
+ * position of its iterators asynchronously into a local ring buffer.
+ *
+ * The buffer is partitioned into blocks. On creation of the range, the
+ * first blocks of the range are requested. Whenever an iterator advances
+ * into the next block, the previously consumed block is reused to request
+ * the elements following the last requested block. Elements in the range
+ * must not be modified while the range is being traversed.
+ *
+ * Iterators on the range are single-pass input iterators.
+ *
+ * \see dash::prefetch_range
+ */
+template<class GlobInputIt>
+class PrefetchRange
+{
+private:
+  typedef PrefetchRange<GlobInputIt>                self_t;
+  typedef typename GlobInputIt::value_type      value_type;
+  typedef typename GlobInputIt::index_type      index_type;
+  typedef typename GlobInputIt::pattern_type  pattern_type;
+  typedef typename pattern_type::size_type       size_type;
+  typedef typename std::decay<
+            decltype(std::declval<GlobInputIt>().global())
+          >::type                                 glob_iter_t;
+
+  friend class PrefetchIter<GlobInputIt>;
+
+  /// Number of blocks in the read-ahead buffer
+  static const index_type NumBlocks = 4;
+
+  struct state_t {
+    /// Global iterator at the first element in the range
+    glob_iter_t                             first;
+    /// Number of elements in the range
+    index_type                              size;
+    /// Number of elements in a block of the read-ahead buffer
+    index_type                              block_size;
+    /// Read-ahead buffer
+    std::vector<value_type>                 buffer;
+    /// Index of the range block held by every block in the buffer,
+    /// -1 for none
+    std::vector<index_type>                 block_index;
+    /// Pending get requests of every block in the buffer
+    std::vector< std::vector<dart_handle_t> > handles;
+
+    /**
+     * Request the elements in the range block with the given index into
+     * its block in the read-ahead buffer.
+     */
+    void fetch(index_type block)
+    {
+      auto buf_block = block % NumBlocks;
+      wait(buf_block);
+      block_index[buf_block] = block;
+      index_type offset      = block * block_size;
+      if (offset >= size) {
+        return;
+      }
+      index_type   nelem     = std::min(block_size, size - offset);
+      value_type * dest      = &buffer[buf_block * block_size];
+      DASH_LOG_TRACE("PrefetchRange.fetch()",
+                     "block:", block, "offset:", offset, "nelem:", nelem);
+      // Issue a single get request for every range of elements that is
+      // contiguous in the local memory of a unit:
+      auto       it          = first + offset;
+      index_type seg_begin   = 0;
+      while (seg_begin < nelem) {
+        index_type seg_nelem = dash::internal::global_run_length(
+                                 it, nelem - seg_begin);
+        dart_handle_t handle;
+        DASH_ASSERT_RETURNS(
+          dart_get_handle(
+            dest + seg_begin,
+            it.dart_gptr(),
+            seg_nelem * sizeof(value_type),
+            &handle),
+          DART_OK);
+        if (handle != NULL) {
+          handles[buf_block].push_back(handle);
+        }
+        seg_begin += seg_nelem;
+        it        += seg_nelem;
+      }
+    }
+
+    /**
+     * Wait for local completion of pending get requests of the block in
+     * the read-ahead buffer with the given index.
+     */
+    void wait(index_type buf_block)
+    {
+      auto & block_handles = handles[buf_block];
+      if (block_handles.size() == 0) {
+        return;
+      }
+      if (dart_waitall_local(&block_handles[0], block_handles.size())
+          != DART_OK) {
+        DASH_THROW(
+          dash::exception::RuntimeError,
+          "dash::PrefetchRange: dart_waitall_local failed");
+      }
+      block_handles.clear();
+    }
+
+    /**
+     * Pointer to the element at the given offset in the read-ahead buffer,
+     * waiting for completion of its transfer. Reuses the buffer block
+     * preceding the element's block to prefetch the next range block.
+     */
+    const value_type * acquire(index_type pos)
+    {
+      index_type block     = pos / block_size;
+      index_type buf_block = block % NumBlocks;
+      if (block_index[buf_block] != block) {
+        // Iterator is not in the read-ahead window, e.g. after an
+        // iterator has been copied:
+        fetch(block);
+      }
+      wait(buf_block);
+      if (block > 0) {
+        auto next_block = block + NumBlocks - 1;
+        if (block_index[next_block % NumBlocks] != next_block) {
+          fetch(next_block);
+        }
+      }
+      return &buffer[buf_block * block_size + (pos % block_size)];
+    }
+
+    ~state_t()
+    {
+      for (index_type b = 0; b < NumBlocks; ++b) {
+        wait(b);
+      }
+    }
+  };
+
+public:
+  typedef PrefetchIter<GlobInputIt>                iterator;
+  typedef PrefetchIter<GlobInputIt>          const_iterator;
+
+public:
+  /**
+   * Constructor, creates a range prefetching the elements in the global
+   * range \c [first,last) and requests the first \c window elements.
+   */
+  PrefetchRange(
+    /// Iterator at the first element in the global range
+    const GlobInputIt & first,
+    /// Iterator past the last element in the global range
+    const GlobInputIt & last,
+    /// Maximum number of elements fetched ahead of the position of an
+    /// iterator
+    size_type           window)
+  : _state(new state_t())
+  {
+    DASH_LOG_TRACE("PrefetchRange()", "window:", window);
+    _state->first      = first.global();
+    _state->size       = dash::distance(first, last);
+    _state->block_size = std::max<index_type>(
+                           1, (window + NumBlocks - 1) / NumBlocks);
+    _state->buffer.resize(_state->block_size * NumBlocks);
+    _state->block_index.resize(NumBlocks, -1);
+    _state->handles.resize(NumBlocks);
+    for (index_type b = 0; b < NumBlocks; ++b) {
+      _state->fetch(b);
+    }
+  }
+
+  iterator begin() const
+  {
+    return iterator(_state.get(), 0);
+  }
+
+  iterator end() const
+  {
+    return iterator(_state.get(), _state->size);
+  }
+
+  /**
+   * Number of elements in the range.
+   */
+  index_type size() const
+  {
+    return _state->size;
+  }
+
+private:
+  std::unique_ptr<state_t> _state;
+};
+
+/**
+ * Adapts the global range \c [first,last) to a range with single-pass
+ * input iterators that read elements from a local buffer which is filled
+ * asynchronously ahead of the iterators' position.
+ *
+ * Sequential traversal of remote elements then is not limited by the
+ * latency of a blocking transfer per element.
+ *
+ * Example:
+ *
+ * \code
+ *     double sum = 0;
+ *     for (double value : dash::prefetch_range(
+ *                           array.begin(), array.end(), 4096)) {
+ *       sum += value;
+ *     }
+ * \endcode
+ *
+ * \returns  Range of input iterators on elements in \c [first,last)
+ */
+template<class GlobInputIt>
+PrefetchRange<GlobInputIt> prefetch_range(
+  /// Iterator at the first element in the global range
+  const GlobInputIt & first,
+  /// Iterator past the last element in the global range
+  const GlobInputIt & last,
+  /// Maximum number of elements fetched ahead of the position of an
+  /// iterator
+  typename GlobInputIt::pattern_type::size_type window = 4096)
+{
+  return PrefetchRange<GlobInputIt>(first, last, window);
+}
+
+} // namespace dash
+
+#endif // DASH__PREFETCH_RANGE_H__
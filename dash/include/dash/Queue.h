@@ -0,0 +1,486 @@
+#ifndef DASH__QUEUE_H__INCLUDED
+#define DASH__QUEUE_H__INCLUDED
+
+#include <dash/GlobMem.h>
+#include <dash/Team.h>
+#include <dash/Types.h>
+#include <dash/Exception.h>
+#include <dash/internal/Logging.h>
+#include <dash/dart/if/dart.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace dash {
+
+/**
+ * A distributed work queue of elements, e.g. tasks in irregular
+ * workloads.
+ *
+ * The queue consists of one bounded ring of elements in global memory
+ * per unit. Elements are enqueued at the tail of the ring of any unit
+ * and dequeued at the head of the local ring first, if it is empty they
+ * are stolen from the rings of other units. The order of elements is
+ * FIFO in every ring, there is no global order.
+ *
+ * Operations do not use locks:
+ *
+ * - Ranges of ring positions are reserved by atomic compare-and-swap on
+ *   the head or tail counter of a ring.
+ * - A sequence number of every slot in a ring signals when an enqueued
+ *   element has been written and when a dequeued element has been read.
+ *
+ * Bulk operations on ranges of elements reserve all positions in the
+ * range in a single atomic operation.
+ *
+ * Counters and sequence numbers are 32 bit values in modular arithmetic
+ * as atomic operations on 64 bit values are not supported by all MPI
+ * implementations, ring capacities are rounded up to a power of two.
+ *
+ * Example:
+ * \code
+ *     dash::Queue<task_t> tasks(1024);
+ *     tasks.push(initial_tasks.data(),
+ *                initial_tasks.data() + initial_tasks.size());
+ *     tasks.barrier();
+ *     task_t task;
+ *     while (tasks.pop(task)) {
+ *       process(task, tasks);
+ *     }
+ * \endcode
+ *
+ * \tparam  ElementType  Trivially copyable element type
+ */
+template<typename ElementType>
+class Queue
+{
+private:
+  typedef Queue<ElementType> self_t;
+  /// Ring position modulo 2^32
+  typedef uint32_t           position_t;
+  /// Difference of ring positions
+  typedef int32_t            distance_t;
+
+  enum counter_index : int {
+    HEAD = 0,
+    TAIL = 1
+  };
+
+public:
+  typedef ElementType                                             value_type;
+  typedef size_t                                                   size_type;
+
+public:
+  /**
+   * Constructor, allocates a ring of at least the given capacity at every
+   * unit. Collective operation.
+   */
+  Queue(
+    /// Number of elements in the ring of every unit
+    size_type    lcapacity,
+    /// Team containing all units operating on the queue
+    dash::Team & team = dash::Team::All())
+  : _team(&team),
+    _myid(team.myid()),
+    _nunits(team.size()),
+    _lcapacity(round_capacity(lcapacity)),
+    _ring(team, _lcapacity),
+    _seqs(team, _lcapacity),
+    _counters(team, 2)
+  {
+    DASH_LOG_DEBUG("Queue.Queue(lcap,team)", lcapacity);
+    // Slot at position p is free for an enqueue of p if its sequence
+    // number is p:
+    position_t * seqs = _seqs.lbegin();
+    for (size_type i = 0; i < _lcapacity; ++i) {
+      seqs[i] = i;
+    }
+    _counters.lbegin()[HEAD] = 0;
+    _counters.lbegin()[TAIL] = 0;
+    _team->barrier();
+  }
+
+  Queue(const self_t & other) = delete;
+  self_t & operator=(const self_t & other) = delete;
+
+  ~Queue()
+  {
+    if (dash::is_initialized()) {
+      _team->barrier();
+    }
+  }
+
+  /**
+   * Enqueues an element in the ring of the calling unit.
+   *
+   * \return  false if the ring is full
+   */
+  bool push(const value_type & value)
+  {
+    return push(&value, &value + 1, _myid) == 1;
+  }
+
+  /**
+   * Enqueues a range of elements in the ring of the specified unit.
+   * Elements that do not fit into the ring are not enqueued.
+   *
+   * \return  Number of enqueued elements, always the first elements in
+   *          the range
+   */
+  size_type push(
+    const value_type * first,
+    const value_type * last,
+    /// Unit in the queue's team owning the ring
+    dart_unit_t        unit)
+  {
+    size_type  n   = last - first;
+    position_t pos = 0;
+    size_type  k   = reserve(unit, TAIL, n, &pos);
+    if (k == 0) {
+      return 0;
+    }
+    DASH_LOG_TRACE("Queue.push()", "unit:", unit, "pos:", pos, "n:", k);
+    // Wait for dequeues of the previous round of the slots to complete:
+    wait_seqs(unit, pos, k, 0);
+    for_each_slot_range(pos, k, [&](size_type slot, size_type nslots,
+                                    size_type offset) {
+      DASH_ASSERT_RETURNS(
+        dart_put_blocking(
+          _ring.index_to_gptr(unit, slot),
+          first + offset,
+          nslots * sizeof(value_type)),
+        DART_OK);
+    });
+    // Elements have been written, publish them to dequeues:
+    add_seqs(unit, pos, k, 1);
+    return k;
+  }
+
+  /**
+   * Dequeues an element from the ring of the calling unit, or steals an
+   * element from the ring of another unit if the local ring is empty.
+   *
+   * \return  false if no element has been found in any ring
+   */
+  bool pop(value_type & value)
+  {
+    return pop(&value, &value + 1) == 1;
+  }
+
+  /**
+   * Dequeues up to the given number of elements from the ring of the
+   * calling unit, or steals elements from the ring of another unit if
+   * the local ring is empty.
+   * Rings of other units are visited in round-robin order.
+   *
+   * \return  Number of dequeued elements
+   */
+  size_type pop(
+    value_type * out_first,
+    value_type * out_last)
+  {
+    size_type n = pop_from(_myid, out_first, out_last);
+    for (size_type i = 1; n == 0 && i < _nunits; ++i) {
+      dart_unit_t victim = (_myid + i) % _nunits;
+      n = pop_from(victim, out_first, out_last);
+    }
+    return n;
+  }
+
+  /**
+   * Dequeues up to the given number of elements from the ring of the
+   * specified unit.
+   *
+   * \return  Number of dequeued elements
+   */
+  size_type pop_from(
+    /// Unit in the queue's team owning the ring
+    dart_unit_t  unit,
+    value_type * out_first,
+    value_type * out_last)
+  {
+    size_type  n   = out_last - out_first;
+    position_t pos = 0;
+    size_type  k   = reserve(unit, HEAD, n, &pos);
+    if (k == 0) {
+      return 0;
+    }
+    DASH_LOG_TRACE("Queue.pop_from()", "unit:", unit, "pos:", pos, "n:", k);
+    // Wait for enqueues of the slots to complete:
+    wait_seqs(unit, pos, k, 1);
+    for_each_slot_range(pos, k, [&](size_type slot, size_type nslots,
+                                    size_type offset) {
+      DASH_ASSERT_RETURNS(
+        dart_get_blocking(
+          out_first + offset,
+          _ring.index_to_gptr(unit, slot),
+          nslots * sizeof(value_type)),
+        DART_OK);
+    });
+    // Elements have been read, release slots to enqueues of the next
+    // round:
+    add_seqs(unit, pos, k, _lcapacity - 1);
+    return k;
+  }
+
+  /**
+   * Number of elements in the ring of the specified unit.
+   */
+  size_type lsize(dart_unit_t unit) const
+  {
+    position_t head = load_counter(unit, HEAD);
+    position_t tail = load_counter(unit, TAIL);
+    return std::max<distance_t>(static_cast<distance_t>(tail - head), 0);
+  }
+
+  /**
+   * Number of elements in the ring of the calling unit.
+   */
+  inline size_type lsize() const
+  {
+    return lsize(_myid);
+  }
+
+  /**
+   * Number of elements in the rings of all units. Not exact while
+   * elements are enqueued or dequeued concurrently.
+   */
+  size_type size() const
+  {
+    size_type size = 0;
+    for (size_type u = 0; u < _nunits; ++u) {
+      size += lsize(u);
+    }
+    return size;
+  }
+
+  inline bool empty() const
+  {
+    return size() == 0;
+  }
+
+  /**
+   * Number of elements that can be stored in the ring of every unit.
+   */
+  inline size_type lcapacity() const noexcept
+  {
+    return _lcapacity;
+  }
+
+  inline size_type capacity() const noexcept
+  {
+    return _lcapacity * _nunits;
+  }
+
+  inline dash::Team & team() const noexcept
+  {
+    return *_team;
+  }
+
+  /**
+   * Establish a barrier for all units operating on the queue.
+   * As all operations are blocking, elements enqueued before the barrier
+   * are visible to all units after the barrier.
+   */
+  void barrier() const
+  {
+    _team->barrier();
+  }
+
+private:
+  static size_type round_capacity(size_type lcapacity)
+  {
+    DASH_ASSERT_RANGE(
+      1, lcapacity, size_type(1) << 30,
+      "Invalid capacity of dash::Queue");
+    size_type capacity = 1;
+    while (capacity < lcapacity) {
+      capacity <<= 1;
+    }
+    return capacity;
+  }
+
+  position_t load_counter(dart_unit_t unit, counter_index counter) const
+  {
+    position_t noop = 0;
+    position_t value;
+    DASH_ASSERT_RETURNS(
+      dart_fetch_and_op(
+        _counters.index_to_gptr(unit, counter),
+        &noop,
+        &value,
+        DART_TYPE_UINT,
+        DART_OP_NO_OP,
+        _team->dart_id()),
+      DART_OK);
+    return value;
+  }
+
+  /**
+   * Reserves up to \c n positions at the head or tail of a ring.
+   * Enqueues are limited by the free capacity, dequeues by the number of
+   * enqueued elements in the ring.
+   * Counters only increase, so limits computed from a previous value of
+   * the opposite counter are conservative, limits computed from a
+   * previous value of the reserved counter are discarded as the
+   * compare-and-swap fails.
+   *
+   * \return  Number of reserved positions, starting at \c pos
+   */
+  size_type reserve(
+    dart_unit_t     unit,
+    counter_index   counter,
+    size_type       n,
+    position_t    * pos)
+  {
+    if (n == 0) {
+      return 0;
+    }
+    dart_gptr_t gptr = _counters.index_to_gptr(unit, counter);
+    position_t  cur  = load_counter(unit, counter);
+    for (;;) {
+      position_t other = load_counter(unit, counter == HEAD ? TAIL : HEAD);
+      distance_t used  = static_cast<distance_t>(
+                           counter == HEAD ? other - cur : cur - other);
+      if (used < 0) {
+        // Counter has advanced past the value of the other counter:
+        cur = load_counter(unit, counter);
+        continue;
+      }
+      distance_t avail = (counter == HEAD)
+                         ? used
+                         : static_cast<distance_t>(_lcapacity) - used;
+      if (avail <= 0) {
+        return 0;
+      }
+      position_t k    = std::min<size_type>(n, avail);
+      position_t next = cur + k;
+      position_t prev;
+      DASH_ASSERT_RETURNS(
+        dart_compare_and_swap(
+          gptr,
+          &next,
+          &cur,
+          &prev,
+          DART_TYPE_UINT,
+          _team->dart_id()),
+        DART_OK);
+      if (prev == cur) {
+        *pos = cur;
+        return k;
+      }
+      // Concurrent reservation, retry from the current counter value:
+      cur = prev;
+    }
+  }
+
+  /**
+   * Calls \c func for the contiguous slot ranges of \c n positions
+   * starting at \c pos, at most two ranges if positions wrap around at
+   * the end of the ring.
+   */
+  template<class SlotRangeFunc>
+  void for_each_slot_range(
+    position_t    pos,
+    size_type     n,
+    SlotRangeFunc func) const
+  {
+    size_type slot   = pos & (_lcapacity - 1);
+    size_type nfirst = std::min(n, _lcapacity - slot);
+    func(slot, nfirst, 0);
+    if (nfirst < n) {
+      func(0, n - nfirst, nfirst);
+    }
+  }
+
+  /**
+   * Polls the sequence numbers of the slots of \c n positions starting
+   * at \c pos until every slot at position \c p has sequence number
+   * \c p + \c offset.
+   * A slot's sequence number is only updated by the unit that reserved
+   * its position, which happened before.
+   */
+  void wait_seqs(
+    dart_unit_t unit,
+    position_t  pos,
+    size_type   n,
+    position_t  offset)
+  {
+    // Sequence numbers are read atomically as they are concurrently
+    // updated by atomic accumulates:
+    for (size_type i = 0; i < n; ++i) {
+      position_t p    = pos + i;
+      size_type  slot = p & (_lcapacity - 1);
+      while (load_seq(unit, slot) != static_cast<position_t>(p + offset)) { }
+    }
+  }
+
+  /**
+   * Reads the sequence number of a slot in the ring of the specified
+   * unit, atomic operation.
+   */
+  position_t load_seq(dart_unit_t unit, size_type slot) const
+  {
+    position_t noop = 0;
+    position_t value;
+    DASH_ASSERT_RETURNS(
+      dart_fetch_and_op(
+        _seqs.index_to_gptr(unit, slot),
+        &noop,
+        &value,
+        DART_TYPE_UINT,
+        DART_OP_NO_OP,
+        _team->dart_id()),
+      DART_OK);
+    return value;
+  }
+
+  /**
+   * Atomically adds a value to the sequence numbers of the slots of \c n
+   * positions starting at \c pos.
+   */
+  void add_seqs(
+    dart_unit_t unit,
+    position_t  pos,
+    size_type   n,
+    position_t  value)
+  {
+    std::vector<position_t> values(std::min(n, _lcapacity), value);
+    for_each_slot_range(pos, n, [&](size_type slot, size_type nslots,
+                                    size_type) {
+      DASH_ASSERT_RETURNS(
+        dart_accumulate(
+          _seqs.index_to_gptr(unit, slot),
+          reinterpret_cast<char *>(values.data()),
+          nslots,
+          DART_TYPE_UINT,
+          DART_OP_SUM,
+          _team->dart_id()),
+        DART_OK);
+    });
+    DASH_ASSERT_RETURNS(
+      dart_flush(_seqs.index_to_gptr(unit, 0)),
+      DART_OK);
+  }
+
+private:
+  /// Team containing all units operating on the queue
+  dash::Team                  * _team;
+  /// Id of the active unit in the team
+  dart_unit_t                   _myid;
+  /// Number of units in the team
+  size_type                     _nunits;
+  /// Number of elements in the ring of every unit
+  size_type                     _lcapacity;
+  /// Ring of elements at every unit
+  dash::GlobMem<value_type>     _ring;
+  /// Sequence numbers of the slots in the ring of every unit
+  dash::GlobMem<position_t>     _seqs;
+  /// Head and tail counter of the ring of every unit
+  dash::GlobMem<position_t>     _counters;
+};
+
+} // namespace dash
+
+#endif // DASH__QUEUE_H__INCLUDED
@@ -0,0 +1,411 @@
+#ifndef DASH__RPC_H__INCLUDED
+#define DASH__RPC_H__INCLUDED
+
+#include <dash/dart/if/dart.h>
+
+#include <dash/Future.h>
+#include <dash/Exception.h>
+#include <dash/internal/Logging.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <typeinfo>
+#include <vector>
+
+namespace dash {
+
+namespace internal {
+
+/**
+ * Function invoking a remote procedure with arguments read from the
+ * payload of an active message.
+ */
+typedef void (*rpc_invoke_t)(
+  dart_unit_t  source,
+  const char * args,
+  uint64_t     reply_token);
+
+/**
+ * Header of a remote procedure call message, followed by the call's
+ * arguments.
+ */
+typedef struct {
+  /// Key of the procedure in the registry of remote procedures
+  uint64_t key;
+  /// Token identifying the reply at the calling unit, 0 if the caller
+  /// does not expect a reply
+  uint64_t reply_token;
+} rpc_header_t;
+
+/**
+ * Reply of a remote procedure call.
+ */
+typedef struct {
+  /// Whether the reply has arrived
+  bool              ready;
+  /// Return value of the remote procedure
+  std::vector<char> value;
+} rpc_reply_t;
+
+/**
+ * Registers the DART active message handlers of remote procedure calls,
+ * called in \c dash::init.
+ * Remote procedure calls are disabled if the DART implementation does
+ * not support active messages.
+ */
+void rpc_init();
+
+/**
+ * Completes remote procedure calls if any unit has issued a call since
+ * \c dash::init, called in \c dash::finalize.
+ * Collective operation, synchronizes all units.
+ */
+void rpc_finalize();
+
+/**
+ * Adds a remote procedure to the registry, called in static
+ * initialization.
+ */
+bool rpc_register(
+  uint64_t     key,
+  rpc_invoke_t invoke);
+
+/**
+ * Function registered as remote procedure with the given key, or
+ * \c nullptr if no procedure has been registered with the key.
+ */
+rpc_invoke_t rpc_lookup(
+  uint64_t     key);
+
+/**
+ * Sends a remote procedure call message to a unit.
+ */
+void rpc_send(
+  dart_unit_t  unit,
+  const char * msg,
+  size_t       nbytes);
+
+/**
+ * Sends the return value of a remote procedure to the calling unit.
+ */
+void rpc_send_reply(
+  dart_unit_t  unit,
+  uint64_t     reply_token,
+  const void * value,
+  size_t       nbytes);
+
+/**
+ * Creates a token identifying the reply of a remote procedure call.
+ */
+uint64_t rpc_expect_reply(
+  const std::shared_ptr<rpc_reply_t> & reply);
+
+/**
+ * Processes active messages until the reply of a call to the given unit
+ * has arrived.
+ */
+void rpc_wait_reply(
+  dart_unit_t         unit,
+  const rpc_reply_t & reply);
+
+/**
+ * Key of a remote procedure, FNV-1a hash of its type name.
+ * Type names and therefore keys are identical at all units running the
+ * same program.
+ */
+inline uint64_t rpc_key(const char * name)
+{
+  uint64_t hash = 14695981039346656037ULL;
+  for (; *name != '\0'; ++name) {
+    hash ^= static_cast<unsigned char>(*name);
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+/**
+ * Size of packed arguments in bytes.
+ */
+template<typename... Ts>
+struct rpc_args_size;
+
+template<>
+struct rpc_args_size<>
+{
+  static const size_t value = 0;
+};
+
+template<typename T, typename... Ts>
+struct rpc_args_size<T, Ts...>
+{
+  static const size_t value = sizeof(T) + rpc_args_size<Ts...>::value;
+};
+
+/**
+ * Whether all argument types can be copied bytewise to a message.
+ */
+template<typename... Ts>
+struct rpc_args_trivially_copyable;
+
+template<>
+struct rpc_args_trivially_copyable<>
+{
+  static const bool value = true;
+};
+
+template<typename T, typename... Ts>
+struct rpc_args_trivially_copyable<T, Ts...>
+{
+  static const bool value =
+    std::is_trivially_copyable<T>::value &&
+    rpc_args_trivially_copyable<Ts...>::value;
+};
+
+inline void rpc_pack(char *)
+{ }
+
+/**
+ * Copies arguments to a message buffer without padding.
+ */
+template<typename T, typename... Ts>
+void rpc_pack(char * buf, const T & arg, const Ts & ... args)
+{
+  std::memcpy(buf, &arg, sizeof(T));
+  rpc_pack(buf + sizeof(T), args...);
+}
+
+/**
+ * Reads packed arguments of types \c Ts from a message buffer and invokes
+ * a function object with them.
+ */
+template<typename R, typename... Ts>
+struct rpc_unpack;
+
+template<typename R>
+struct rpc_unpack<R>
+{
+  template<class F, typename... Vs>
+  static R call(F & func, const char *, Vs & ... values)
+  {
+    return func(values...);
+  }
+};
+
+template<typename R, typename T, typename... Ts>
+struct rpc_unpack<R, T, Ts...>
+{
+  template<class F, typename... Vs>
+  static R call(F & func, const char * buf, Vs & ... values)
+  {
+    // Arguments are trivially copyable but not necessarily
+    // default-constructible, e.g. lambdas:
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+    std::memcpy(&storage, buf, sizeof(T));
+    T & value = *reinterpret_cast<T *>(&storage);
+    return rpc_unpack<R, Ts...>::call(func, buf + sizeof(T),
+                                      values..., value);
+  }
+};
+
+/**
+ * Remote procedure defined by function object type \c F called with
+ * arguments of types \c Args.
+ * Every procedure instantiated in the program is registered in static
+ * initialization, so it can be invoked at every unit.
+ */
+template<class F, typename... Args>
+struct rpc_procedure
+{
+  typedef rpc_procedure<F, Args...>                          self_t;
+  typedef typename std::result_of<F(Args & ...)>::type       result_t;
+
+  static_assert(rpc_args_trivially_copyable<Args...>::value,
+                "arguments of remote procedures must be trivially copyable");
+  static_assert(std::is_void<result_t>::value ||
+                std::is_trivially_copyable<result_t>::value,
+                "results of remote procedures must be trivially copyable");
+
+  /// Whether the procedure has been registered
+  static const bool registered;
+
+  static uint64_t key()
+  {
+    static const uint64_t proc_key = rpc_key(typeid(self_t).name());
+    return proc_key;
+  }
+
+  /**
+   * Builds the message of a call and sends it to the given unit.
+   */
+  static void send(
+    dart_unit_t       unit,
+    uint64_t          reply_token,
+    const Args & ...  args)
+  {
+    static_cast<void>(registered);
+    char msg[sizeof(rpc_header_t) + rpc_args_size<Args...>::value];
+    rpc_header_t header;
+    header.key         = key();
+    header.reply_token = reply_token;
+    std::memcpy(msg, &header, sizeof(rpc_header_t));
+    rpc_pack(msg + sizeof(rpc_header_t), args...);
+    rpc_send(unit, msg, sizeof(msg));
+  }
+
+  static void invoke(
+    dart_unit_t  source,
+    const char * args,
+    uint64_t     reply_token)
+  {
+    invoke(source, args, reply_token, std::is_void<result_t>());
+  }
+
+private:
+  static void invoke(
+    dart_unit_t  source,
+    const char * args,
+    uint64_t     reply_token,
+    std::true_type)
+  {
+    F func;
+    rpc_unpack<result_t, Args...>::call(func, args);
+    if (reply_token != 0) {
+      rpc_send_reply(source, reply_token, nullptr, 0);
+    }
+  }
+
+  static void invoke(
+    dart_unit_t  source,
+    const char * args,
+    uint64_t     reply_token,
+    std::false_type)
+  {
+    F func;
+    result_t result = rpc_unpack<result_t, Args...>::call(func, args);
+    if (reply_token != 0) {
+      rpc_send_reply(source, reply_token, &result, sizeof(result_t));
+    }
+  }
+};
+
+template<class F, typename... Args>
+const bool rpc_procedure<F, Args...>::registered =
+  rpc_register(rpc_procedure<F, Args...>::key(),
+               &rpc_procedure<F, Args...>::invoke);
+
+} // namespace internal
+
+/**
+ * Invokes a procedure at a remote unit without waiting for its
+ * completion (remote procedure call).
+ *
+ * The procedure is a default-constructible function object type \c F
+ * which is instantiated and invoked with the given arguments at the
+ * target unit, e.g. to apply an update to the target's local memory.
+ * Arguments are copied bytewise and must be trivially copyable, pointers
+ * are only valid if they refer to memory at the target unit.
+ *
+ * Calls are sent as active messages: calls to the same unit are
+ * aggregated and delivered in batches, and are executed in the order
+ * they have been issued when the target unit polls for incoming calls in
+ * \c dash::rpc_progress or \c dash::rpc_fence.
+ *
+ * Example:
+ * \code
+ *     // Global array, allocated after dash::init:
+ *     dash::Array<long> table;
+ *
+ *     struct xor_update {
+ *       void operator()(long lidx, long value) {
+ *         table.local[lidx] ^= value;
+ *       }
+ *     };
+ *     // Ship random updates to their owners:
+ *     for (auto i = 0; i < num_updates; ++i) {
+ *       auto gidx  = random_index();
+ *       auto l_pos = table.pattern().local(gidx);
+ *       dash::rpc<xor_update>(l_pos.unit, l_pos.index, gidx);
+ *     }
+ *     // Wait until all updates have been applied:
+ *     dash::rpc_fence();
+ * \endcode
+ *
+ * \tparam  F  Function object type of the remote procedure, must be
+ *             used with identical argument types at all units
+ */
+template<class F, typename... Args>
+void rpc(
+  /// Target unit, relative to \c dash::Team::All()
+  dart_unit_t       unit,
+  /// Arguments of the call
+  const Args & ...  args)
+{
+  typedef internal::rpc_procedure<F, typename std::decay<Args>::type...>
+    procedure_t;
+  procedure_t::send(unit, 0, args...);
+}
+
+/**
+ * Invokes a function at a remote unit and returns a future of its
+ * result, see \c dash::rpc.
+ * The call is sent when waiting for the future's result, waiting
+ * processes incoming calls until the reply has arrived.
+ *
+ * \tparam  F  Function object type of the remote procedure with a
+ *             trivially copyable, non-void result type
+ */
+template<class F, typename... Args>
+dash::Future<
+  typename internal::rpc_procedure<
+    F, typename std::decay<Args>::type...>::result_t >
+rpc_async(
+  /// Target unit, relative to \c dash::Team::All()
+  dart_unit_t       unit,
+  /// Arguments of the call
+  const Args & ...  args)
+{
+  typedef internal::rpc_procedure<F, typename std::decay<Args>::type...>
+    procedure_t;
+  typedef typename procedure_t::result_t result_t;
+  static_assert(!std::is_void<result_t>::value,
+                "dash::rpc_async requires a procedure with a result, "
+                "use dash::rpc and dash::rpc_fence instead");
+  auto reply = std::make_shared<internal::rpc_reply_t>();
+  reply->ready = false;
+  procedure_t::send(unit, internal::rpc_expect_reply(reply), args...);
+  return dash::Future<result_t>(
+           [=]() {
+             internal::rpc_wait_reply(unit, *reply);
+             result_t result;
+             std::memcpy(&result, reply->value.data(), sizeof(result_t));
+             return result;
+           });
+}
+
+/**
+ * Sends all buffered remote procedure calls.
+ */
+void rpc_flush();
+
+/**
+ * Executes remote procedure calls that have arrived at the calling unit,
+ * does not block.
+ *
+ * \returns  Number of executed calls
+ */
+size_t rpc_progress();
+
+/**
+ * Blocks until all remote procedure calls issued by any unit before
+ * entering the call have been executed, including calls issued by
+ * remote procedures in the meantime.
+ * Collective operation on \c dash::Team::All().
+ */
+void rpc_fence();
+
+} // namespace dash
+
+#endif // DASH__RPC_H__INCLUDED
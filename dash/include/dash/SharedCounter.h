@@ -1,73 +1,221 @@
 #ifndef DASH__SHARED_COUNTER_H_
 #define DASH__SHARED_COUNTER_H_
 
-#include <dash/Array.h>
+#include <dash/GlobMem.h>
+#include <dash/Team.h>
+#include <dash/Types.h>
+#include <dash/Exception.h>
+#include <dash/internal/Logging.h>
+#include <dash/dart/if/dart_communication.h>
+
+#include <type_traits>
 
 namespace dash {
 
 /**
- * A simple shared counter that allows atomic increment-
- * and decrement operations.
+ * A shared counter that allows atomic increment- and decrement
+ * operations, e.g. to hand out tickets in dynamic load balancing.
+ *
+ * The counter value is stored at a single home location at unit 0 of
+ * the team and updated with atomic one-sided operations. Units also keep
+ * track of their own contributions and the last counter value they
+ * observed:
  *
- * TODO: Should probably be based on MPI_ACCUMULATE.
+ * - \c inc, \c dec and \c fetch_add are atomic remote operations at the
+ *   home location, independent of the number of units.
+ * - \c get_approx returns the last observed value plus local
+ *   contributions since and does not communicate.
+ * - \c get and \c load read the home location atomically, \c load also
+ *   records the value as the last observed value.
+ * - \c get_collective is collective and sums the contributions of all
+ *   units in a single reduction.
+ *
+ * \tparam  ValueType  Integral counter type with a corresponding DART
+ *                     data type, see \c dash::dart_datatype
  */
 template<typename ValueType = int>
 class SharedCounter {
+  static_assert(dash::has_dart_datatype<ValueType>::value,
+                "SharedCounter value type has no DART data type");
 private:
   typedef SharedCounter<ValueType> self_t;
 
 public:
   /**
-   * Constructor.
+   * Constructor, collective operation.
    */
-  SharedCounter()
-  : _num_units(dash::Team::All().size()),
-    _myid(dash::Team::All().myid()),
-    _local_counts(_num_units) {
-    _local_counts[_myid] = 0;
+  SharedCounter(
+    /// Team of units interacting with the counter
+    Team & team = dash::Team::All())
+  : _team(&team),
+    _home_mem(team, 1)
+  {
+    _home_gptr = _home_mem.index_to_gptr(0, 0);
+    *_home_mem.lbegin(team.myid()) = 0;
+    team.barrier();
   }
 
+  SharedCounter(const self_t & other) = delete;
+  self_t & operator=(const self_t & other) = delete;
+
   /**
    * Increment the shared counter value, atomic operation.
+   *
+   * \complexity  O(1)
    */
   void inc(
     /// Increment value
     ValueType increment) {
-    _local_counts[_myid] += increment;
+    accumulate(increment);
+    _contrib  += increment;
+    _unseen   += increment;
   }
 
   /**
    * Decrement the shared counter value, atomic operation.
+   *
+   * \complexity  O(1)
    */
   void dec(
     /// Decrement value
+    ValueType decrement) {
+    // Sums remain exact for unsigned value types in modular arithmetic:
+    inc(-decrement);
+  }
+
+  /**
+   * Increment the shared counter value and return its previous value,
+   * atomic operation.
+   * Concurrent calls of all units receive distinct values.
+   *
+   * \complexity  O(1)
+   */
+  ValueType fetch_add(
+    /// Increment value
     ValueType increment) {
-    _local_counts[_myid] -= increment;
+    ValueType prev;
+    DASH_ASSERT_RETURNS(
+      dart_fetch_and_op(
+        _home_gptr,
+        &increment,
+        &prev,
+        dash::dart_datatype<ValueType>::value,
+        DART_OP_SUM,
+        _team->dart_id()),
+      DART_OK);
+    _contrib  += increment;
+    _observed  = prev + increment;
+    _unseen    = 0;
+    return prev;
+  }
+
+  /**
+   * Read the current value of the shared counter from its home location,
+   * atomic operation.
+   *
+   * \complexity  O(1)
+   */
+  ValueType load() {
+    ValueType value = read_home();
+    _observed = value;
+    _unseen   = 0;
+    return value;
+  }
+
+  /**
+   * Approximate value of the shared counter: the value last observed by
+   * the calling unit in \c fetch_add, \c load or \c get_collective, plus
+   * increments
+   * of the calling unit since.
+   * Does not include increments of other units since the last
+   * observation.
+   *
+   * \complexity  O(1), no communication
+   */
+  ValueType get_approx() const {
+    return _observed + _unseen;
   }
 
   /**
    * Read the current value of the shared counter.
-   * Accumulates increment/decrement values of every unit.
-   * Reading a shared is not atomic, use Team::barrier() to synchronize.
+   * Not collective, includes all increments/decrements completed before
+   * the call. Use Team::barrier() to synchronize with updates of other
+   * units.
    *
-   * \complexity  O(u) for \c u units in the associated team
+   * \complexity  O(1)
    */
   ValueType get() const {
-    // TODO: std::accumulate should work, too
+    return read_home();
+  }
+
+  /**
+   * Read the exact value of the shared counter.
+   * Collective operation, accumulates increment/decrement values of every
+   * unit in a single reduction. Includes all updates every unit issued
+   * before entering the call.
+   *
+   * \complexity  O(log u) for \c u units in the associated team
+   */
+  ValueType get_collective() {
     ValueType acc = 0;
-    for (size_t i = 0; i < _num_units; ++i) {
-      acc += _local_counts[i];
-    }
+    DASH_ASSERT_RETURNS(
+      dart_allreduce(
+        &_contrib,
+        &acc,
+        1,
+        dash::dart_datatype<ValueType>::value,
+        DART_OP_SUM,
+        _team->dart_id()),
+      DART_OK);
+    _observed = acc;
+    _unseen   = 0;
     return acc;
   }
 
 private:
-  /// The number of units interacting with the counter
-  size_t                 _num_units;
-  /// The DART id of the unit that created this local counter intance
-  dart_unit_t            _myid;
-  /// Buffer containing counter increments/decrements of every unit
-  dash::Array<ValueType> _local_counts;
+  ValueType read_home() const {
+    ValueType noop  = 0;
+    ValueType value;
+    DASH_ASSERT_RETURNS(
+      dart_fetch_and_op(
+        _home_gptr,
+        &noop,
+        &value,
+        dash::dart_datatype<ValueType>::value,
+        DART_OP_NO_OP,
+        _team->dart_id()),
+      DART_OK);
+    return value;
+  }
+
+  void accumulate(ValueType value) {
+    DASH_ASSERT_RETURNS(
+      dart_accumulate(
+        _home_gptr,
+        reinterpret_cast<char *>(&value),
+        1,
+        dash::dart_datatype<ValueType>::value,
+        DART_OP_SUM,
+        _team->dart_id()),
+      DART_OK);
+    DASH_ASSERT_RETURNS(
+      dart_flush(_home_gptr),
+      DART_OK);
+  }
+
+private:
+  /// Team of units interacting with the counter
+  Team                  * _team;
+  /// Counter value at unit 0
+  dash::GlobMem<ValueType> _home_mem;
+  /// Global pointer to the counter value
+  dart_gptr_t             _home_gptr;
+  /// Sum of increments/decrements of the calling unit
+  ValueType               _contrib  = 0;
+  /// Counter value last observed by the calling unit
+  ValueType               _observed = 0;
+  /// Increments of the calling unit since the last observation
+  ValueType               _unseen   = 0;
 };
 
 } // namespace dash
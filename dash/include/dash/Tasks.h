@@ -0,0 +1,315 @@
+#ifndef DASH__TASKS_H__INCLUDED
+#define DASH__TASKS_H__INCLUDED
+
+#include <dash/dart/if/dart.h>
+
+#include <dash/GlobPtr.h>
+#include <dash/RPC.h>
+#include <dash/Exception.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+/**
+ * Task-parallel execution of irregular workloads.
+ *
+ * Tasks are created in \c dash::tasks::async and
+ * \c dash::tasks::async_stealable and executed when all units call
+ * \c dash::tasks::complete, which returns when all tasks created in the
+ * team of all units have been executed, including tasks created by
+ * tasks.
+ *
+ * Scheduling:
+ *
+ * - Every thread of a unit has a deque of ready tasks. A thread executes
+ *   the tasks it created in LIFO order and steals the oldest tasks from
+ *   the deques of other threads of its unit if its deque is empty.
+ * - Stealable tasks are published as task descriptors in a
+ *   \c dash::Queue at their unit while only few descriptors are
+ *   published there, otherwise they are executed locally. Descriptors are
+ *   dequeued by their unit first, idle units steal descriptors from the
+ *   queues of other units in one-sided operations.
+ * - Termination is detected by a \c dash::SharedCounter of created and
+ *   completed tasks in the team.
+ *
+ * Threads are only used with OpenMP support (\c DASH_ENABLE_OPENMP),
+ * otherwise tasks are executed by the calling thread.
+ * DART is initialized without multi-threading support: only the master
+ * thread communicates, in the scheduler. Tasks are executed by any thread
+ * and must only access local memory.
+ *
+ * Example:
+ * \code
+ *     struct integrate {
+ *       void operator()(double a, double b, double fa, double fb) {
+ *         double m  = 0.5 * (a + b);
+ *         double fm = f(m);
+ *         if (converged(a, b, fa, fb, fm)) {
+ *           local_sum(fm * (b - a));
+ *         } else {
+ *           dash::tasks::async_stealable<integrate>(a, m, fa, fm);
+ *           dash::tasks::async_stealable<integrate>(m, b, fm, fb);
+ *         }
+ *       }
+ *     };
+ *     if (dash::myid() == 0) {
+ *       dash::tasks::async_stealable<integrate>(0.0, 1.0, f(0.0), f(1.0));
+ *     }
+ *     dash::tasks::complete();
+ * \endcode
+ */
+
+namespace dash {
+namespace tasks {
+
+/**
+ * Access to a range of global memory at a single unit declared by a
+ * task, see \c dash::tasks::in and \c dash::tasks::out.
+ */
+typedef struct {
+  /// Whether the task writes to the range
+  bool        write;
+  /// Unit owning the range
+  dart_unit_t unit;
+  /// Segment of the range
+  int16_t     segid;
+  /// Offset of the first byte in the range
+  uint64_t    begin;
+  /// Offset past the last byte in the range
+  uint64_t    end;
+} dependency;
+
+/**
+ * Events reported to the trace hook, see \c dash::tasks::set_trace_hook.
+ */
+enum class trace_event : int {
+  /// A thread starts executing a task
+  task_begin = 0,
+  /// A thread has executed a task
+  task_end,
+  /// A thread has stolen a task from the deque of another thread
+  thread_steal,
+  /// The unit has stolen task descriptors from another unit
+  remote_steal,
+  /// The unit has failed to steal task descriptors from another unit
+  remote_steal_failed
+};
+
+/**
+ * Trace hook, called with the event, the thread of the unit reporting the
+ * event, and the thread or unit the task has been stolen from or -1.
+ * The hook is called concurrently by all threads of the unit.
+ */
+typedef std::function<void(trace_event, int, int)> trace_hook_t;
+
+/**
+ * Counts of scheduling events at the calling unit.
+ */
+typedef struct {
+  /// Tasks executed
+  size_t executed;
+  /// Task descriptors published to other units
+  size_t published;
+  /// Tasks stolen from the deques of other threads
+  size_t thread_steals;
+  /// Attempts to steal task descriptors from other units
+  size_t remote_steal_attempts;
+  /// Successful attempts to steal task descriptors from other units
+  size_t remote_steals;
+  /// Task descriptors stolen from other units
+  size_t remote_tasks_stolen;
+} statistics_t;
+
+namespace internal {
+
+typedef std::function<void()> task_func_t;
+
+/**
+ * Maximum size of the packed arguments of a stealable task.
+ */
+constexpr size_t MaxStealableArgsSize = 48;
+
+/**
+ * Descriptor of a stealable task: the action registered as remote
+ * procedure and its packed arguments.
+ */
+typedef struct {
+  /// Key of the action in the registry of remote procedures
+  uint64_t    key;
+  /// Unit that has created the task
+  dart_unit_t source;
+  /// Packed arguments
+  char        args[MaxStealableArgsSize];
+} task_descriptor_t;
+
+/**
+ * Creates a task at the calling thread, executed when all tasks it
+ * depends on have been executed.
+ */
+void spawn(
+  task_func_t      && func,
+  const dependency  * deps,
+  size_t              ndeps);
+
+/**
+ * Creates a stealable task, its descriptor is published at the calling
+ * unit in the next scheduling step.
+ */
+void spawn_stealable(
+  const task_descriptor_t & desc);
+
+dependency make_dependency(
+  bool        write,
+  dart_gptr_t first,
+  dart_gptr_t last);
+
+} // namespace internal
+
+/**
+ * Read access of a task to the range \c [first, last) of global memory,
+ * the range must be located at a single unit.
+ * The task is executed after all tasks created before it at the calling
+ * unit that write to an overlapping range.
+ */
+template<typename T, class PatternT>
+dependency in(
+  const GlobPtr<T, PatternT> & first,
+  const GlobPtr<T, PatternT> & last)
+{
+  return internal::make_dependency(
+           false, first.dart_gptr(), last.dart_gptr());
+}
+
+/**
+ * Read access of a task to a single element in global memory.
+ */
+template<typename T, class PatternT>
+dependency in(
+  const GlobPtr<T, PatternT> & ptr)
+{
+  return in(ptr, ptr + 1);
+}
+
+/**
+ * Write access of a task to the range \c [first, last) of global memory,
+ * the range must be located at a single unit.
+ * The task is executed after all tasks created before it at the calling
+ * unit that read from or write to an overlapping range.
+ */
+template<typename T, class PatternT>
+dependency out(
+  const GlobPtr<T, PatternT> & first,
+  const GlobPtr<T, PatternT> & last)
+{
+  return internal::make_dependency(
+           true, first.dart_gptr(), last.dart_gptr());
+}
+
+/**
+ * Write access of a task to a single element in global memory.
+ */
+template<typename T, class PatternT>
+dependency out(
+  const GlobPtr<T, PatternT> & ptr)
+{
+  return out(ptr, ptr + 1);
+}
+
+/**
+ * Creates a task executing the given function object at the calling
+ * unit.
+ */
+template<class F>
+void async(
+  F && func)
+{
+  internal::spawn(internal::task_func_t(std::forward<F>(func)),
+                  nullptr, 0);
+}
+
+/**
+ * Creates a task executing the given function object at the calling unit
+ * after the tasks it depends on, see \c dash::tasks::in and
+ * \c dash::tasks::out.
+ */
+template<class F, class... Deps>
+void async(
+  F                && func,
+  const dependency  & dep,
+  const Deps      & ... deps)
+{
+  const dependency task_deps[] = { dep, deps... };
+  internal::spawn(internal::task_func_t(std::forward<F>(func)),
+                  task_deps, 1 + sizeof...(Deps));
+}
+
+/**
+ * Creates a task that can be stolen by other units.
+ *
+ * The task is a default-constructible function object type \c F which is
+ * instantiated and invoked with the given arguments at the unit executing
+ * the task, like remote procedures in \c dash::rpc.
+ * Arguments are copied bytewise and must be trivially copyable.
+ * Stealable tasks cannot declare dependencies.
+ *
+ * \tparam  F  Function object type of the task, must be used with
+ *             identical argument types at all units
+ */
+template<class F, typename... Args>
+void async_stealable(
+  const Args & ... args)
+{
+  typedef dash::internal::rpc_procedure<
+            F, typename std::decay<Args>::type...> procedure_t;
+  static_assert(
+    dash::internal::rpc_args_trivially_copyable<
+      typename std::decay<Args>::type...>::value,
+    "arguments of stealable tasks must be trivially copyable");
+  static_assert(
+    dash::internal::rpc_args_size<
+      typename std::decay<Args>::type...>::value
+      <= internal::MaxStealableArgsSize,
+    "arguments of stealable tasks exceed MaxStealableArgsSize");
+  static_cast<void>(procedure_t::registered);
+  internal::task_descriptor_t desc;
+  desc.key = procedure_t::key();
+  dash::internal::rpc_pack(desc.args, args...);
+  internal::spawn_stealable(desc);
+}
+
+/**
+ * Executes all tasks in the team of all units and waits for their
+ * completion. Collective operation.
+ */
+void complete();
+
+/**
+ * Number of threads executing tasks at the calling unit.
+ */
+int num_threads();
+
+/**
+ * Sets the hook called on scheduling events, an empty function disables
+ * tracing. Must not be called while tasks are executed.
+ */
+void set_trace_hook(
+  trace_hook_t hook);
+
+/**
+ * Counts of scheduling events at the calling unit since the last call of
+ * \c dash::tasks::reset_statistics.
+ */
+statistics_t statistics();
+
+/**
+ * Resets the counts of scheduling events at the calling unit.
+ */
+void reset_statistics();
+
+} // namespace tasks
+} // namespace dash
+
+#endif // DASH__TASKS_H__INCLUDED
@@ -2,6 +2,7 @@
 #define DASH__TYPES_H_
 
 #include <array>
+#include <type_traits>
 #include <dash/dart/if/dart_types.h>
 
 namespace dash {
@@ -69,6 +70,26 @@ struct dart_datatype<int> {
   static const dart_datatype_t value;
 };
 
+template<>
+struct dart_datatype<unsigned int> {
+  static const dart_datatype_t value;
+};
+
+template<>
+struct dart_datatype<long> {
+  static const dart_datatype_t value;
+};
+
+template<>
+struct dart_datatype<unsigned long> {
+  static const dart_datatype_t value;
+};
+
+template<>
+struct dart_datatype<long long> {
+  static const dart_datatype_t value;
+};
+
 template<>
 struct dart_datatype<float> {
   static const dart_datatype_t value;
@@ -79,6 +100,21 @@ struct dart_datatype<double> {
   static const dart_datatype_t value;
 };
 
+/**
+ * Type trait indicating whether a type is mapped to a DART data type in
+ * \c dash::dart_datatype.
+ */
+template< typename Type >
+struct has_dart_datatype : public std::false_type { };
+
+template<> struct has_dart_datatype<int>           : std::true_type { };
+template<> struct has_dart_datatype<unsigned int>  : std::true_type { };
+template<> struct has_dart_datatype<long>          : std::true_type { };
+template<> struct has_dart_datatype<unsigned long> : std::true_type { };
+template<> struct has_dart_datatype<long long>     : std::true_type { };
+template<> struct has_dart_datatype<float>         : std::true_type { };
+template<> struct has_dart_datatype<double>        : std::true_type { };
+
 } // namespace dash
 
 #endif // DASH__TYPES_H_
@@ -0,0 +1,805 @@
+#ifndef DASH__UNORDERED_MAP_H__INCLUDED
+#define DASH__UNORDERED_MAP_H__INCLUDED
+
+#include <dash/GlobMem.h>
+#include <dash/Team.h>
+#include <dash/Types.h>
+#include <dash/Future.h>
+#include <dash/RPC.h>
+#include <dash/Exception.h>
+#include <dash/internal/Logging.h>
+#include <dash/dart/if/dart.h>
+
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace dash {
+
+namespace internal {
+
+/**
+ * Bucket of an open-addressed hash table.
+ */
+template<typename ValueType>
+struct unordered_map_bucket
+{
+  /// Key and mapped value, only constructed in occupied buckets
+  ValueType value;
+  /// Whether the bucket is occupied
+  uint32_t  occupied;
+};
+
+/**
+ * Finalizer of 64-bit hash values, distributes hash values of identity
+ * hash functions like \c std::hash<int> to all bits.
+ */
+inline uint64_t hash_mix(uint64_t h)
+{
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdULL;
+  h ^= h >> 33;
+  h *= 0xc4ceb9fe1a85ec53ULL;
+  h ^= h >> 33;
+  return h;
+}
+
+} // namespace internal
+
+/**
+ * A distributed hash map of keys to values.
+ *
+ * Elements are partitioned to units by the hash values of their keys.
+ * Every unit stores its elements in a local open-addressed hash table
+ * with linear probing, allocated in global memory.
+ *
+ * - Inserts and updates are applied by the owner of an element: batches
+ *   of elements are shipped to their owners as remote procedure calls,
+ *   aggregated per owner unit, see \c dash::rpc.
+ * - Lookups read the probe sequences of keys in the owners' tables with
+ *   non-blocking one-sided operations.
+ * - Local elements are iterated and accessed in local memory, see
+ *   \c local.
+ *
+ * Lookups must not overlap with inserts or updates of the same elements,
+ * e.g. phases of inserts and lookups are separated by a barrier after
+ * the futures of all inserts have completed.
+ *
+ * Elements are stored at all units: pending inserts and updates are
+ * completed in \c dash::rpc_fence, which synchronizes all units.
+ *
+ * The number of buckets is fixed, inserts of elements into a full local
+ * table fail. The number of buckets can be changed in the collective
+ * operation \c rehash.
+ *
+ * Example:
+ * \code
+ *     dash::UnorderedMap<long, double> map(num_keys * 2);
+ *     std::vector< std::pair<long, double> > elements = read_input();
+ *     map.insert(elements.begin(), elements.end()).wait();
+ *     map.barrier();
+ *     std::vector<double> values(keys.size());
+ *     std::unique_ptr<bool[]> found(new bool[keys.size()]);
+ *     map.find(keys.begin(), keys.end(), values.data(), found.get());
+ * \endcode
+ *
+ * \tparam  Key     Key type, trivially copyable
+ * \tparam  Mapped  Mapped value type, trivially copyable
+ * \tparam  Hash    Hash function object type, must yield identical
+ *                  hash values at all units
+ */
+template<
+  typename Key,
+  typename Mapped,
+  class    Hash = std::hash<Key> >
+class UnorderedMap
+{
+private:
+  typedef UnorderedMap<Key, Mapped, Hash>              self_t;
+
+public:
+  typedef Key                                          key_type;
+  typedef Mapped                                       mapped_type;
+  typedef std::pair<const Key, Mapped>                 value_type;
+  typedef Hash                                         hasher;
+  typedef size_t                                       size_type;
+
+private:
+  typedef internal::unordered_map_bucket<value_type>   bucket_t;
+
+  /// Result of an insert or update in a local table
+  enum upsert_result_t {
+    UPSERT_FAILED   = 0,
+    UPSERT_INSERTED = 1,
+    UPSERT_UPDATED  = 2
+  };
+
+  /**
+   * Operation keeping the value of an existing element on insert.
+   */
+  struct keep_existing {
+    mapped_type operator()(
+      const mapped_type & lhs,
+      const mapped_type &) const {
+      return lhs;
+    }
+  };
+
+  /**
+   * Remote procedure inserting an element at its owner.
+   */
+  struct insert_procedure {
+    void operator()(
+      uint32_t      map_id,
+      dart_unit_t   source,
+      key_type      key,
+      mapped_type   mapped,
+      keep_existing op) {
+      auto map = self_t::instance(map_id);
+      if (map->local_upsert(key, mapped, false, op) == UPSERT_INSERTED) {
+        map->_applied_from[source]++;
+      }
+    }
+  };
+
+  /**
+   * Remote procedure inserting an element at its owner, or combining its
+   * value with the existing element using the caller's operation.
+   */
+  template<class BinaryOperation>
+  struct update_procedure {
+    void operator()(
+      uint32_t        map_id,
+      dart_unit_t     source,
+      key_type        key,
+      mapped_type     mapped,
+      BinaryOperation op) {
+      auto map = self_t::instance(map_id);
+      if (map->local_upsert(key, mapped, true, op) != UPSERT_FAILED) {
+        map->_applied_from[source]++;
+      }
+    }
+  };
+
+  /**
+   * Remote procedure returning the number of elements of a unit that
+   * have been applied at the owner since the last call.
+   */
+  struct sync_procedure {
+    size_type operator()(
+      uint32_t    map_id,
+      dart_unit_t source) {
+      auto      map         = self_t::instance(map_id);
+      size_type num_applied = map->_applied_from[source];
+      map->_applied_from[source] = 0;
+      return num_applied;
+    }
+  };
+
+public:
+  /**
+   * Iterator on the elements in a unit's local table.
+   */
+  class local_iterator
+    : public std::iterator<std::forward_iterator_tag, value_type>
+  {
+  public:
+    local_iterator(bucket_t * pos, bucket_t * end)
+    : _pos(pos),
+      _end(end)
+    {
+      skip_empty();
+    }
+
+    value_type & operator*() const
+    {
+      return _pos->value;
+    }
+
+    value_type * operator->() const
+    {
+      return &(_pos->value);
+    }
+
+    local_iterator & operator++()
+    {
+      ++_pos;
+      skip_empty();
+      return *this;
+    }
+
+    local_iterator operator++(int)
+    {
+      local_iterator result = *this;
+      ++(*this);
+      return result;
+    }
+
+    bool operator==(const local_iterator & other) const
+    {
+      return _pos == other._pos;
+    }
+
+    bool operator!=(const local_iterator & other) const
+    {
+      return _pos != other._pos;
+    }
+
+  private:
+    void skip_empty()
+    {
+      while (_pos != _end && !_pos->occupied) {
+        ++_pos;
+      }
+    }
+
+  private:
+    bucket_t * _pos;
+    bucket_t * _end;
+  };
+
+  /**
+   * Proxy object representing the elements stored at the calling unit.
+   */
+  class local_type
+  {
+  public:
+    local_type(self_t * map)
+    : _map(map)
+    { }
+
+    local_iterator begin() const
+    {
+      return local_iterator(_map->_lbuckets,
+                            _map->_lbuckets + _map->_lcapacity);
+    }
+
+    local_iterator end() const
+    {
+      return local_iterator(_map->_lbuckets + _map->_lcapacity,
+                            _map->_lbuckets + _map->_lcapacity);
+    }
+
+    /**
+     * Number of elements stored at the calling unit.
+     */
+    size_type size() const
+    {
+      return _map->_lsize;
+    }
+
+    /**
+     * Iterator to the local element with the given key, or \c end() if
+     * the element does not exist or is not owned by the calling unit.
+     */
+    local_iterator find(const key_type & key) const
+    {
+      auto pos = _map->local_position(key);
+      if (pos < 0) {
+        return end();
+      }
+      return local_iterator(_map->_lbuckets + pos,
+                            _map->_lbuckets + _map->_lcapacity);
+    }
+
+  private:
+    self_t * _map;
+  };
+
+public:
+  /// Elements stored at the calling unit
+  local_type local;
+
+public:
+  /**
+   * Constructor, collective operation.
+   * Maps of the same type must be constructed in the same order at all
+   * units.
+   */
+  UnorderedMap(
+    /// Total number of buckets, the number of elements that can be stored
+    /// with uniformly distributed hash values
+    size_type nbuckets)
+  : local(this),
+    _team(&dash::Team::All()),
+    _nunits(_team->size()),
+    _myid(_team->myid()),
+    _applied_from(_team->size(), 0)
+  {
+    Team & team = *_team;
+    DASH_LOG_DEBUG("UnorderedMap(nbuckets)", nbuckets, team.size());
+    _id = next_id();
+    instances()[_id] = this;
+    for (size_type u = 0; u < _nunits; ++u) {
+      _global_units.push_back(team.global_id(u));
+    }
+    allocate(local_capacity(nbuckets));
+    team.barrier();
+    DASH_LOG_DEBUG("UnorderedMap >", _lcapacity);
+  }
+
+  UnorderedMap(const self_t & other) = delete;
+  self_t & operator=(const self_t & other) = delete;
+
+  /**
+   * Destructor, collective operation.
+   * Completes pending inserts and updates.
+   */
+  ~UnorderedMap()
+  {
+    if (dash::is_initialized()) {
+      dash::rpc_fence();
+    }
+    instances().erase(_id);
+  }
+
+  /**
+   * The team containing all units storing the map's elements, always
+   * \c dash::Team::All().
+   */
+  Team & team() const
+  {
+    return *_team;
+  }
+
+  /**
+   * Unit owning the element with the given key, relative to the map's
+   * team.
+   */
+  dart_unit_t unit_of(const key_type & key) const
+  {
+    return static_cast<dart_unit_t>(hash_of(key) % _nunits);
+  }
+
+  /**
+   * Total number of elements, collective operation.
+   */
+  size_type size() const
+  {
+    size_type lsize = _lsize;
+    size_type size  = 0;
+    DASH_ASSERT_RETURNS(
+      dart_allreduce(
+        &lsize,
+        &size,
+        1,
+        dash::dart_datatype<size_type>::value,
+        DART_OP_SUM,
+        _team->dart_id()),
+      DART_OK);
+    return size;
+  }
+
+  /**
+   * Total number of buckets.
+   */
+  size_type bucket_count() const
+  {
+    return _lcapacity * _nunits;
+  }
+
+  /**
+   * Inserts the elements in the range \c [first, last) if their keys do
+   * not exist, elements with existing keys are not modified.
+   *
+   * Local elements are inserted immediately, remote elements are sent to
+   * their owners in aggregated remote procedure calls.
+   *
+   * \returns  Future of the number of inserted elements, elements have
+   *           been inserted at their owners once the future has completed
+   */
+  template<class InputIt>
+  dash::Future<size_type> insert(
+    /// Iterator to the initial element to insert, referencing values of
+    /// type \c value_type
+    InputIt first,
+    /// Iterator past the final element to insert
+    InputIt last)
+  {
+    DASH_LOG_DEBUG("UnorderedMap.insert(first,last)");
+    return apply_batch<insert_procedure>(
+             first, last, false, keep_existing());
+  }
+
+  /**
+   * Inserts a single element if its key does not exist.
+   *
+   * \returns  \c true if the element has been inserted
+   */
+  bool insert(const value_type & value)
+  {
+    return insert(&value, &value + 1).get() == 1;
+  }
+
+  /**
+   * Inserts the elements in the range \c [first, last), values of
+   * elements with existing keys are combined with the new values using
+   * the given operation at the elements' owners, e.g. to count
+   * occurrences of keys with \c dash::plus.
+   *
+   * \tparam   BinaryOperation  Trivially copyable function object type of
+   *                            signature <tt>Mapped(Mapped, Mapped)</tt>
+   *                            invoked with the existing and the new
+   *                            value. The operation is sent to the owners
+   *                            of remote elements with every element.
+   * \returns  Future of the number of inserted or updated elements
+   */
+  template<class InputIt, class BinaryOperation>
+  dash::Future<size_type> insert_or_update(
+    /// Iterator to the initial element, referencing values of type
+    /// \c value_type
+    InputIt         first,
+    /// Iterator past the final element
+    InputIt         last,
+    /// Operation combining existing and new values
+    BinaryOperation op)
+  {
+    static_assert(
+      std::is_trivially_copyable<BinaryOperation>::value,
+      "dash::UnorderedMap::insert_or_update requires a trivially "
+      "copyable operation");
+    DASH_LOG_DEBUG("UnorderedMap.insert_or_update(first,last,op)");
+    return apply_batch< update_procedure<BinaryOperation> >(
+             first, last, true, op);
+  }
+
+  /**
+   * Looks up the values of the keys in the range \c [first, last).
+   *
+   * Probe sequences of keys in remote tables are read in rounds of
+   * non-blocking one-sided operations, local keys are looked up in local
+   * memory.
+   *
+   * \returns  Number of keys found
+   */
+  template<class KeyIt>
+  size_type find(
+    /// Iterator to the initial key to look up
+    KeyIt         first,
+    /// Iterator past the final key to look up
+    KeyIt         last,
+    /// Output range of values, \c values[i] is assigned if key \c i has
+    /// been found
+    mapped_type * values,
+    /// Output range of flags, \c found[i] is \c true if key \c i has been
+    /// found
+    bool        * found) const
+  {
+    DASH_LOG_DEBUG("UnorderedMap.find(first,last)");
+    // Remote lookup: key position and current probe offset
+    typedef std::pair<size_type, size_type> lookup_t;
+    std::vector<key_type> keys(first, last);
+    std::vector<lookup_t> lookups;
+    size_type num_found = 0;
+    for (size_type k = 0; k < keys.size(); ++k) {
+      found[k] = false;
+      if (unit_of(keys[k]) == _myid) {
+        auto pos = local_position(keys[k]);
+        if (pos >= 0) {
+          values[k] = _lbuckets[pos].value.second;
+          found[k]  = true;
+          ++num_found;
+        }
+      } else {
+        lookups.push_back(lookup_t(k, 0));
+      }
+    }
+    std::vector<bucket_t>      windows(lookups.size() * FindWindowSize);
+    std::vector<size_type>     window_sizes(lookups.size());
+    std::vector<dart_handle_t> handles;
+    handles.reserve(lookups.size());
+    while (!lookups.empty()) {
+      // Read the next window of every probe sequence:
+      handles.clear();
+      for (size_type l = 0; l < lookups.size(); ++l) {
+        auto & key   = keys[lookups[l].first];
+        auto   start = (home_bucket(key) + lookups[l].second) & _lmask;
+        // Windows do not wrap around the end of the table:
+        auto   nread = std::min<size_type>(FindWindowSize,
+                                           _lcapacity - start);
+        nread        = std::min<size_type>(nread,
+                                           _lcapacity - lookups[l].second);
+        window_sizes[l] = nread;
+        dart_handle_t handle;
+        DASH_ASSERT_RETURNS(
+          dart_get_handle(
+            &windows[l * FindWindowSize],
+            _globmem->index_to_gptr(unit_of(key), start),
+            nread * sizeof(bucket_t),
+            &handle),
+          DART_OK);
+        handles.push_back(handle);
+      }
+      DASH_ASSERT_RETURNS(
+        dart_waitall_local(handles.data(), handles.size()),
+        DART_OK);
+      // Keep lookups that did not reach the key or an empty bucket:
+      size_type num_pending = 0;
+      for (size_type l = 0; l < lookups.size(); ++l) {
+        auto   k        = lookups[l].first;
+        bool   finished = false;
+        for (size_type b = 0; b < window_sizes[l]; ++b) {
+          auto & bucket = windows[l * FindWindowSize + b];
+          if (!bucket.occupied) {
+            finished = true;
+            break;
+          }
+          if (bucket.value.first == keys[k]) {
+            values[k] = bucket.value.second;
+            found[k]  = true;
+            finished  = true;
+            ++num_found;
+            break;
+          }
+        }
+        lookups[l].second += window_sizes[l];
+        if (!finished && lookups[l].second < _lcapacity) {
+          lookups[num_pending++] = lookups[l];
+        }
+      }
+      lookups.resize(num_pending);
+    }
+    return num_found;
+  }
+
+  /**
+   * Looks up the value of a single key.
+   *
+   * \returns  \c true if the key has been found
+   */
+  bool find(const key_type & key, mapped_type & value) const
+  {
+    bool found;
+    find(&key, &key + 1, &value, &found);
+    return found;
+  }
+
+  /**
+   * Changes the number of buckets, collective operation.
+   * Completes pending inserts and updates of all units.
+   */
+  void rehash(
+    /// Total number of buckets
+    size_type nbuckets)
+  {
+    DASH_LOG_DEBUG("UnorderedMap.rehash(nbuckets)", nbuckets);
+    dash::rpc_fence();
+    auto lcapacity = local_capacity(nbuckets);
+    // All units allocate the same number of buckets:
+    size_type lsize_max = 0;
+    DASH_ASSERT_RETURNS(
+      dart_allreduce(
+        &_lsize,
+        &lsize_max,
+        1,
+        dash::dart_datatype<size_type>::value,
+        DART_OP_MAX,
+        _team->dart_id()),
+      DART_OK);
+    while (lcapacity < lsize_max) {
+      lcapacity *= 2;
+    }
+    auto old_globmem = std::move(_globmem);
+    auto old_buckets = _lbuckets;
+    auto old_lcap    = _lcapacity;
+    allocate(lcapacity);
+    for (size_type b = 0; b < old_lcap; ++b) {
+      if (old_buckets[b].occupied) {
+        local_upsert(old_buckets[b].value.first,
+                     old_buckets[b].value.second,
+                     false,
+                     keep_existing());
+        old_buckets[b].value.~value_type();
+      }
+    }
+    old_globmem.reset();
+    _team->barrier();
+  }
+
+  /**
+   * Completes pending inserts and updates of all units and synchronizes
+   * all units in the map's team, collective operation.
+   */
+  void barrier()
+  {
+    dash::rpc_fence();
+    _team->barrier();
+  }
+
+private:
+  /// Number of buckets read in a single one-sided operation of a lookup
+  static const size_type FindWindowSize = 4;
+
+  static std::unordered_map<uint32_t, self_t *> & instances()
+  {
+    static std::unordered_map<uint32_t, self_t *> maps;
+    return maps;
+  }
+
+  static self_t * instance(uint32_t map_id)
+  {
+    return instances()[map_id];
+  }
+
+  static uint32_t next_id()
+  {
+    static uint32_t last_id = 0;
+    return ++last_id;
+  }
+
+  /**
+   * Number of local buckets, the smallest power of two not less than the
+   * share of every unit in the given total number of buckets.
+   */
+  size_type local_capacity(size_type nbuckets) const
+  {
+    size_type lcapacity = 1;
+    while (lcapacity * _nunits < nbuckets) {
+      lcapacity *= 2;
+    }
+    return lcapacity;
+  }
+
+  void allocate(size_type lcapacity)
+  {
+    _lcapacity = lcapacity;
+    _lmask     = lcapacity - 1;
+    _lsize     = 0;
+    _globmem.reset(new dash::GlobMem<bucket_t>(*_team, lcapacity));
+    _lbuckets  = _globmem->lbegin();
+    for (size_type b = 0; b < lcapacity; ++b) {
+      _lbuckets[b].occupied = 0;
+    }
+  }
+
+  uint64_t hash_of(const key_type & key) const
+  {
+    return internal::hash_mix(static_cast<uint64_t>(hasher()(key)));
+  }
+
+  /**
+   * First bucket in the probe sequence of a key in its owner's table.
+   */
+  size_type home_bucket(const key_type & key) const
+  {
+    return static_cast<size_type>(hash_of(key) / _nunits) & _lmask;
+  }
+
+  /**
+   * Position of a key in the local table, or -1 if the key does not
+   * exist.
+   */
+  long long local_position(const key_type & key) const
+  {
+    if (unit_of(key) != _myid) {
+      return -1;
+    }
+    auto start = home_bucket(key);
+    for (size_type p = 0; p < _lcapacity; ++p) {
+      auto b = (start + p) & _lmask;
+      if (!_lbuckets[b].occupied) {
+        return -1;
+      }
+      if (_lbuckets[b].value.first == key) {
+        return static_cast<long long>(b);
+      }
+    }
+    return -1;
+  }
+
+  /**
+   * Inserts an element into the local table, or combines its value with
+   * an existing element if \c update is set.
+   */
+  template<class BinaryOperation>
+  upsert_result_t local_upsert(
+    const key_type    & key,
+    const mapped_type & mapped,
+    bool                update,
+    BinaryOperation     op)
+  {
+    auto start = home_bucket(key);
+    for (size_type p = 0; p < _lcapacity; ++p) {
+      auto & bucket = _lbuckets[(start + p) & _lmask];
+      if (!bucket.occupied) {
+        new (&bucket.value) value_type(key, mapped);
+        bucket.occupied = 1;
+        ++_lsize;
+        return UPSERT_INSERTED;
+      }
+      if (bucket.value.first == key) {
+        if (!update) {
+          return UPSERT_FAILED;
+        }
+        bucket.value.second = op(bucket.value.second, mapped);
+        return UPSERT_UPDATED;
+      }
+    }
+    DASH_LOG_ERROR("UnorderedMap.local_upsert", "local table is full",
+                   _lcapacity);
+    return UPSERT_FAILED;
+  }
+
+  /**
+   * Applies local elements in the range \c [first, last) and sends remote
+   * elements to their owners using the remote procedure \c Procedure.
+   */
+  template<class Procedure, class InputIt, class BinaryOperation>
+  dash::Future<size_type> apply_batch(
+    InputIt         first,
+    InputIt         last,
+    bool            update,
+    BinaryOperation op)
+  {
+    size_type         num_local = 0;
+    std::vector<bool> targets(_nunits, false);
+    for (auto it = first; it != last; ++it) {
+      const value_type & value = *it;
+      auto owner = unit_of(value.first);
+      if (owner == _myid) {
+        if (local_upsert(value.first, value.second, update, op)
+            != UPSERT_FAILED) {
+          ++num_local;
+        }
+      } else {
+        // Calls to the same owner are aggregated in batches:
+        dash::rpc<Procedure>(_global_units[owner], _id, _myid,
+                             value.first, value.second, op);
+        targets[owner] = true;
+      }
+    }
+    // Calls are executed in order, so the reply of the synchronizing call
+    // arrives after all elements have been applied at the owner:
+    std::vector< dash::Future<size_type> > futs;
+    for (size_type u = 0; u < _nunits; ++u) {
+      if (targets[u]) {
+        futs.push_back(
+          dash::rpc_async<sync_procedure>(_global_units[u], _id, _myid));
+      }
+    }
+    return dash::when_all(futs.begin(), futs.end()).then(
+             [=](const std::vector<size_type> & nums_applied) {
+               size_type num_applied = num_local;
+               for (auto n : nums_applied) {
+                 num_applied += n;
+               }
+               return num_applied;
+             });
+  }
+
+private:
+  /// Team of units storing the map's elements
+  Team                                      * _team;
+  /// Number of units in the team
+  size_type                                   _nunits;
+  /// Id of the calling unit in the team
+  dart_unit_t                                 _myid;
+  /// Global ids of the units in the team
+  std::vector<dart_unit_t>                    _global_units;
+  /// Identifier of the map in remote procedure calls
+  uint32_t                                    _id;
+  /// Buckets of the local tables of all units
+  std::unique_ptr< dash::GlobMem<bucket_t> >  _globmem;
+  /// Buckets of the local table
+  bucket_t                                  * _lbuckets  = nullptr;
+  /// Number of buckets in every unit's local table
+  size_type                                   _lcapacity = 0;
+  /// Mask of bucket indices in the local table
+  size_type                                   _lmask     = 0;
+  /// Number of elements in the local table
+  size_type                                   _lsize     = 0;
+  /// Number of elements of every unit applied at the calling unit since
+  /// the unit's last synchronizing call
+  std::vector<size_type>                      _applied_from;
+};
+
+} // namespace dash
+
+#endif // DASH__UNORDERED_MAP_H__INCLUDED
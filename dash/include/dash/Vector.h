@@ -0,0 +1,471 @@
+#ifndef DASH__VECTOR_H__INCLUDED
+#define DASH__VECTOR_H__INCLUDED
+
+#include <dash/GlobMem.h>
+#include <dash/GlobIter.h>
+#include <dash/GlobRef.h>
+#include <dash/CSRPattern.h>
+#include <dash/Team.h>
+#include <dash/Types.h>
+#include <dash/Exception.h>
+#include <dash/internal/Logging.h>
+#include <dash/dart/if/dart.h>
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace dash {
+
+/**
+ * A distributed vector with dynamic size.
+ *
+ * Every unit appends elements to its local part of the vector in local
+ * memory, see \c local. Local elements are published in the collective
+ * operation \c commit which
+ *
+ * - registers the local memory of every unit in the dynamic window of
+ *   the team if it has been reallocated since the last commit, and
+ * - determines the global index range of every unit's local elements
+ *   from the local sizes of all units.
+ *
+ * Elements are not moved between units, the local elements of unit
+ * \c u are succeeding the local elements of units \c 0 to \c u-1 in
+ * global index space like the rows of a matrix in CSR format, see
+ * \c dash::CSRPattern.
+ *
+ * Global iterators, references and the pattern of the vector are
+ * invalidated by \c commit.
+ * Until the next commit, other units access local elements in the state
+ * of the last commit: appending elements to a local part with exhausted
+ * capacity moves the local part to a new allocation, changes of elements
+ * in the new allocation are not visible to other units before the next
+ * commit.
+ *
+ * Example:
+ * \code
+ *     dash::Vector<int> frontier;
+ *     for (auto v : local_vertices) {
+ *       if (visit(v)) {
+ *         frontier.local.push_back(v);
+ *       }
+ *     }
+ *     frontier.commit();
+ *     // Global size and iteration of elements of all units:
+ *     auto num_visited = frontier.size();
+ * \endcode
+ *
+ * \concept{DashContainerConcept}
+ */
+template<
+  typename ElementType,
+  typename IndexType   = dash::default_index_t,
+  class    PatternType = CSRPattern<1, ROW_MAJOR, IndexType> >
+class Vector
+{
+private:
+  typedef Vector<ElementType, IndexType, PatternType> self_t;
+  typedef dash::GlobMem<ElementType>                  GlobMem_t;
+
+public:
+  typedef ElementType                                             value_type;
+  typedef IndexType                                               index_type;
+  typedef typename std::make_unsigned<IndexType>::type             size_type;
+  typedef typename std::make_unsigned<IndexType>::type       difference_type;
+
+  typedef       GlobIter<value_type, PatternType>                   iterator;
+  typedef const GlobIter<value_type, PatternType>             const_iterator;
+
+  typedef       GlobRef<value_type>                                reference;
+  typedef const GlobRef<value_type>                          const_reference;
+
+  typedef PatternType                                           pattern_type;
+
+public:
+  /**
+   * Proxy of the local part of the vector, provides access to local
+   * elements and appends elements in local memory.
+   */
+  class local_type
+  {
+  public:
+    local_type(self_t * vector)
+    : _vector(vector)
+    { }
+
+    inline ElementType * begin() const
+    {
+      return _vector->_lbuffer.get();
+    }
+
+    inline ElementType * end() const
+    {
+      return _vector->_lbuffer.get() + _vector->_lsize;
+    }
+
+    /**
+     * Number of local elements, including elements that have not been
+     * committed yet.
+     */
+    inline size_type size() const
+    {
+      return _vector->_lsize;
+    }
+
+    /**
+     * Number of local elements that can be stored in the current local
+     * allocation.
+     */
+    inline size_type capacity() const
+    {
+      return _vector->_lcapacity;
+    }
+
+    inline bool empty() const
+    {
+      return size() == 0;
+    }
+
+    inline ElementType & operator[](size_type local_index) const
+    {
+      return _vector->_lbuffer[local_index];
+    }
+
+    /**
+     * Appends an element to the local part of the vector.
+     * Reallocates local memory if the local capacity is exhausted.
+     */
+    void push_back(const ElementType & value)
+    {
+      if (_vector->_lsize == _vector->_lcapacity) {
+        _vector->reallocate_local(2 * _vector->_lcapacity);
+      }
+      _vector->_lbuffer[_vector->_lsize++] = value;
+    }
+
+    /**
+     * Reallocates local memory for at least the given number of elements.
+     */
+    void reserve(size_type lcapacity)
+    {
+      if (lcapacity > _vector->_lcapacity) {
+        _vector->reallocate_local(lcapacity);
+      }
+    }
+
+    /**
+     * Changes the number of local elements, appended elements are value-
+     * initialized.
+     */
+    void resize(size_type lsize)
+    {
+      reserve(lsize);
+      std::fill(end(), begin() + std::max(lsize, size()), ElementType());
+      _vector->_lsize = lsize;
+    }
+
+    inline void clear()
+    {
+      _vector->_lsize = 0;
+    }
+
+  private:
+    self_t * _vector;
+  };
+
+public:
+  /// Local proxy object, allows use in range-based for loops.
+  local_type local;
+
+public:
+  /**
+   * Constructor, creates an empty vector. Collective operation.
+   */
+  Vector(
+    /// Initial local capacity of every unit
+    size_type    lcapacity = 0,
+    /// Team containing all units operating on the vector
+    dash::Team & team      = dash::Team::All())
+  : local(this),
+    _team(&team)
+  {
+    DASH_LOG_TRACE("Vector.Vector(lcap,team)", lcapacity);
+    // Registered local memory must not be empty:
+    reallocate_local(std::max<size_type>(lcapacity, MinLocalCapacity));
+    commit();
+    _team->register_deallocator(
+      this, std::bind(&Vector::deallocate, this));
+    DASH_LOG_TRACE("Vector.Vector >");
+  }
+
+  Vector(const self_t & other) = delete;
+  self_t & operator=(const self_t & other) = delete;
+
+  ~Vector()
+  {
+    deallocate();
+  }
+
+  /**
+   * Publishes local elements appended since the last commit and
+   * establishes global indexing of all elements. Collective operation.
+   *
+   * Completes all operations on the vector that have been issued before
+   * at all units.
+   */
+  void commit()
+  {
+    DASH_LOG_DEBUG("Vector.commit()", _lsize);
+    // Accesses to the previous layout have to be completed at all units
+    // before local memory can be deregistered:
+    _team->barrier();
+    // Local sizes and whether local memory has to be registered:
+    size_type lstate[2] = {
+      _lsize,
+      _globmem == nullptr || _globmem->lbegin() != _lbuffer.get()
+    };
+    size_type nunits = _team->size();
+    std::vector<size_type> states(2 * nunits);
+    DASH_ASSERT_RETURNS(
+      dart_allgather(
+        lstate,
+        states.data(),
+        sizeof(lstate),
+        _team->dart_id()),
+      DART_OK);
+    std::vector<size_type> local_sizes(nunits);
+    bool                   reregister = false;
+    _size = 0;
+    for (size_type u = 0; u < nunits; ++u) {
+      local_sizes[u] = states[2 * u];
+      reregister    |= states[2 * u + 1] != 0;
+      _size         += local_sizes[u];
+    }
+    if (reregister) {
+      // Memory regions must not be attached to the dynamic window more
+      // than once, deregister unchanged local memory before:
+      _globmem.reset();
+      _globmem.reset(new GlobMem_t(*_team, _lbuffer.get(), _lcapacity));
+      _committed_lbuffer.reset();
+    }
+    _lsize_committed = _lsize;
+    if (_size > 0) {
+      _pattern.reset(new PatternType(local_sizes, _size, dash::BLOCKED, *_team));
+      _begin = iterator(_globmem.get(), *_pattern);
+      _end   = _begin + _size;
+    } else {
+      _pattern.reset();
+      _begin = iterator();
+      _end   = iterator();
+    }
+    DASH_LOG_DEBUG("Vector.commit >", _size, "registered:", reregister);
+  }
+
+  /**
+   * Global iterator to the first element in the vector.
+   */
+  inline iterator begin() noexcept
+  {
+    return _begin;
+  }
+
+  inline const_iterator begin() const noexcept
+  {
+    return _begin;
+  }
+
+  /**
+   * Global iterator past the last element in the vector.
+   */
+  inline iterator end() noexcept
+  {
+    return _end;
+  }
+
+  inline const_iterator end() const noexcept
+  {
+    return _end;
+  }
+
+  /**
+   * Native pointer to the first local element in the vector.
+   */
+  inline ElementType * lbegin() const noexcept
+  {
+    return _lbuffer.get();
+  }
+
+  /**
+   * Native pointer past the last committed local element in the vector.
+   */
+  inline ElementType * lend() const noexcept
+  {
+    return _lbuffer.get() + _lsize_committed;
+  }
+
+  /**
+   * Global reference to the element at the given global index.
+   */
+  inline reference operator[](size_type global_index)
+  {
+    return _begin[global_index];
+  }
+
+  inline const_reference operator[](size_type global_index) const
+  {
+    return _begin[global_index];
+  }
+
+  /**
+   * Global reference to the element at the given global index,
+   * range-checked.
+   */
+  reference at(size_type global_index)
+  {
+    if (global_index >= size()) {
+      DASH_THROW(
+        dash::exception::OutOfRange,
+        "Position " << global_index
+        << " is out of range " << size()
+        << " in Vector.at()");
+    }
+    return _begin[global_index];
+  }
+
+  /**
+   * Number of elements in the vector at the last commit.
+   */
+  inline size_type size() const noexcept
+  {
+    return _size;
+  }
+
+  /**
+   * Number of local elements at the last commit.
+   */
+  inline size_type lsize() const noexcept
+  {
+    return _lsize_committed;
+  }
+
+  inline bool empty() const noexcept
+  {
+    return _size == 0;
+  }
+
+  /**
+   * The pattern mapping global indices to local elements, only defined
+   * for non-empty vectors.
+   */
+  inline const PatternType & pattern() const
+  {
+    DASH_ASSERT_MSG(_pattern != nullptr, "Pattern of empty dash::Vector");
+    return *_pattern;
+  }
+
+  inline dash::Team & team() const noexcept
+  {
+    return *_team;
+  }
+
+  /**
+   * Global index of the first local element.
+   */
+  inline index_type lbegin_index() const
+  {
+    return _size > 0 ? _pattern->lbegin() : 0;
+  }
+
+  /**
+   * Establish a barrier for all units operating on the vector.
+   */
+  void barrier() const
+  {
+    _team->barrier();
+  }
+
+  /**
+   * Complete all outstanding non-blocking operations on the vector at
+   * all units.
+   */
+  void flush()
+  {
+    _globmem->flush_all();
+  }
+
+  void deallocate()
+  {
+    DASH_LOG_TRACE_VAR("Vector.deallocate()", this);
+    if (_globmem == nullptr) {
+      return;
+    }
+    if (dash::is_initialized()) {
+      barrier();
+    }
+    _team->unregister_deallocator(
+      this, std::bind(&Vector::deallocate, this));
+    _begin = iterator();
+    _end   = iterator();
+    _pattern.reset();
+    _globmem.reset();
+    _committed_lbuffer.reset();
+    _lbuffer.reset();
+    _size = _lsize = _lsize_committed = _lcapacity = 0;
+    DASH_LOG_TRACE("Vector.deallocate >");
+  }
+
+private:
+  /**
+   * Moves local elements to a new allocation of the given capacity.
+   * The allocation registered at the last commit is retained until the
+   * next commit.
+   */
+  void reallocate_local(size_type lcapacity)
+  {
+    DASH_LOG_TRACE("Vector.reallocate_local()", _lcapacity, "->", lcapacity);
+    std::unique_ptr<ElementType[]> lbuffer(new ElementType[lcapacity]);
+    std::copy(_lbuffer.get(), _lbuffer.get() + _lsize, lbuffer.get());
+    if (_globmem != nullptr && _globmem->lbegin() == _lbuffer.get()) {
+      _committed_lbuffer = std::move(_lbuffer);
+    }
+    _lbuffer   = std::move(lbuffer);
+    _lcapacity = lcapacity;
+  }
+
+private:
+  static const size_type MinLocalCapacity = 16;
+
+  /// Team containing all units operating on the vector
+  dash::Team                     * _team;
+  /// Local memory registered at the last commit
+  std::unique_ptr<GlobMem_t>       _globmem;
+  /// Element distribution at the last commit
+  std::unique_ptr<PatternType>     _pattern;
+  /// Local elements
+  std::unique_ptr<ElementType[]>   _lbuffer;
+  /// Local allocation registered at the last commit if local elements
+  /// have been reallocated since
+  std::unique_ptr<ElementType[]>   _committed_lbuffer;
+  /// Number of local elements
+  size_type                        _lsize           = 0;
+  /// Number of local elements that can be stored in the local allocation
+  size_type                        _lcapacity       = 0;
+  /// Number of local elements at the last commit
+  size_type                        _lsize_committed = 0;
+  /// Number of elements at the last commit
+  size_type                        _size            = 0;
+  /// Iterator to the first element in the vector
+  iterator                         _begin;
+  /// Iterator past the last element in the vector
+  iterator                         _end;
+};
+
+template<typename ElementType, typename IndexType, class PatternType>
+const typename Vector<ElementType, IndexType, PatternType>::size_type
+Vector<ElementType, IndexType, PatternType>::MinLocalCapacity;
+
+} // namespace dash
+
+#endif // DASH__VECTOR_H__INCLUDED
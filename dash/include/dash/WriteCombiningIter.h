@@ -0,0 +1,213 @@
+#ifndef DASH__WRITE_COMBINING_ITER_H__
+#define DASH__WRITE_COMBINING_ITER_H__
+
+#include <dash/GlobIter.h>
+#include <dash/algorithm/LocalRange.h>
+#include <dash/Exception.h>
+#include <dash/internal/Logging.h>
+#include <dash/dart/if/dart_communication.h>
+
+#include <iterator>
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <utility>
+#include <type_traits>
+
+namespace dash {
+
+/**
+ * Output iterator on a global range that combines sequential writes to
+ * elements which are contiguous in the local memory of a unit and
+ * transfers every such run of elements in a single put operation.
+ *
+ * Assigned values are buffered until the next assignment targets an
+ * element that does not continue the current run, e.g. at a block
+ * boundary, if the buffer is full, on \c flush() or on destruction of the
+ * last copy of the iterator. Copies of an iterator share the same buffer
+ * and write position.
+ *
+ * Use it for output that is produced element-wise, e.g. by
+ * \c std::transform or from input iterators that are not contiguous.
+ * \c dash::copy from a contiguous local buffer does not use it: runs of
+ * output elements are put directly from the input buffer.
+ *
+ * \see dash::write_combining
+ */
+template<class GlobOutputIt>
+class WriteCombiningIter
+: public std::iterator<
+           std::output_iterator_tag,
+           void, void, void, void > {
+private:
+  typedef WriteCombiningIter<GlobOutputIt>                  self_t;
+  typedef typename std::decay<
+            decltype(std::declval<GlobOutputIt>().global())
+          >::type                                       glob_iter_t;
+  typedef typename glob_iter_t::pattern_type           pattern_type;
+  typedef typename pattern_type::local_index_t          local_pos_t;
+
+public:
+  typedef typename GlobOutputIt::value_type              value_type;
+  typedef typename GlobOutputIt::index_type              index_type;
+
+private:
+  struct state_t {
+    /// Global iterator at the element written by the next assignment
+    glob_iter_t             pos;
+    /// Buffered values of the current run
+    std::vector<value_type> buffer;
+    /// Number of buffered values in the current run
+    size_t                  run_size = 0;
+    /// Global pointer to the first element of the current run
+    dart_gptr_t             run_gptr;
+    /// Unit and local offset of the first element of the current run
+    local_pos_t             run_lpos;
+    /// Number of elements from the first element of the current run that
+    /// are contiguous in local memory, limited to the buffer size
+    size_t                  run_capacity = 0;
+
+    inline void write(const value_type & value)
+    {
+      if (run_size > 0 && run_size == run_capacity) {
+        flush();
+      }
+      if (run_size == 0) {
+        index_type g_left = static_cast<index_type>(pos.pattern().size())
+                            - pos.pos();
+        run_gptr     = pos.dart_gptr();
+        run_lpos     = pos.lpos();
+        run_capacity = dash::internal::global_run_length(
+                         pos,
+                         std::min<index_type>(buffer.size(), g_left));
+      }
+      buffer[run_size++] = value;
+      ++pos;
+    }
+
+    void flush()
+    {
+      if (run_size == 0) {
+        return;
+      }
+      DASH_LOG_TRACE("WriteCombiningIter.flush()",
+                     "unit:",   run_lpos.unit,
+                     "lindex:", run_lpos.index,
+                     "nelem:",  run_size);
+      dart_ret_t ret = dart_put_blocking(
+                         run_gptr,
+                         buffer.data(),
+                         run_size * sizeof(value_type));
+      run_size       = 0;
+      if (ret != DART_OK) {
+        DASH_THROW(
+          dash::exception::RuntimeError,
+          "dash::WriteCombiningIter: dart_put_blocking failed");
+      }
+    }
+
+    ~state_t()
+    {
+      if (run_size > 0 &&
+          dart_put_blocking(
+            run_gptr, buffer.data(), run_size * sizeof(value_type))
+          != DART_OK) {
+        DASH_LOG_ERROR("WriteCombiningIter", "dart_put_blocking failed");
+      }
+    }
+  };
+
+public:
+  /**
+   * Constructor, creates an output iterator writing to the global range
+   * beginning at the given position.
+   */
+  WriteCombiningIter(
+    /// Global iterator at the first element to write
+    const GlobOutputIt & out_first,
+    /// Maximum number of values transferred in a single put operation
+    size_t               buffer_size)
+  : _state(std::make_shared<state_t>())
+  {
+    _state->pos = out_first.global();
+    _state->buffer.resize(std::max<size_t>(buffer_size, 1));
+  }
+
+  WriteCombiningIter(const self_t & other)       = default;
+  self_t & operator=(const self_t & other)       = default;
+
+  /**
+   * Buffers the given value for the element at the current position and
+   * advances the position.
+   */
+  inline self_t & operator=(const value_type & value)
+  {
+    _state->write(value);
+    return *this;
+  }
+
+  inline self_t & operator*()
+  {
+    return *this;
+  }
+
+  inline self_t & operator++()
+  {
+    return *this;
+  }
+
+  inline self_t & operator++(int)
+  {
+    return *this;
+  }
+
+  /**
+   * Transfers all buffered values to their target elements.
+   */
+  void flush()
+  {
+    _state->flush();
+  }
+
+  /**
+   * Global iterator at the element written by the next assignment.
+   */
+  glob_iter_t pos() const
+  {
+    return _state->pos;
+  }
+
+private:
+  std::shared_ptr<state_t> _state;
+};
+
+/**
+ * Creates an output iterator that combines sequential writes to the global
+ * range beginning at \c out_first into a single put operation for every
+ * run of elements that is contiguous in a unit's local memory.
+ *
+ * Example:
+ *
+ * \code
+ *     auto out = std::copy(values.begin(), values.end(),
+ *                          dash::write_combining(array.begin() + offset));
+ *     // Values are transferred at latest when the last copy of the
+ *     // iterator is destroyed:
+ *     out.flush();
+ * \endcode
+ *
+ * \returns  Output iterator at \c out_first
+ */
+template<class GlobOutputIt>
+WriteCombiningIter<GlobOutputIt> write_combining(
+  /// Global iterator at the first element to write
+  const GlobOutputIt & out_first,
+  /// Maximum number of values transferred in a single put operation
+  size_t               buffer_size = 4096)
+{
+  return WriteCombiningIter<GlobOutputIt>(out_first, buffer_size);
+}
+
+} // namespace dash
+
+#endif // DASH__WRITE_COMBINING_ITER_H__
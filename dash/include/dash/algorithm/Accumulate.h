@@ -2,23 +2,304 @@
 #define DASH__ALGORITHM__ACCUMULATE_H__
 
 #include <dash/GlobIter.h>
+#include <dash/Team.h>
+#include <dash/Types.h>
+#include <dash/Exception.h>
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
+#include <dash/algorithm/ExecutionPolicy.h>
+#include <dash/internal/Logging.h>
+#include <dash/dart/if/dart_communication.h>
+
+#include <type_traits>
+#include <vector>
 
 namespace dash {
 
+namespace internal {
+
+/**
+ * Reduces the elements in the non-empty local range
+ * \c [l_first, l_last) after applying \c unary_op to every element.
+ * For reduce operations in \c dash::ReduceOperation, partial results are
+ * reduced in independent accumulators to allow vectorization of the loop.
+ */
+template<
+  class ResultType,
+  class ValueType,
+  class BinaryOperation,
+  class UnaryOperation >
+ResultType local_reduce(
+  const ValueType * l_first,
+  const ValueType * l_last,
+  BinaryOperation   binary_op,
+  UnaryOperation    unary_op,
+  /// Operation is associative and commutative
+  std::true_type)
+{
+  auto nelem = l_last - l_first;
+  auto nvec  = nelem - (nelem % 4);
+  ResultType acc[4] = { BinaryOperation::identity(),
+                        BinaryOperation::identity(),
+                        BinaryOperation::identity(),
+                        BinaryOperation::identity() };
+  for (decltype(nelem) i = 0; i < nvec; i += 4) {
+    acc[0] = binary_op(acc[0], unary_op(l_first[i]));
+    acc[1] = binary_op(acc[1], unary_op(l_first[i+1]));
+    acc[2] = binary_op(acc[2], unary_op(l_first[i+2]));
+    acc[3] = binary_op(acc[3], unary_op(l_first[i+3]));
+  }
+  for (auto i = nvec; i < nelem; ++i) {
+    acc[0] = binary_op(acc[0], unary_op(l_first[i]));
+  }
+  return binary_op(binary_op(acc[0], acc[1]),
+                   binary_op(acc[2], acc[3]));
+}
+
+/**
+ * Reduces the elements in the non-empty local range
+ * \c [l_first, l_last) after applying \c unary_op to every element, in
+ * sequential order.
+ */
+template<
+  class ResultType,
+  class ValueType,
+  class BinaryOperation,
+  class UnaryOperation >
+ResultType local_reduce(
+  const ValueType * l_first,
+  const ValueType * l_last,
+  BinaryOperation   binary_op,
+  UnaryOperation    unary_op,
+  /// Operation is not known to be associative and commutative
+  std::false_type)
+{
+  ResultType acc = unary_op(*l_first);
+  for (auto l_it = l_first + 1; l_it != l_last; ++l_it) {
+    acc = binary_op(acc, unary_op(*l_it));
+  }
+  return acc;
+}
+
+/**
+ * Reduces the elements in the non-empty local range
+ * \c [l_first, l_last) using the given execution policy.
+ * Every thread reduces its chunk, chunk results are combined in the
+ * order of chunks.
+ */
+template<
+  class ResultType,
+  class ExecutionPolicy,
+  class ValueType,
+  class BinaryOperation,
+  class UnaryOperation >
+ResultType local_reduce(
+  const ExecutionPolicy & policy,
+  const ValueType       * l_first,
+  const ValueType       * l_last,
+  BinaryOperation         binary_op,
+  UnaryOperation          unary_op,
+  /// Operation is associative and commutative
+  std::true_type          is_reduce_op)
+{
+  typedef decltype(l_last - l_first) offset_t;
+  struct partial_t {
+    ResultType value;
+    bool       valid;
+  };
+  partial_t              none     = { BinaryOperation::identity(), false };
+  std::vector<partial_t> partials(local_max_threads(policy), none);
+  for_each_chunk_local(
+    policy, static_cast<offset_t>(0), l_last - l_first,
+    [&](offset_t chunk_begin, offset_t chunk_end, int thread) {
+      partials[thread].value = local_reduce<ResultType>(
+                                 l_first + chunk_begin,
+                                 l_first + chunk_end,
+                                 binary_op,
+                                 unary_op,
+                                 is_reduce_op);
+      partials[thread].valid = true;
+    });
+  ResultType acc = BinaryOperation::identity();
+  for (auto & partial : partials) {
+    if (partial.valid) {
+      acc = binary_op(acc, partial.value);
+    }
+  }
+  return acc;
+}
+
+/**
+ * Reduces the elements in the non-empty local range
+ * \c [l_first, l_last) in sequential order, regardless of the execution
+ * policy.
+ */
+template<
+  class ResultType,
+  class ExecutionPolicy,
+  class ValueType,
+  class BinaryOperation,
+  class UnaryOperation >
+ResultType local_reduce(
+  const ExecutionPolicy &,
+  const ValueType       * l_first,
+  const ValueType       * l_last,
+  BinaryOperation         binary_op,
+  UnaryOperation          unary_op,
+  /// Operation is not known to be associative and commutative
+  std::false_type         is_reduce_op)
+{
+  return local_reduce<ResultType>(l_first, l_last, binary_op, unary_op,
+                                  is_reduce_op);
+}
+
+/**
+ * Combines the local results of all units in the team in a single
+ * \c dart_allreduce.
+ * Units with empty local range contribute the identity element of the
+ * operation.
+ */
+template<
+  class ResultType,
+  class BinaryOperation >
+ResultType team_reduce(
+  const ResultType & l_result,
+  bool               l_valid,
+  const ResultType & init,
+  BinaryOperation    binary_op,
+  dash::Team       & team,
+  /// Operation and result type map to DART operation and type
+  std::true_type)
+{
+  ResultType l_value = l_valid ? l_result : BinaryOperation::identity();
+  ResultType g_value = BinaryOperation::identity();
+  DASH_ASSERT_RETURNS(
+    dart_allreduce(
+      &l_value,
+      &g_value,
+      1,
+      dash::dart_datatype<ResultType>::value,
+      binary_op.dart_operation(),
+      team.dart_id()),
+    DART_OK);
+  return binary_op(init, g_value);
+}
+
+/**
+ * Combines the local results of all units in the team by gathering them
+ * at every unit and reducing them in the order of unit ids.
+ * Local results are transferred bytewise, the result type must be
+ * trivially copyable.
+ */
+template<
+  class ResultType,
+  class BinaryOperation >
+ResultType team_reduce(
+  const ResultType & l_result,
+  bool               l_valid,
+  const ResultType & init,
+  BinaryOperation    binary_op,
+  dash::Team       & team,
+  /// Operation or result type is not supported by DART
+  std::false_type)
+{
+  static_assert(std::is_trivially_copyable<ResultType>::value,
+                "dash::accumulate requires a trivially copyable result "
+                "type if it has no DART data type");
+  struct partial_t {
+    ResultType value;
+    bool       valid;
+  };
+  partial_t              l_partial = { l_result, l_valid };
+  std::vector<partial_t> partials(team.size());
+  DASH_ASSERT_RETURNS(
+    dart_allgather(
+      &l_partial,
+      partials.data(),
+      sizeof(partial_t),
+      team.dart_id()),
+    DART_OK);
+  ResultType acc = init;
+  for (auto & partial : partials) {
+    if (partial.valid) {
+      acc = binary_op(acc, partial.value);
+    }
+  }
+  return acc;
+}
+
 /**
- * Computes the sum of the given value init and the elements in the range 
+ * Implementation of \c dash::transform_reduce shared by all distributed
+ * reductions.
+ */
+template<
+  class ExecutionPolicy,
+  class GlobInputIt,
+  class ResultType,
+  class BinaryOperation,
+  class UnaryOperation >
+ResultType transform_reduce_impl(
+  const ExecutionPolicy & policy,
+  GlobInputIt             in_first,
+  GlobInputIt             in_last,
+  ResultType              init,
+  BinaryOperation         binary_op,
+  UnaryOperation          unary_op)
+{
+  typedef typename GlobInputIt::value_type value_type;
+  typedef std::integral_constant<bool,
+            std::is_base_of<dash::ReduceOperation<ResultType>,
+                            BinaryOperation>::value &&
+            std::is_arithmetic<ResultType>::value >
+    is_reduce_op;
+  typedef std::integral_constant<bool,
+            is_reduce_op::value &&
+            dash::has_dart_datatype<ResultType>::value >
+    is_dart_reduce_op;
+
+  auto & team   = in_first.pattern().team();
+  auto   lrange = dash::local_range(in_first, in_last);
+  bool   lvalid = lrange.begin != lrange.end;
+  DASH_LOG_TRACE("dash::transform_reduce_impl",
+                 "local elements:", lrange.end - lrange.begin);
+  ResultType l_result = init;
+  if (lvalid) {
+    l_result = local_reduce<ResultType>(
+                 policy,
+                 static_cast<const value_type *>(lrange.begin),
+                 static_cast<const value_type *>(lrange.end),
+                 binary_op,
+                 unary_op,
+                 is_reduce_op());
+  }
+  return team_reduce(l_result, lvalid, init, binary_op, team,
+                     is_dart_reduce_op());
+}
+
+} // namespace internal
+
+/**
+ * Computes the sum of the given value init and the elements in the range
  * \c [first, last). Uses the given binary function \c op to accumulate the
  * elements.
  *
+ * Collective operation, must be called by all units in the team of the
+ * range's pattern. Every unit reduces the elements in its local subrange,
+ * partial results of all units are combined in a single collective
+ * operation for operations in \c dash::ReduceOperation on arithmetic
+ * types. Other operations are assumed to be associative and commutative,
+ * their partial results are gathered bytewise and must be of a trivially
+ * copyable type.
+ *
  * Note: For equivalent of semantics of \c MPI_Accumulate, see
  * \c dash::transform.
  *
  * Semantics:
- * 
+ *
  *     acc = init (+) in[0] (+) in[1] (+) ... (+) in[n]
  *
+ * \returns  The accumulated value, identical at all units
+ *
  * \see      dash::transform
  *
  * \ingroup  DashAlgorithms
@@ -31,8 +312,223 @@ ValueType accumulate(
   GlobInputIt     in_first,
   GlobInputIt     in_last,
   ValueType       init,
-  BinaryOperation binary_op = dash::plus<ValueType>()) {
-  return init;
+  BinaryOperation binary_op)
+{
+  DASH_LOG_DEBUG("dash::accumulate()");
+  return dash::internal::transform_reduce_impl(
+           dash::seq_local, in_first, in_last, init, binary_op,
+           [](const typename GlobInputIt::value_type & v) {
+             return static_cast<ValueType>(v);
+           });
+}
+
+/**
+ * Computes the sum of the given value init and the elements in the range
+ * \c [first, last).
+ *
+ * Collective operation, must be called by all units in the team of the
+ * range's pattern.
+ *
+ * \see      dash::accumulate
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  class GlobInputIt,
+  class ValueType >
+ValueType accumulate(
+  GlobInputIt     in_first,
+  GlobInputIt     in_last,
+  ValueType       init)
+{
+  return dash::accumulate(in_first, in_last, init,
+                          dash::plus<ValueType>());
+}
+
+/**
+ * Reduces the elements in the range \c [first, last) and the initial
+ * value \c init using the given binary function \c op which must be
+ * associative and commutative.
+ *
+ * Collective operation, must be called by all units in the team of the
+ * range's pattern.
+ *
+ * \see      dash::accumulate
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  class GlobInputIt,
+  class ValueType,
+  class BinaryOperation >
+ValueType reduce(
+  GlobInputIt     in_first,
+  GlobInputIt     in_last,
+  ValueType       init,
+  BinaryOperation binary_op)
+{
+  return dash::accumulate(in_first, in_last, init, binary_op);
+}
+
+/**
+ * Computes the sum of the given value init and the elements in the range
+ * \c [first, last).
+ *
+ * Collective operation, must be called by all units in the team of the
+ * range's pattern.
+ *
+ * \see      dash::accumulate
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  class GlobInputIt,
+  class ValueType >
+ValueType reduce(
+  GlobInputIt     in_first,
+  GlobInputIt     in_last,
+  ValueType       init)
+{
+  return dash::accumulate(in_first, in_last, init,
+                          dash::plus<ValueType>());
+}
+
+/**
+ * Applies \c unary_op to every element in the range \c [first, last) and
+ * reduces the results and the initial value \c init using the given
+ * binary function \c binary_op which must be associative and commutative.
+ *
+ * Collective operation, must be called by all units in the team of the
+ * range's pattern.
+ *
+ * Example:
+ *
+ * \code
+ *     // Squared euclidean norm:
+ *     double norm2 = dash::transform_reduce(
+ *                      array.begin(), array.end(), 0.0,
+ *                      dash::plus<double>(),
+ *                      [](double v) { return v * v; });
+ * \endcode
+ *
+ * \see      dash::accumulate
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  class GlobInputIt,
+  class ResultType,
+  class BinaryOperation,
+  class UnaryOperation >
+ResultType transform_reduce(
+  GlobInputIt     in_first,
+  GlobInputIt     in_last,
+  ResultType      init,
+  BinaryOperation binary_op,
+  UnaryOperation  unary_op)
+{
+  DASH_LOG_DEBUG("dash::transform_reduce()");
+  return dash::internal::transform_reduce_impl(
+           dash::seq_local, in_first, in_last, init, binary_op, unary_op);
+}
+
+/**
+ * Computes the sum of the given value init and the elements in the range
+ * \c [first, last), using the given execution policy for the local phase.
+ * Local elements are reduced in parallel for operations in
+ * \c dash::ReduceOperation on arithmetic types, other operations are
+ * applied sequentially.
+ *
+ * Collective operation, must be called by all units in the team of the
+ * range's pattern.
+ *
+ * \tparam   ExecutionPolicy  Execution policy of local phase, e.g.
+ *                            \c dash::par_unseq_local
+ *
+ * \see      dash::accumulate
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  class ExecutionPolicy,
+  class GlobInputIt,
+  class ValueType,
+  class BinaryOperation >
+typename std::enable_if<
+  dash::is_execution_policy<ExecutionPolicy>::value, ValueType >::type
+accumulate(
+  const ExecutionPolicy & policy,
+  GlobInputIt             in_first,
+  GlobInputIt             in_last,
+  ValueType               init,
+  BinaryOperation         binary_op)
+{
+  DASH_LOG_DEBUG("dash::accumulate()");
+  return dash::internal::transform_reduce_impl(
+           policy, in_first, in_last, init, binary_op,
+           [](const typename GlobInputIt::value_type & v) {
+             return static_cast<ValueType>(v);
+           });
+}
+
+/**
+ * Computes the sum of the given value init and the elements in the range
+ * \c [first, last), using the given execution policy for the local phase.
+ *
+ * Collective operation, must be called by all units in the team of the
+ * range's pattern.
+ *
+ * \see      dash::accumulate
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  class ExecutionPolicy,
+  class GlobInputIt,
+  class ValueType >
+typename std::enable_if<
+  dash::is_execution_policy<ExecutionPolicy>::value, ValueType >::type
+accumulate(
+  const ExecutionPolicy & policy,
+  GlobInputIt             in_first,
+  GlobInputIt             in_last,
+  ValueType               init)
+{
+  return dash::accumulate(policy, in_first, in_last, init,
+                          dash::plus<ValueType>());
+}
+
+/**
+ * Applies \c unary_op to every element in the range \c [first, last) and
+ * reduces the results and the initial value \c init, using the given
+ * execution policy for the local phase.
+ *
+ * Collective operation, must be called by all units in the team of the
+ * range's pattern.
+ *
+ * \see      dash::transform_reduce
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  class ExecutionPolicy,
+  class GlobInputIt,
+  class ResultType,
+  class BinaryOperation,
+  class UnaryOperation >
+typename std::enable_if<
+  dash::is_execution_policy<ExecutionPolicy>::value, ResultType >::type
+transform_reduce(
+  const ExecutionPolicy & policy,
+  GlobInputIt             in_first,
+  GlobInputIt             in_last,
+  ResultType              init,
+  BinaryOperation         binary_op,
+  UnaryOperation          unary_op)
+{
+  DASH_LOG_DEBUG("dash::transform_reduce()");
+  return dash::internal::transform_reduce_impl(
+           policy, in_first, in_last, init, binary_op, unary_op);
 }
 
 } // namespace dash
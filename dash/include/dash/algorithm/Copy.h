@@ -9,10 +9,11 @@
 #include <algorithm>
 #include <vector>
 #include <memory>
+#include <limits>
 
-#ifndef DASH__ALGORITHM__COPY__USE_WAIT
-#define DASH__ALGORITHM__COPY__USE_FLUSH
-#endif
+// Asynchronous global-to-local copy operations are completed by waiting
+// for request handles unless DASH__ALGORITHM__COPY__USE_FLUSH is defined.
+// Futures of copy operations using flush cannot be tested for completion.
 
 namespace dash {
 
@@ -93,6 +94,52 @@ dash::Future<ValueType *> copy_async(
 
 namespace internal {
 
+/**
+ * Number of elements in the run of global indices beginning at \c g_idx
+ * that are contiguous in the local memory of the unit owning \c g_idx at
+ * local position \c l_pos, limited to \c max_elem.
+ *
+ * Runs in one-dimensional patterns are resolved block by block, see
+ * \c dash::internal::pattern_run_length.
+ * Ranges in multi-dimensional patterns are expected to be contiguous in
+ * local memory, like blocks of tiled patterns.
+ */
+template <
+  class PatternType,
+  class LocalPosType >
+typename PatternType::size_type copy_run_length(
+  const PatternType                & pattern,
+  typename PatternType::index_type   g_idx,
+  const LocalPosType               & l_pos,
+  typename PatternType::size_type    max_elem)
+{
+  typedef typename PatternType::index_type index_type;
+  if (PatternType::ndim() != 1) {
+    return max_elem;
+  }
+  return pattern_run_length(pattern, g_idx, l_pos,
+                            static_cast<index_type>(max_elem));
+}
+
+/**
+ * Whether the elements in the given local index range are contiguous in
+ * global index space, i.e. are located in a single block of a
+ * one-dimensional pattern.
+ */
+template <
+  class PatternType,
+  class LocalIndexRangeType >
+bool copy_local_subrange_contiguous(
+  const PatternType         & pattern,
+  const LocalIndexRangeType & l_range)
+{
+  if (PatternType::ndim() != 1) {
+    return true;
+  }
+  return pattern.global(l_range.end - 1) - pattern.global(l_range.begin)
+         == l_range.end - l_range.begin - 1;
+}
+
 /**
  * Blocking implementation of \c dash::copy (global to local) without
  * optimization for local subrange.
@@ -133,6 +180,7 @@ ValueType * copy_impl(
   DASH_LOG_TRACE_VAR("dash::copy_impl", unit_first);
   auto unit_last       = pattern.unit_at(g_in_last.pos() - 1);
   DASH_LOG_TRACE_VAR("dash::copy_impl", unit_last);
+  auto myid            = pattern.team().myid();
 
   // MPI uses offset type int, do not copy more than INT_MAX bytes:
   size_type max_copy_elem   = (std::numeric_limits<int>::max() /
@@ -144,7 +192,13 @@ ValueType * copy_impl(
                    "cannot copy", num_elem_total, "elements",
                    "in a single dart_get operation");
   }
-  if (unit_first == unit_last) {
+  // Units hold several blocks in the input range in block-cyclic
+  // patterns, test if the range is contiguous at a single unit:
+  if (unit_first == unit_last &&
+      copy_run_length(pattern, g_in_first.pos(),
+                      pattern.local(static_cast<index_type>(
+                                      g_in_first.pos())),
+                      num_elem_total) == num_elem_total) {
     // Input range is located at a single remote unit:
     DASH_LOG_TRACE("dash::copy_impl", "input range at single unit");
     while (num_elem_copied < num_elem_total) {
@@ -188,10 +242,15 @@ ValueType * copy_impl(
       size_type max_elem_per_unit = pattern.local_size(local_pos.unit);
       // Local offset of first element in input range at current unit:
       auto l_in_first_idx  = local_pos.index;
-      // Maximum number of elements to copy from current unit:
-      auto num_unit_elem   = max_elem_per_unit - l_in_first_idx;
       // Number of elements left to copy:
       auto total_elem_left = num_elem_total - num_elem_copied;
+      // Maximum number of elements to copy from current unit, limited to
+      // the run that is contiguous in the unit's local memory:
+      auto num_unit_elem   = copy_run_length(
+                               pattern, cur_in_first.pos(), local_pos,
+                               std::min<size_type>(
+                                 max_elem_per_unit - l_in_first_idx,
+                                 total_elem_left));
       // Number of elements to copy in this iteration.
       auto num_copy_elem   = (num_unit_elem < max_copy_elem)
                              ? num_unit_elem
@@ -216,11 +275,16 @@ ValueType * copy_impl(
                      "left:",           total_elem_left);
       auto dest_ptr = out_first + num_elem_copied;
       auto src_gptr = cur_in_first.dart_gptr();
-      if (dart_get_blocking(
-            dest_ptr,
-            src_gptr,
-            num_copy_elem * sizeof(ValueType))
-          != DART_OK) {
+      if (local_pos.unit == myid) {
+        // Runs at the calling unit are interleaved with remote runs in
+        // block-cyclic patterns:
+        ValueType * l_src = cur_in_first.local();
+        std::copy(l_src, l_src + num_copy_elem, dest_ptr);
+      } else if (dart_get_blocking(
+                   dest_ptr,
+                   src_gptr,
+                   num_copy_elem * sizeof(ValueType))
+                 != DART_OK) {
         DASH_LOG_ERROR("dash::copy_impl", "dart_get failed");
         DASH_THROW(
           dash::exception::RuntimeError, "dart_get failed");
@@ -234,17 +298,29 @@ ValueType * copy_impl(
   return out_last;
 }
 
+#ifdef DASH__ALGORITHM__COPY__USE_FLUSH
+/// Request of an asynchronous get operation, completed by flush
+typedef dart_gptr_t   copy_request_t;
+#else
+/// Request of an asynchronous get operation, completed by wait
+typedef dart_handle_t copy_request_t;
+#endif
+
 /**
  * Asynchronous implementation of \c dash::copy (global to local) without
  * optimization for local subrange.
+ * Appends requests of the get operations to the given vector.
+ *
+ * \returns  Pointer past the last element in the output range
  */
 template <
   typename ValueType,
   class GlobInputIt >
-dash::Future<ValueType *> copy_async_impl(
-  GlobInputIt   in_first,
-  GlobInputIt   in_last,
-  ValueType   * out_first)
+ValueType * copy_async_impl(
+  GlobInputIt                   in_first,
+  GlobInputIt                   in_last,
+  ValueType                   * out_first,
+  std::vector<copy_request_t> & req_handles)
 {
   DASH_LOG_TRACE("dash::copy_async_impl()",
                  "in_first:",  in_first.pos(),
@@ -256,7 +332,7 @@ dash::Future<ValueType *> copy_async_impl(
   size_type num_elem_total = dash::distance(in_first, in_last);
   if (num_elem_total <= 0) {
     DASH_LOG_TRACE("dash::copy_async_impl", "input range empty");
-    return dash::Future<ValueType *>([=]() { return out_first; });
+    return out_first;
   }
   DASH_LOG_TRACE("dash::copy_async_impl",
                  "total elements:",    num_elem_total,
@@ -274,13 +350,7 @@ dash::Future<ValueType *> copy_async_impl(
   DASH_LOG_TRACE_VAR("dash::copy_async_impl", unit_first);
   auto unit_last       = pattern.unit_at(g_in_last.pos() - 1);
   DASH_LOG_TRACE_VAR("dash::copy_async_impl", unit_last);
-
-  // Accessed global pointers to be flushed:
-#ifdef DASH__ALGORITHM__COPY__USE_FLUSH
-  std::vector<dart_gptr_t>   req_handles;
-#else
-  std::vector<dart_handle_t> req_handles;
-#endif
+  auto myid            = pattern.team().myid();
 
   // MPI uses offset type int, do not copy more than INT_MAX bytes:
   size_type max_copy_elem   = (std::numeric_limits<int>::max() /
@@ -292,7 +362,13 @@ dash::Future<ValueType *> copy_async_impl(
                    "cannot copy", num_elem_total, "elements",
                    "in a single dart_get operation");
   }
-  if (unit_first == unit_last) {
+  // Units hold several blocks in the input range in block-cyclic
+  // patterns, test if the range is contiguous at a single unit:
+  if (unit_first == unit_last &&
+      copy_run_length(pattern, g_in_first.pos(),
+                      pattern.local(static_cast<index_type>(
+                                      g_in_first.pos())),
+                      num_elem_total) == num_elem_total) {
     // Input range is located at a single remote unit:
     DASH_LOG_TRACE("dash::copy_async_impl", "input range at single unit");
     while (num_elem_copied < num_elem_total) {
@@ -351,10 +427,15 @@ dash::Future<ValueType *> copy_async_impl(
       size_type max_elem_per_unit = pattern.local_size(local_pos.unit);
       // Local offset of first element in input range at current unit:
       auto l_in_first_idx  = local_pos.index;
-      // Maximum number of elements to copy from current unit:
-      auto num_unit_elem   = max_elem_per_unit - l_in_first_idx;
       // Number of elements left to copy:
       auto total_elem_left = num_elem_total - num_elem_copied;
+      // Maximum number of elements to copy from current unit, limited to
+      // the run that is contiguous in the unit's local memory:
+      auto num_unit_elem   = copy_run_length(
+                               pattern, cur_in_first.pos(), local_pos,
+                               std::min<size_type>(
+                                 max_elem_per_unit - l_in_first_idx,
+                                 total_elem_left));
       // Number of elements to copy in this iteration.
       auto num_copy_elem   = (num_unit_elem < max_copy_elem)
                              ? num_unit_elem
@@ -379,6 +460,14 @@ dash::Future<ValueType *> copy_async_impl(
                      "left:",           total_elem_left);
       auto src_gptr = cur_in_first.dart_gptr();
       auto dest_ptr = out_first + num_elem_copied;
+      if (local_pos.unit == myid) {
+        // Runs at the calling unit are interleaved with remote runs in
+        // block-cyclic patterns:
+        ValueType * l_src = cur_in_first.local();
+        std::copy(l_src, l_src + num_copy_elem, dest_ptr);
+        num_elem_copied += num_copy_elem;
+        continue;
+      }
 #ifdef DASH__ALGORITHM__COPY__USE_FLUSH
       if (dart_get(
             dest_ptr,
@@ -406,61 +495,211 @@ dash::Future<ValueType *> copy_async_impl(
       num_elem_copied += num_copy_elem;
     }
   }
-  dash::Future<ValueType *> result([=]() mutable {
-    // Wait for all get requests to complete:
-    ValueType * _out = out_first + num_elem_copied;
-    DASH_LOG_TRACE("dash::copy_async_impl [Future]()",
-                   "  wait for", req_handles.size(), "async get request");
-    DASH_LOG_TRACE("dash::copy_async_impl [Future]", "  flush:", req_handles);
-    DASH_LOG_TRACE("dash::copy_async_impl [Future]", "  _out:", _out);
+  DASH_LOG_TRACE("dash::copy_async_impl >", "requests:", req_handles.size());
+  return out_first + num_elem_copied;
+}
+
+/**
+ * Future of asynchronous get operations with the given requests and
+ * pointer past the last element in the output range.
+ */
+template <typename ValueType>
+dash::Future<ValueType *> copy_async_future(
+  const std::vector<copy_request_t> & req_handles,
+  ValueType                         * out_last)
+{
 #ifdef DASH__ALGORITHM__COPY__USE_FLUSH
+  return dash::Future<ValueType *>([=]() {
     for (auto gptr : req_handles) {
       dart_flush_local_all(gptr);
     }
+    return out_last;
+  });
 #else
-    if (req_handles.size() > 0) {
-      if (dart_waitall_local(&req_handles[0], req_handles.size())
-          != DART_OK) {
-        DASH_LOG_ERROR("dash::copy_async_impl [Future]",
-                       "  dart_waitall_local failed");
-        DASH_THROW(
-          dash::exception::RuntimeError,
-          "dash::copy_async_impl [Future]: dart_waitall_local failed");
-      }
-    } else {
-      DASH_LOG_TRACE("dash::copy_async_impl [Future]", "  No pending handles");
-    }
+  return dash::Future<ValueType *>(req_handles, out_last);
 #endif
-    DASH_LOG_TRACE("dash::copy_async_impl [Future] >",
-                   "  async requests completed, _out:", _out);
-    return _out;
-  });
-  DASH_LOG_TRACE("dash::copy_async_impl >", "  returning future");
-  return result;
 }
 
 /**
- * Blocking implementation of \c dash::copy (local to global) without
- * optimization for local subrange.
+ * Asynchronous implementation of \c dash::copy (local to global).
+ * Issues a put operation for every run of output elements that is
+ * contiguous in the local memory of a unit and copies runs in the local
+ * memory of the calling unit directly.
+ * Appends handles of the put operations to the given vector.
+ *
+ * Runs are transferred from the input buffer without staging, which
+ * supersedes write-combining of the output range via
+ * \c dash::write_combining for contiguous input ranges.
  */
 template <
   typename ValueType,
   class GlobOutputIt >
-GlobOutputIt copy_impl(
-  ValueType    * in_first,
-  ValueType    * in_last,
-  GlobOutputIt   out_first)
+GlobOutputIt copy_async_impl(
+  ValueType                  * in_first,
+  ValueType                  * in_last,
+  GlobOutputIt                 out_first,
+  std::vector<dart_handle_t> & handles)
+{
+  typedef typename GlobOutputIt::index_type index_type;
+  index_type num_elem_total = std::distance(in_first, in_last);
+  // MPI uses offset type int, do not copy more than INT_MAX bytes:
+  index_type max_copy_elem  = (std::numeric_limits<int>::max() /
+                               sizeof(ValueType));
+  auto       myid           = out_first.pattern().team().myid();
+  auto       out_it         = out_first;
+  index_type offset         = 0;
+  while (offset < num_elem_total) {
+    // Run of output elements that are contiguous in local memory of the
+    // target unit:
+    auto       run_gptr = out_it.dart_gptr();
+    auto       run_lpos = out_it.lpos();
+    auto       run_dst  = out_it.local();
+    index_type nrun     = dash::internal::global_run_length(
+                            out_it,
+                            std::min(num_elem_total - offset,
+                                     max_copy_elem));
+    out_it += nrun;
+    DASH_LOG_TRACE("dash::internal::copy_async_impl",
+                   "offset:",      offset,
+                   "nelem:",       nrun,
+                   "target unit:", run_lpos.unit);
+    if (run_lpos.unit == myid) {
+      std::copy(in_first + offset, in_first + offset + nrun, run_dst);
+    } else {
+      dart_handle_t put_handle;
+      DASH_ASSERT_RETURNS(
+        dart_put_handle(
+          run_gptr,
+          in_first + offset,
+          nrun * sizeof(ValueType),
+          &put_handle),
+        DART_OK);
+      if (put_handle != NULL) {
+        handles.push_back(put_handle);
+      }
+    }
+    offset += nrun;
+  }
+  return out_first + num_elem_total;
+}
+
+/**
+ * Transfers the run of elements beginning at the given offset in the
+ * global input range to the global output range in a single put
+ * operation. The run is extended while input and output elements are
+ * contiguous in the local memory of the calling unit and of the unit
+ * owning the output elements, respectively.
+ * Does not wait for completion of the put operation.
+ *
+ * \returns  The number of elements in the run.
+ */
+template <
+  class GlobInputIt,
+  class GlobOutputIt >
+typename GlobInputIt::index_type copy_local_run_impl(
+  const GlobInputIt  & in_first,
+  const GlobOutputIt & out_first,
+  typename GlobInputIt::index_type offset,
+  typename GlobInputIt::index_type num_elem_total)
+{
+  typedef typename GlobInputIt::value_type   value_type;
+  typedef typename GlobInputIt::index_type   index_type;
+  auto in_it      = in_first  + offset;
+  auto out_it     = out_first + offset;
+  auto run_gptr   = out_it.dart_gptr();
+  auto run_out    = out_it.lpos();
+  auto run_src    = in_it.local();
+  auto run_dst    = out_it.local();
+  // Run of elements that are contiguous in local memory of the calling
+  // unit and of the unit owning the output elements:
+  index_type nrun = dash::internal::global_run_length(
+                      in_it, num_elem_total - offset);
+  nrun            = dash::internal::global_run_length(out_it, nrun);
+  DASH_LOG_TRACE("dash::internal::copy_local_run_impl",
+                 "offset:",      offset,
+                 "nelem:",       nrun,
+                 "target unit:", run_out.unit);
+  if (run_dst != nullptr) {
+    std::copy(run_src, run_src + nrun, run_dst);
+  } else {
+    DASH_ASSERT_RETURNS(
+      dart_put(
+        run_gptr,
+        run_src,
+        nrun * sizeof(value_type)),
+      DART_OK);
+  }
+  return nrun;
+}
+
+/**
+ * Implementation of \c dash::copy (global to global) for the subrange of
+ * the input range that is local to the calling unit.
+ * Resolves the local input elements from the local index range of the
+ * input pattern.
+ */
+template <
+  class GlobInputIt,
+  class GlobOutputIt >
+void copy_local_subrange_impl(
+  const GlobInputIt  & in_first,
+  const GlobInputIt  & in_last,
+  const GlobOutputIt & out_first,
+  /// Input iterators are not relative to a view
+  std::false_type)
 {
-  auto num_elements = std::distance(in_first, in_last);
-  auto num_bytes    = num_elements * sizeof(ValueType);
-  DASH_ASSERT_RETURNS(
-    dart_put_blocking(
-      out_first.dart_gptr(),
-      in_first,
-      num_bytes),
-    DART_OK);
-
-  return out_first + num_elements;
+  typedef typename GlobInputIt::index_type index_type;
+  index_type num_elem_total = dash::distance(in_first, in_last);
+  auto       pattern        = in_first.pattern();
+  auto       li_range_in    = local_index_range(in_first, in_last);
+  DASH_LOG_TRACE("dash::internal::copy_local_subrange_impl",
+                 "local input range:",
+                 li_range_in.begin, li_range_in.end);
+  index_type l_idx = li_range_in.begin;
+  while (l_idx < li_range_in.end) {
+    // Offset of the local input element in the input range:
+    index_type offset = static_cast<index_type>(pattern.global(l_idx))
+                        - in_first.pos();
+    if (offset < 0 || offset >= num_elem_total) {
+      ++l_idx;
+      continue;
+    }
+    l_idx += copy_local_run_impl(in_first, out_first,
+                                 offset, num_elem_total);
+  }
+}
+
+/**
+ * Implementation of \c dash::copy (global to global) for the subrange of
+ * the input range that is local to the calling unit.
+ * Tests every element in the input view for locality.
+ */
+template <
+  class GlobInputIt,
+  class GlobOutputIt >
+void copy_local_subrange_impl(
+  const GlobInputIt  & in_first,
+  const GlobInputIt  & in_last,
+  const GlobOutputIt & out_first,
+  /// Input iterators are relative to a view
+  std::true_type)
+{
+  typedef typename GlobInputIt::index_type index_type;
+  index_type num_elem_total = dash::distance(in_first, in_last);
+  auto       myid           = in_first.pattern().team().myid();
+  auto       in_it          = in_first;
+  index_type offset         = 0;
+  while (offset < num_elem_total) {
+    if (in_it.lpos().unit != myid) {
+      ++in_it;
+      ++offset;
+      continue;
+    }
+    auto nrun = copy_local_run_impl(in_first, out_first,
+                                    offset, num_elem_total);
+    in_it  += nrun;
+    offset += nrun;
+  }
 }
 
 } // namespace internal
@@ -483,7 +722,7 @@ dash::Future<ValueType *> copy_async(
   DASH_LOG_TRACE("dash::copy_async()", "async, global to local");
   if (in_first == in_last) {
     DASH_LOG_TRACE("dash::copy_async", "input range empty");
-    return dash::Future<ValueType *>([=]() { return out_first; });
+    return dash::make_ready_future(out_first);
   }
   ValueType * dest_first = out_first;
   // Return value, initialize with begin of output range, indicating no values
@@ -520,17 +759,20 @@ dash::Future<ValueType *> copy_async(
     }
     DASH_LOG_TRACE("dash::copy_async", "finished local copy of",
                    (out_last - out_first), "elements");
-    return dash::Future<ValueType *>([=]() { return out_last; });
+    return dash::make_ready_future(out_last);
   }
 
   DASH_LOG_TRACE("dash::copy_async", "local range:",
                  li_range_in.begin,
                  li_range_in.end,
                  "in_first.is_local:", in_first.is_local());
-  // Futures of asynchronous get requests:
-  auto futures = std::vector< dash::Future<ValueType *> >();
-  // Check if global input range is partially local:
-  if (num_local_elem > 0) {
+  // Requests of asynchronous get operations:
+  std::vector<dash::internal::copy_request_t> req_handles;
+  // Check if global input range is partially local, local elements in
+  // several blocks are copied in the runs of their blocks:
+  if (num_local_elem > 0 &&
+      dash::internal::copy_local_subrange_contiguous(
+        in_first.pattern(), li_range_in)) {
     // Part of the input range is local, copy local input subrange to local
     // output range directly.
     auto pattern          = in_first.pattern();
@@ -570,10 +812,10 @@ dash::Future<ValueType *> copy_async(
       // ... [ --- copy --- | ... l ... | ........ ]
       //     ^              ^           ^          ^
       //     in_first       l_in_first  l_in_last  in_last
-      auto fut_prelocal = dash::internal::copy_async_impl(g_in_first,
-                                                          g_l_in_first,
-                                                          dest_first);
-      futures.push_back(fut_prelocal);
+      dash::internal::copy_async_impl(g_in_first,
+                                      g_l_in_first,
+                                      dest_first,
+                                      req_handles);
       // Advance output pointers:
       out_last   += num_prelocal_elem;
       dest_first  = out_last;
@@ -593,10 +835,10 @@ dash::Future<ValueType *> copy_async(
       // ... [ ........ | ... l ... | --- copy --- ]
       //     ^          ^           ^              ^
       //     in_first   l_in_first  l_in_last      in_last
-      auto fut_postlocal = dash::internal::copy_async_impl(g_l_in_last,
-                                                           g_in_last,
-                                                           dest_first);
-      futures.push_back(fut_postlocal);
+      dash::internal::copy_async_impl(g_l_in_last,
+                                      g_in_last,
+                                      dest_first,
+                                      req_handles);
       out_last += num_postlocal_elem;
     }
     //
@@ -638,31 +880,19 @@ dash::Future<ValueType *> copy_async(
                    "elements");
     out_last += (local_out_last - local_out_first);
   } else {
-    DASH_LOG_TRACE("dash::copy_async", "no local subrange");
-    // All elements in input range are remote
-    auto fut_all = dash::internal::copy_async_impl(in_first,
-                                                   in_last,
-                                                   dest_first);
-    futures.push_back(fut_all);
+    DASH_LOG_TRACE("dash::copy_async", "no contiguous local subrange");
+    // All elements in input range are remote or local elements are not
+    // contiguous:
+    dash::internal::copy_async_impl(in_first,
+                                    in_last,
+                                    dest_first,
+                                    req_handles);
     out_last = out_first + total_copy_elem;
   }
-  DASH_LOG_TRACE("dash::copy_async", "preparing future");
-  dash::Future<ValueType *> fut_result([=]() mutable {
-    ValueType * _out = out_last;
-    DASH_LOG_TRACE("dash::copy_async [Future]()",
-                   "wait for", futures.size(), "async copy requests");
-    DASH_LOG_TRACE("dash::copy_async [Future]", "  futures:", futures);
-    DASH_LOG_TRACE("dash::copy_async [Future]", "  _out:", _out);
-    for (auto f : futures) {
-      f.wait();
-    }
-    DASH_LOG_TRACE("dash::copy_async [Future] >", "async requests completed",
-                   "futures:", futures, "_out:", _out);
-    return _out;
-  });
   DASH_LOG_TRACE("dash::copy_async >", "finished,",
-                 "expected out_last:", out_last);
-  return fut_result;
+                 "expected out_last:", out_last,
+                 "requests:", req_handles.size());
+  return dash::internal::copy_async_future(req_handles, out_last);
 }
 
 /*
@@ -724,8 +954,11 @@ ValueType * copy(
                  li_range_in.begin,
                  li_range_in.end,
                  "in_first.is_local:", in_first.is_local());
-  // Check if global input range is partially local:
-  if (num_local_elem > 0) {
+  // Check if global input range is partially local, local elements in
+  // several blocks are copied in the runs of their blocks:
+  if (num_local_elem > 0 &&
+      dash::internal::copy_local_subrange_contiguous(
+        in_first.pattern(), li_range_in)) {
     // Part of the input range is local, copy local input subrange to local
     // output range directly.
     auto pattern          = in_first.pattern();
@@ -830,8 +1063,9 @@ ValueType * copy(
                                            dest_first);
     }
   } else {
-    DASH_LOG_TRACE("dash::copy", "no local subrange");
-    // All elements in input range are remote
+    DASH_LOG_TRACE("dash::copy", "no contiguous local subrange");
+    // All elements in input range are remote or local elements are not
+    // contiguous:
     out_last = dash::internal::copy_impl(in_first,
                                          in_last,
                                          dest_first);
@@ -841,6 +1075,31 @@ ValueType * copy(
   return out_last;
 }
 
+/**
+ * Specialization of \c dash::copy_async as local-to-global asynchronous
+ * copy operation.
+ * Output elements at the calling unit are assigned immediately, put
+ * operations to elements at other units are completed when waiting on
+ * the returned future.
+ */
+template <
+  typename ValueType,
+  class GlobOutputIt >
+dash::Future<GlobOutputIt> copy_async(
+  ValueType    * in_first,
+  ValueType    * in_last,
+  GlobOutputIt   out_first)
+{
+  DASH_LOG_TRACE("dash::copy_async()", "local to global");
+  std::vector<dart_handle_t> req_handles;
+  auto out_last = dash::internal::copy_async_impl(
+                    in_first, in_last, out_first, req_handles);
+  DASH_LOG_TRACE("dash::copy_async", "put requests:", req_handles.size());
+  DASH_LOG_TRACE("dash::copy_async >", "returning future");
+  // Put requests are completed at their targets:
+  return dash::Future<GlobOutputIt>(req_handles, out_last, true);
+}
+
 /**
  * Specialization of \c dash::copy as local-to-global blocking copy operation.
  */
@@ -853,102 +1112,63 @@ GlobOutputIt copy(
   GlobOutputIt   out_first)
 {
   DASH_LOG_TRACE("dash::copy()", "blocking, local to global");
-  // Return value, initialize with begin of output range, indicating no values
-  // have been copied:
-  GlobOutputIt out_last   = out_first;
-  // Number of elements to copy in total:
-  auto num_elements       = std::distance(in_first, in_last);
-  DASH_LOG_TRACE_VAR("dash::copy", num_elements);
-  // Global iterator pointing at hypothetical end of output range:
-  GlobOutputIt out_h_last = out_first + num_elements;
-  DASH_LOG_TRACE_VAR("dash::copy", out_first.pos());
-  DASH_LOG_TRACE_VAR("dash::copy", out_h_last.pos());
-  // Test if a subrange of global output range is local:
-  auto li_range_out       = local_index_range(out_first, out_h_last);
-  DASH_LOG_TRACE_VAR("dash::copy", li_range_out.begin);
-  DASH_LOG_TRACE_VAR("dash::copy", li_range_out.end);
-  // Number of elements in the local subrange:
-  auto num_local_elem     = li_range_out.end - li_range_out.begin;
-  // Check if part of the output range is local:
-  if (num_local_elem > 0) {
-    // Part of the output range is local
-    // Copy local input subrange to local output range directly:
-    auto pattern            = out_first.pattern();
-    DASH_LOG_TRACE("dash::copy", "resolving local subrange");
-    DASH_LOG_TRACE_VAR("dash::copy", num_local_elem);
-    // Local index range to global output index range:
-    auto g_l_offset_begin   = pattern.global(li_range_out.begin);
-    DASH_LOG_TRACE_VAR("dash::copy", g_l_offset_begin);
-    auto g_l_offset_end     = pattern.global(li_range_out.end-1)
-                              + 1; // pat.global(l_end) would be out of range
-    DASH_LOG_TRACE_VAR("dash::copy", g_l_offset_end);
-    // Offset of local subrange in output range
-    auto l_elem_offset      = g_l_offset_begin - out_first.pos();
-    DASH_LOG_TRACE_VAR("dash::copy",l_elem_offset);
-    // Convert local subrange of global output to native pointers:
-    ValueType * l_out_first = (out_first + l_elem_offset).local();
-    DASH_LOG_TRACE_VAR("dash::copy", l_out_first);
-    ValueType * l_out_last  = l_out_first + num_local_elem;
-    DASH_LOG_TRACE_VAR("dash::copy", l_out_last);
-    // ... [ ........ | ---- l ---- | ......... ] ...
-    //     ^          ^             ^           ^
-    //     out_first  l_out_first   l_out_last  out_last
-    out_last                = out_first + num_local_elem;
-    // Assert that all elements in local range have been copied:
-    DASH_LOG_TRACE("dash::copy", "copying local subrange");
-    DASH_LOG_TRACE_VAR("dash::copy", in_first);
+  return dash::copy_async(in_first, in_last, out_first).get();
+}
+
+/**
+ * Specialization of \c dash::copy_async as global-to-global asynchronous
+ * copy operation.
+ *
+ * Collective operation, must be called by all units in the team of the
+ * input range's pattern. Every unit transfers the elements in the local
+ * subrange of the input range. Waiting on the returned future
+ * synchronizes all units in the team.
+ */
+template <
+  typename ValueType = void,
+  class    GlobInputIt,
+  class    GlobOutputIt >
+dash::Future<GlobOutputIt> copy_async(
+  GlobInputIt   in_first,
+  GlobInputIt   in_last,
+  GlobOutputIt  out_first)
+{
+  DASH_LOG_TRACE("dash::copy_async()", "global to global");
+  auto & team     = in_first.pattern().team();
+  auto   out_last = out_first + dash::distance(in_first, in_last);
+  auto   out_gptr = out_first.dart_gptr();
+  dash::internal::copy_local_subrange_impl(
+    in_first, in_last, out_first,
+    typename GlobInputIt::has_view());
+  dash::Future<GlobOutputIt> fut_result([=, &team]() mutable {
     DASH_ASSERT_RETURNS(
-      std::copy(in_first + l_elem_offset,
-                in_first + l_elem_offset + num_local_elem,
-                l_out_first),
-      l_out_last);
-    // Copy to remote elements preceding the local subrange:
-    if (g_l_offset_begin > out_first.pos()) {
-      DASH_LOG_TRACE("dash::copy", "copy to global preceding local subrange");
-      out_last = dash::internal::copy_impl(
-                   in_first,
-                   in_first + l_elem_offset,
-                   out_first);
-    }
-    // Copy to remote elements succeeding the local subrange:
-    if (g_l_offset_end < out_h_last.pos()) {
-      DASH_LOG_TRACE("dash::copy", "copy to global succeeding local subrange");
-      out_last = dash::internal::copy_impl(
-                   in_first + l_elem_offset + num_local_elem,
-                   in_last,
-                   out_first + num_local_elem);
-    }
-  } else {
-    // All elements in output range are remote
-    DASH_LOG_TRACE("dash::copy", "no local subrange");
-    out_last = dash::internal::copy_impl(
-                 in_first,
-                 in_last,
-                 out_first);
-  }
-  return out_last;
+      dart_flush_all(out_gptr),
+      DART_OK);
+    team.barrier();
+    return out_last;
+  });
+  DASH_LOG_TRACE("dash::copy_async >", "returning future");
+  return fut_result;
 }
 
 /**
  * Specialization of \c dash::copy as global-to-global blocking copy
  * operation.
+ *
+ * Collective operation, must be called by all units in the team of the
+ * input range's pattern.
  */
 template <
-  typename ValueType,
-  class GlobInputIt,
-  class GlobOutputIt >
+  typename ValueType = void,
+  class    GlobInputIt,
+  class    GlobOutputIt >
 GlobOutputIt copy(
   GlobInputIt   in_first,
   GlobInputIt   in_last,
   GlobOutputIt  out_first)
 {
   DASH_LOG_TRACE("dash::copy()", "blocking, global to global");
-
-  // TODO:
-  // - Implement adapter for local-to-global dash::copy here
-  // - Return if global input range has no local sub-range
-
-  return GlobOutputIt();
+  return dash::copy_async(in_first, in_last, out_first).get();
 }
 
 #endif // DOXYGEN
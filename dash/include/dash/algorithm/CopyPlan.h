@@ -0,0 +1,247 @@
+#ifndef DASH__ALGORITHM__COPY_PLAN_H__
+#define DASH__ALGORITHM__COPY_PLAN_H__
+
+#include <dash/GlobIter.h>
+#include <dash/algorithm/LocalRange.h>
+#include <dash/Exception.h>
+#include <dash/internal/Logging.h>
+#include <dash/dart/if/dart_communication.h>
+
+#include <algorithm>
+#include <vector>
+#include <limits>
+
+namespace dash {
+
+/**
+ * Transfer schedule of a copy operation between a global range and a
+ * local buffer that is resolved once and can be executed repeatedly.
+ *
+ * On construction, the global range is split into runs of elements that
+ * are contiguous in the local memory of a unit. Runs at the calling unit
+ * are replayed as local copies, all other runs as a single get or put
+ * operation each. Executing the plan does not query the pattern of the
+ * global range.
+ *
+ * The global range and the local buffer must not be reallocated while
+ * the plan is in use.
+ *
+ * Example:
+ *
+ * \code
+ *     // Resolve halo exchange once:
+ *     dash::CopyPlan<double> halo(array.begin() + halo_offset,
+ *                                 array.begin() + halo_offset + nhalo,
+ *                                 halo_buffer);
+ *     for (int iter = 0; iter < niter; ++iter) {
+ *       halo.execute_async();
+ *       // Computation on inner elements
+ *       // ...
+ *       halo.wait();
+ *       // Computation on boundary elements
+ *       // ...
+ *     }
+ * \endcode
+ */
+template<typename ValueType>
+class CopyPlan
+{
+private:
+  typedef CopyPlan<ValueType> self_t;
+
+  /// Transfer of a run of elements between local and global memory
+  struct transfer_t {
+    /// Global pointer to the first element of the run
+    dart_gptr_t   gptr;
+    /// Pointer to the first element of the run in the local buffer
+    ValueType   * lptr;
+    /// Pointer to the first element of the run if it is local to the
+    /// calling unit, otherwise nullptr
+    ValueType   * gptr_local;
+    /// Number of elements in the run
+    size_t        nelem;
+  };
+
+public:
+  /**
+   * Creates a plan of a copy operation from the global range
+   * \c [in_first, in_last) to the local range beginning at \c out_first.
+   */
+  template<class GlobInputIt>
+  CopyPlan(
+    GlobInputIt   in_first,
+    GlobInputIt   in_last,
+    ValueType   * out_first)
+  : _get(true)
+  {
+    DASH_LOG_TRACE("CopyPlan(GlobInputIt,GlobInputIt,ValueType*)");
+    resolve(in_first, dash::distance(in_first, in_last), out_first);
+  }
+
+  /**
+   * Creates a plan of a copy operation from the local range
+   * \c [in_first, in_last) to the global range beginning at
+   * \c out_first.
+   */
+  template<class GlobOutputIt>
+  CopyPlan(
+    const ValueType * in_first,
+    const ValueType * in_last,
+    GlobOutputIt      out_first)
+  : _get(false)
+  {
+    DASH_LOG_TRACE("CopyPlan(ValueType*,ValueType*,GlobOutputIt)");
+    resolve(out_first, std::distance(in_first, in_last),
+            const_cast<ValueType *>(in_first));
+  }
+
+  CopyPlan(const self_t & other)                 = delete;
+  self_t & operator=(const self_t & other)       = delete;
+
+  ~CopyPlan()
+  {
+    if (_handles.size() > 0) {
+      DASH_LOG_ERROR("CopyPlan.~CopyPlan()",
+                     "destroyed with pending transfers");
+    }
+  }
+
+  /**
+   * Executes the copy operation and waits for its completion.
+   */
+  void execute()
+  {
+    execute_async();
+    wait();
+  }
+
+  /**
+   * Starts the copy operation. Local copies are completed before this
+   * function returns, remote transfers are completed by \c wait().
+   */
+  void execute_async()
+  {
+    DASH_LOG_TRACE("CopyPlan.execute_async()",
+                   "remote transfers:", _remote.size(),
+                   "local copies:",     _local.size());
+    if (_handles.size() > 0) {
+      DASH_THROW(
+        dash::exception::RuntimeError,
+        "CopyPlan.execute_async: previous execution not completed");
+    }
+    for (auto & t : _remote) {
+      dart_handle_t handle;
+      if (_get) {
+        DASH_ASSERT_RETURNS(
+          dart_get_handle(t.lptr, t.gptr, t.nelem * sizeof(ValueType),
+                          &handle),
+          DART_OK);
+      } else {
+        DASH_ASSERT_RETURNS(
+          dart_put_handle(t.gptr, t.lptr, t.nelem * sizeof(ValueType),
+                          &handle),
+          DART_OK);
+      }
+      if (handle != NULL) {
+        _handles.push_back(handle);
+      }
+    }
+    // Local copies overlap with remote transfers:
+    for (auto & t : _local) {
+      if (_get) {
+        std::copy(t.gptr_local, t.gptr_local + t.nelem, t.lptr);
+      } else {
+        std::copy(t.lptr, t.lptr + t.nelem, t.gptr_local);
+      }
+    }
+  }
+
+  /**
+   * Waits for completion of the transfers started by the last call of
+   * \c execute_async().
+   */
+  void wait()
+  {
+    if (_handles.size() == 0) {
+      return;
+    }
+    DASH_LOG_TRACE("CopyPlan.wait()", "handles:", _handles.size());
+    // Gets only require local completion:
+    dart_ret_t ret = _get
+                     ? dart_waitall_local(&_handles[0], _handles.size())
+                     : dart_waitall(&_handles[0], _handles.size());
+    _handles.clear();
+    if (ret != DART_OK) {
+      DASH_THROW(
+        dash::exception::RuntimeError,
+        "CopyPlan.wait: waiting for transfers failed");
+    }
+  }
+
+  /**
+   * Number of remote transfers issued in a single execution of the plan.
+   */
+  inline size_t num_remote_transfers() const
+  {
+    return _remote.size();
+  }
+
+  /**
+   * Number of local copies performed in a single execution of the plan.
+   */
+  inline size_t num_local_copies() const
+  {
+    return _local.size();
+  }
+
+private:
+  /**
+   * Splits the global range of \c nelem elements beginning at \c g_first
+   * into runs of elements that are contiguous in local memory of a unit.
+   */
+  template<class GlobIterType>
+  void resolve(
+    GlobIterType   g_first,
+    size_t         nelem,
+    ValueType    * l_first)
+  {
+    // MPI uses offset type int, do not transfer more than INT_MAX bytes:
+    size_t max_run = std::numeric_limits<int>::max() / sizeof(ValueType);
+    auto   g_it    = g_first;
+    size_t offset  = 0;
+    while (offset < nelem) {
+      transfer_t run;
+      run.gptr       = g_it.dart_gptr();
+      run.lptr       = l_first + offset;
+      run.gptr_local = g_it.local();
+      run.nelem      = dash::internal::global_run_length(
+                         g_it,
+                         static_cast<typename GlobIterType::index_type>(
+                           std::min(nelem - offset, max_run)));
+      g_it          += run.nelem;
+      if (run.gptr_local != nullptr) {
+        _local.push_back(run);
+      } else {
+        _remote.push_back(run);
+      }
+      offset += run.nelem;
+    }
+    DASH_LOG_TRACE("CopyPlan.resolve >",
+                   "remote transfers:", _remote.size(),
+                   "local copies:",     _local.size());
+  }
+
+private:
+  /// Whether elements are copied from global to local memory
+  bool                       _get;
+  /// Transfers of runs at other units
+  std::vector<transfer_t>    _remote;
+  /// Copies of runs at the calling unit
+  std::vector<transfer_t>    _local;
+  /// Handles of pending remote transfers
+  std::vector<dart_handle_t> _handles;
+};
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__COPY_PLAN_H__
@@ -0,0 +1,230 @@
+#ifndef DASH__ALGORITHM__EXECUTION_POLICY_H__
+#define DASH__ALGORITHM__EXECUTION_POLICY_H__
+
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+
+#ifdef DASH_ENABLE_OPENMP
+#include <omp.h>
+#endif
+
+namespace dash {
+
+/**
+ * Execution policy of the local phase of DASH algorithms: every unit
+ * processes the elements in its local subrange sequentially in a single
+ * thread.
+ * This is the behavior of algorithm variants without execution policy
+ * parameter.
+ *
+ * \see  dash::seq_local
+ *
+ * \ingroup  DashAlgorithms
+ */
+struct sequenced_local_policy { };
+
+/**
+ * Execution policy of the local phase of DASH algorithms: every unit
+ * partitions its local subrange into contiguous chunks of equal size that
+ * are processed by the threads of the unit. Within a chunk, operations on
+ * elements may be vectorized. Function objects passed to an algorithm
+ * must therefore be safe to be invoked concurrently.
+ *
+ * Threads are provided by OpenMP if DASH has been built with OpenMP
+ * support (\c DASH_ENABLE_OPENMP), otherwise the policy is equivalent to
+ * \c dash::seq_local. The number of threads is configured using the
+ * OpenMP environment, e.g. \c OMP_NUM_THREADS and \c OMP_PROC_BIND.
+ *
+ * Partitions only depend on the size of the local subrange and the number
+ * of threads, so a thread processes the same chunk of the same local
+ * range in every algorithm call. Initializing local memory using a
+ * parallel algorithm like \c dash::fill therefore places every chunk's
+ * memory pages at the NUMA domain of the thread that processes the chunk
+ * in subsequent calls (first-touch placement), provided that threads are
+ * bound to cores.
+ *
+ * All algorithms with a local phase accept the policy except
+ * \c dash::copy, which copies local elements in a single block transfer
+ * overlapped with the transfers of remote elements. The merge of received
+ * runs in \c dash::sort remains sequential.
+ *
+ * Example:
+ *
+ * \code
+ *     dash::fill(dash::par_unseq_local, array.begin(), array.end(), 0.0);
+ *     auto min = dash::min_element(dash::par_unseq_local,
+ *                                  array.begin(), array.end());
+ * \endcode
+ *
+ * \see  dash::par_unseq_local
+ *
+ * \ingroup  DashAlgorithms
+ */
+struct parallel_unsequenced_local_policy { };
+
+/**
+ * Sequential execution of local algorithm phases.
+ *
+ * \ingroup  DashAlgorithms
+ */
+constexpr sequenced_local_policy            seq_local { };
+
+/**
+ * Multi-threaded and vectorized execution of local algorithm phases.
+ *
+ * \ingroup  DashAlgorithms
+ */
+constexpr parallel_unsequenced_local_policy par_unseq_local { };
+
+/**
+ * Type trait to identify DASH execution policies, used to disambiguate
+ * algorithm overloads.
+ */
+template<class T>
+struct is_execution_policy
+: public std::false_type { };
+
+template<>
+struct is_execution_policy<sequenced_local_policy>
+: public std::true_type { };
+
+template<>
+struct is_execution_policy<parallel_unsequenced_local_policy>
+: public std::true_type { };
+
+namespace internal {
+
+/**
+ * Minimum number of local elements for which threads are spawned in
+ * parallel execution of local algorithm phases.
+ */
+const long LocalParallelMinElements = 4096;
+
+/**
+ * Maximum number of threads executing local algorithm phases in
+ * sequential execution.
+ */
+inline int local_max_threads(const sequenced_local_policy &)
+{
+  return 1;
+}
+
+/**
+ * Maximum number of threads executing local algorithm phases in parallel
+ * execution.
+ */
+inline int local_max_threads(const parallel_unsequenced_local_policy &)
+{
+#ifdef DASH_ENABLE_OPENMP
+  return omp_get_max_threads();
+#else
+  return 1;
+#endif
+}
+
+/**
+ * Bounds of the contiguous chunk of the index range \c [0, nelem)
+ * assigned to thread \c thread of \c nthreads threads.
+ * Chunk sizes differ by at most one element.
+ */
+template<typename IndexType>
+std::pair<IndexType, IndexType> local_partition(
+  IndexType nelem,
+  int       nthreads,
+  int       thread)
+{
+  IndexType chunk  = nelem / nthreads;
+  IndexType rem    = nelem % nthreads;
+  IndexType offset = thread * chunk +
+                     std::min<IndexType>(thread, rem);
+  return std::make_pair(offset, offset + chunk + (thread < rem ? 1 : 0));
+}
+
+/**
+ * Invokes \c chunk_func on the index range \c [begin, end) in the calling
+ * thread.
+ *
+ * \tparam  ChunkFunction  Function invoked with chunk bounds and thread
+ *                         index, <tt>void(IndexType, IndexType, int)</tt>
+ */
+template<
+  typename IndexType,
+  class    ChunkFunction >
+void for_each_chunk_local(
+  const sequenced_local_policy &,
+  IndexType                      begin,
+  IndexType                      end,
+  ChunkFunction                  chunk_func)
+{
+  if (begin < end) {
+    chunk_func(begin, end, 0);
+  }
+}
+
+/**
+ * Partitions the index range \c [begin, end) into one contiguous chunk
+ * per thread and invokes \c chunk_func on every non-empty chunk in the
+ * thread the chunk is assigned to.
+ * The thread index passed to \c chunk_func is less than
+ * \c local_max_threads(policy).
+ *
+ * \tparam  ChunkFunction  Function invoked with chunk bounds and thread
+ *                         index, <tt>void(IndexType, IndexType, int)</tt>
+ */
+template<
+  typename IndexType,
+  class    ChunkFunction >
+void for_each_chunk_local(
+  const parallel_unsequenced_local_policy &,
+  IndexType                                 begin,
+  IndexType                                 end,
+  ChunkFunction                             chunk_func)
+{
+  if (begin >= end) {
+    return;
+  }
+#ifdef DASH_ENABLE_OPENMP
+  IndexType nelem = end - begin;
+  #pragma omp parallel if (nelem >= LocalParallelMinElements)
+  {
+    int  nthreads = omp_get_num_threads();
+    int  thread   = omp_get_thread_num();
+    auto chunk    = local_partition(nelem, nthreads, thread);
+    if (chunk.first < chunk.second) {
+      chunk_func(begin + chunk.first, begin + chunk.second, thread);
+    }
+  }
+#else
+  chunk_func(begin, end, 0);
+#endif
+}
+
+/**
+ * Invokes \c func on every index in the range \c [begin, end) using the
+ * given execution policy.
+ */
+template<
+  class    ExecutionPolicy,
+  typename IndexType,
+  class    UnaryFunction >
+void for_each_index_local(
+  const ExecutionPolicy & policy,
+  IndexType               begin,
+  IndexType               end,
+  UnaryFunction           func)
+{
+  for_each_chunk_local(
+    policy, begin, end,
+    [&](IndexType chunk_begin, IndexType chunk_end, int) {
+      for (IndexType idx = chunk_begin; idx < chunk_end; ++idx) {
+        func(idx);
+      }
+    });
+}
+
+} // namespace internal
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__EXECUTION_POLICY_H__
@@ -4,8 +4,12 @@
 #include <dash/GlobIter.h>
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
+#include <dash/algorithm/ExecutionPolicy.h>
 #include <dash/dart/if/dart_communication.h>
 
+#include <algorithm>
+#include <type_traits>
+
 namespace dash {
 
 /**
@@ -35,6 +39,49 @@ void fill(
   std::fill(lfirst, llast, value);
 }
 
+/**
+ * Assigns the given value to the elements in the range [first, last),
+ * using the given execution policy for the local phase.
+ *
+ * Filling a newly allocated range with \c dash::par_unseq_local places
+ * local memory pages at the NUMA domains of the threads that process
+ * them in subsequent parallel algorithm calls.
+ *
+ * \tparam      ExecutionPolicy  Execution policy of local phase, e.g.
+ *                               \c dash::par_unseq_local
+ * \complexity  O(d) + O(nl / t), with \c d dimensions in the global
+ *              iterators' pattern, \c nl local elements within the global
+ *              range and \c t threads per unit
+ *
+ * \ingroup     DashAlgorithms
+ */
+template<
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    PatternType>
+typename std::enable_if<
+  dash::is_execution_policy<ExecutionPolicy>::value >::type
+fill(
+  /// Execution policy of the local phase
+  const ExecutionPolicy               & policy,
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType>  first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType>  last,
+  /// Value which will be assigned to the elements in range [first, last)
+  const ElementType & value) {
+  typedef typename PatternType::index_type index_t;
+  auto          index_range = dash::local_range(first, last);
+  ElementType * lfirst      = index_range.begin;
+  dash::internal::for_each_chunk_local(
+    policy,
+    static_cast<index_t>(0),
+    static_cast<index_t>(index_range.end - lfirst),
+    [&](index_t chunk_begin, index_t chunk_end, int) {
+      std::fill(lfirst + chunk_begin, lfirst + chunk_end, value);
+    });
+}
+
 } // namespace dash
 
 #endif // DASH__ALGORITHM__FILL_H__
@@ -0,0 +1,699 @@
+#ifndef DASH__ALGORITHM__FIND_H__
+#define DASH__ALGORITHM__FIND_H__
+
+#include <dash/GlobIter.h>
+#include <dash/GlobMem.h>
+#include <dash/Team.h>
+#include <dash/Exception.h>
+#include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/ExecutionPolicy.h>
+#include <dash/internal/Logging.h>
+#include <dash/dart/if/dart_communication.h>
+
+#include <algorithm>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace dash {
+
+namespace internal {
+
+/**
+ * Number of local elements scanned between two polls of the search
+ * state published by other units.
+ */
+const long FindPollInterval = 4096;
+
+/**
+ * State of a collective search that allows units to stop scanning their
+ * local range once another unit has published a match that precedes all
+ * remaining local elements.
+ *
+ * The smallest offset of a match found so far is stored at unit 0 and
+ * updated with atomic minimum accumulation. Units poll it with
+ * non-blocking reads while scanning.
+ */
+class FindState
+{
+public:
+  FindState(
+    dash::Team & team,
+    long         nelem)
+  : _mem(team, 1),
+    _team_id(team.dart_id()),
+    _best(nelem),
+    _poll_handle(NULL)
+  {
+    _best_gptr = _mem.index_to_gptr(0, 0);
+    *_mem.lbegin(team.myid()) = nelem;
+    team.barrier();
+  }
+
+  ~FindState()
+  {
+    if (_poll_handle != NULL) {
+      dart_wait_local(_poll_handle);
+    }
+  }
+
+  /**
+   * Publishes a match at the given offset in the range.
+   */
+  void publish(long offset)
+  {
+    DASH_ASSERT_RETURNS(
+      dart_accumulate(
+        _best_gptr,
+        reinterpret_cast<char *>(&offset),
+        1,
+        DART_TYPE_LONG,
+        DART_OP_MIN,
+        _team_id),
+      DART_OK);
+    DASH_ASSERT_RETURNS(
+      dart_flush(_best_gptr),
+      DART_OK);
+    _best = std::min(_best, offset);
+  }
+
+  /**
+   * Smallest offset of a match published by any unit that has been
+   * received so far, does not block.
+   * Issues a new read of the published offset once the previous read has
+   * completed.
+   */
+  long poll()
+  {
+    if (_poll_handle != NULL) {
+      int32_t finished = 0;
+      DASH_ASSERT_RETURNS(
+        dart_test_local(_poll_handle, &finished),
+        DART_OK);
+      if (!finished) {
+        return _best;
+      }
+      dart_wait_local(_poll_handle);
+      _best = std::min(_best, _polled);
+    }
+    DASH_ASSERT_RETURNS(
+      dart_get_handle(&_polled, _best_gptr, sizeof(long), &_poll_handle),
+      DART_OK);
+    return _best;
+  }
+
+private:
+  /// Smallest published offset at unit 0
+  dash::GlobMem<long> _mem;
+  /// Global pointer to the smallest published offset
+  dart_gptr_t         _best_gptr;
+  /// Team performing the search
+  dart_team_t         _team_id;
+  /// Smallest offset of a match known to the calling unit
+  long                _best;
+  /// Receive buffer of pending read of the published offset
+  long                _polled;
+  /// Handle of pending read of the published offset
+  dart_handle_t       _poll_handle;
+};
+
+/**
+ * Offset of the match with the smallest global index in the local index
+ * range [l_begin, l_end) relative to global offset \c g_first, or
+ * \c nelem if there is no match.
+ * Every thread scans its chunk, chunk matches are combined in the order
+ * of chunks.
+ */
+template<
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    PatternType,
+  class    UnaryPredicate >
+long find_local(
+  const ExecutionPolicy            & policy,
+  const PatternType                & pattern,
+  const ElementType                * lbegin,
+  typename PatternType::index_type   l_begin,
+  typename PatternType::index_type   l_end,
+  long                               g_first,
+  long                               nelem,
+  UnaryPredicate                   & pred)
+{
+  typedef typename PatternType::index_type index_t;
+  std::vector<long> chunk_matches(local_max_threads(policy), nelem);
+  for_each_chunk_local(
+    policy, l_begin, l_end,
+    [&](index_t chunk_begin, index_t chunk_end, int thread) {
+      if (PatternType::ndim() == 1) {
+        // Local elements are ordered by global index:
+        auto l_hit = std::find_if(lbegin + chunk_begin,
+                                  lbegin + chunk_end, pred);
+        if (l_hit != lbegin + chunk_end) {
+          chunk_matches[thread] =
+            static_cast<long>(pattern.global(l_hit - lbegin)) - g_first;
+        }
+        return;
+      }
+      // Local order differs from global order, the local candidate is
+      // the match with the smallest global index:
+      long match = nelem;
+      for (index_t l_idx = chunk_begin; l_idx < chunk_end; ++l_idx) {
+        if (pred(lbegin[l_idx])) {
+          match = std::min<long>(
+                    match,
+                    static_cast<long>(pattern.global(l_idx)) - g_first);
+        }
+      }
+      chunk_matches[thread] = match;
+    });
+  return *std::min_element(chunk_matches.begin(), chunk_matches.end());
+}
+
+/**
+ * Implementation of the collective search algorithms.
+ *
+ * Every unit scans its local subrange in chunks. In one-dimensional
+ * patterns, local elements are ordered by global index so the first local
+ * match is the unit's candidate and a unit stops scanning as soon as a
+ * match preceding its remaining elements has been published. If
+ * \c any_match is set, every published match terminates the search.
+ * The first match is agreed on in a minimum reduction of the offsets of
+ * the units' candidates.
+ * Chunks are scanned by the threads of the unit in parallel execution,
+ * the search state is polled once per chunk.
+ *
+ * \returns  Offset of the first match in the range, or the number of
+ *           elements in the range if there is no match.
+ */
+template<
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    PatternType,
+  class    UnaryPredicate >
+long find_impl(
+  const ExecutionPolicy                    & policy,
+  const GlobIter<ElementType, PatternType> & first,
+  const GlobIter<ElementType, PatternType> & last,
+  UnaryPredicate                             pred,
+  bool                                       any_match)
+{
+  typedef typename PatternType::index_type index_t;
+  long nelem = dash::distance(first, last);
+  if (nelem <= 0) {
+    return 0;
+  }
+  auto & pattern     = first.pattern();
+  auto & team        = pattern.team();
+  auto   myid        = team.myid();
+  long   g_first     = first.pos();
+  bool   ordered     = PatternType::ndim() == 1;
+  // Collective allocation of the search state only pays off for ranges
+  // with several poll intervals per unit:
+  bool   early_exit  = (ordered || any_match) &&
+                       nelem > static_cast<long>(team.size()) *
+                               FindPollInterval * 2;
+  std::unique_ptr<FindState> state;
+  if (early_exit) {
+    state.reset(new FindState(team, nelem));
+  }
+  auto                l_idx_range = dash::local_index_range(first, last);
+  const ElementType * lbegin      = first.globmem().lbegin(myid);
+  long                l_match     = nelem;
+  // Every thread scans a poll interval of elements per chunk:
+  index_t             l_chunk_len = FindPollInterval *
+                                    local_max_threads(policy);
+  for (index_t l_chunk = l_idx_range.begin;
+       l_chunk < l_idx_range.end;
+       l_chunk += l_chunk_len) {
+    if (early_exit) {
+      long best = state->poll();
+      if (best < nelem &&
+          (any_match ||
+           best < static_cast<long>(pattern.global(l_chunk)) - g_first)) {
+        DASH_LOG_TRACE("dash::find_impl", "early exit at local index",
+                       l_chunk, "published match:", best);
+        break;
+      }
+    }
+    index_t l_chunk_end = std::min<index_t>(l_chunk + l_chunk_len,
+                                            l_idx_range.end);
+    long chunk_match = find_local(policy, pattern, lbegin,
+                                  l_chunk, l_chunk_end, g_first, nelem,
+                                  pred);
+    l_match = std::min(l_match, chunk_match);
+    if (l_match < nelem && (ordered || any_match)) {
+      break;
+    }
+  }
+  if (early_exit && l_match < nelem) {
+    state->publish(l_match);
+  }
+  long g_match = nelem;
+  DASH_ASSERT_RETURNS(
+    dart_allreduce(&l_match, &g_match, 1, DART_TYPE_LONG, DART_OP_MIN,
+                   team.dart_id()),
+    DART_OK);
+  DASH_LOG_TRACE("dash::find_impl >", "match offset:", g_match);
+  return g_match;
+}
+
+} // namespace internal
+
+/**
+ * Returns an iterator to the first element in the range [first,last)
+ * for which the predicate \c pred returns \c true, using the given
+ * execution policy for the local phase.
+ *
+ * Collective operation, must be called by all units in the team of the
+ * range's pattern. Every unit scans its local subrange, units stop
+ * scanning once a unit has found a match at a lower global index.
+ * All units agree on the first match in a single reduction.
+ *
+ * \returns  Iterator to the first matching element, or \c last if no
+ *           element matches
+ *
+ * \tparam   ExecutionPolicy  Execution policy of local phase, e.g.
+ *                            \c dash::par_unseq_local
+ * \tparam   UnaryPredicate   Predicate type, inlined in the local scan
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    PatternType,
+  class    UnaryPredicate >
+typename std::enable_if<
+  dash::is_execution_policy<ExecutionPolicy>::value,
+  GlobIter<ElementType, PatternType> >::type
+find_if(
+  /// Execution policy of the local phase
+  const ExecutionPolicy                    & policy,
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & last,
+  /// Predicate applied to elements
+  UnaryPredicate                             pred)
+{
+  DASH_LOG_DEBUG("dash::find_if()");
+  return first + internal::find_impl(policy, first, last, pred, false);
+}
+
+/**
+ * Returns an iterator to the first element in the range [first,last)
+ * for which the predicate \c pred returns \c true.
+ *
+ * Collective operation, must be called by all units in the team of the
+ * range's pattern.
+ *
+ * \returns  Iterator to the first matching element, or \c last if no
+ *           element matches
+ *
+ * \see      dash::find_if
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  typename ElementType,
+  class    PatternType,
+  class    UnaryPredicate >
+GlobIter<ElementType, PatternType> find_if(
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & last,
+  /// Predicate applied to elements
+  UnaryPredicate                             pred)
+{
+  return dash::find_if(dash::seq_local, first, last, pred);
+}
+
+/**
+ * Returns an iterator to the first element in the range [first,last)
+ * that is equal to \c value, using the given execution policy for the
+ * local phase.
+ *
+ * Collective operation.
+ *
+ * \see      dash::find_if
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    PatternType >
+typename std::enable_if<
+  dash::is_execution_policy<ExecutionPolicy>::value,
+  GlobIter<ElementType, PatternType> >::type
+find(
+  /// Execution policy of the local phase
+  const ExecutionPolicy                    & policy,
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & last,
+  /// Value to find
+  const ElementType                        & value)
+{
+  return dash::find_if(policy, first, last,
+                       [&](const ElementType & e) { return e == value; });
+}
+
+/**
+ * Returns an iterator to the first element in the range [first,last)
+ * that is equal to \c value.
+ *
+ * Collective operation.
+ *
+ * \see      dash::find_if
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  typename ElementType,
+  class    PatternType >
+GlobIter<ElementType, PatternType> find(
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & last,
+  /// Value to find
+  const ElementType                        & value)
+{
+  return dash::find(dash::seq_local, first, last, value);
+}
+
+/**
+ * Returns the number of elements in the range [first,last) for which
+ * the predicate \c pred returns \c true, using the given execution
+ * policy for the local phase.
+ *
+ * Collective operation, must be called by all units in the team of the
+ * range's pattern.
+ *
+ * \tparam   ExecutionPolicy  Execution policy of local phase, e.g.
+ *                            \c dash::par_unseq_local
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    PatternType,
+  class    UnaryPredicate >
+typename std::enable_if<
+  dash::is_execution_policy<ExecutionPolicy>::value,
+  typename PatternType::size_type >::type
+count_if(
+  /// Execution policy of the local phase
+  const ExecutionPolicy                    & policy,
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & last,
+  /// Predicate applied to elements
+  UnaryPredicate                             pred)
+{
+  typedef typename PatternType::index_type index_t;
+  DASH_LOG_DEBUG("dash::count_if()");
+  auto & team        = first.pattern().team();
+  auto   l_idx_range = dash::local_index_range(first, last);
+  const ElementType * lbegin = first.globmem().lbegin(team.myid());
+  // Count of every thread's chunk:
+  std::vector<long> chunk_counts(internal::local_max_threads(policy), 0);
+  internal::for_each_chunk_local(
+    policy, l_idx_range.begin, l_idx_range.end,
+    [&](index_t chunk_begin, index_t chunk_end, int thread) {
+      chunk_counts[thread] = std::count_if(lbegin + chunk_begin,
+                                           lbegin + chunk_end,
+                                           pred);
+    });
+  long l_count = 0;
+  for (auto chunk_count : chunk_counts) {
+    l_count += chunk_count;
+  }
+  long g_count = 0;
+  DASH_ASSERT_RETURNS(
+    dart_allreduce(&l_count, &g_count, 1, DART_TYPE_LONG, DART_OP_SUM,
+                   team.dart_id()),
+    DART_OK);
+  return g_count;
+}
+
+/**
+ * Returns the number of elements in the range [first,last) for which
+ * the predicate \c pred returns \c true.
+ *
+ * Collective operation, must be called by all units in the team of the
+ * range's pattern.
+ *
+ * \see      dash::count_if
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  typename ElementType,
+  class    PatternType,
+  class    UnaryPredicate >
+typename PatternType::size_type count_if(
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & last,
+  /// Predicate applied to elements
+  UnaryPredicate                             pred)
+{
+  return dash::count_if(dash::seq_local, first, last, pred);
+}
+
+/**
+ * Returns the number of elements in the range [first,last) that are
+ * equal to \c value, using the given execution policy for the local
+ * phase.
+ *
+ * Collective operation.
+ *
+ * \see      dash::count_if
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    PatternType >
+typename std::enable_if<
+  dash::is_execution_policy<ExecutionPolicy>::value,
+  typename PatternType::size_type >::type
+count(
+  /// Execution policy of the local phase
+  const ExecutionPolicy                    & policy,
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & last,
+  /// Value to count
+  const ElementType                        & value)
+{
+  return dash::count_if(policy, first, last,
+                        [&](const ElementType & e) { return e == value; });
+}
+
+/**
+ * Returns the number of elements in the range [first,last) that are
+ * equal to \c value.
+ *
+ * Collective operation.
+ *
+ * \see      dash::count_if
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  typename ElementType,
+  class    PatternType >
+typename PatternType::size_type count(
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & last,
+  /// Value to count
+  const ElementType                        & value)
+{
+  return dash::count(dash::seq_local, first, last, value);
+}
+
+/**
+ * Whether the predicate \c pred returns \c true for any element in the
+ * range [first,last), using the given execution policy for the local
+ * phase.
+ *
+ * Collective operation, units stop scanning their local subrange once
+ * any unit has found a match.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    PatternType,
+  class    UnaryPredicate >
+typename std::enable_if<
+  dash::is_execution_policy<ExecutionPolicy>::value, bool >::type
+any_of(
+  /// Execution policy of the local phase
+  const ExecutionPolicy                    & policy,
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & last,
+  /// Predicate applied to elements
+  UnaryPredicate                             pred)
+{
+  DASH_LOG_DEBUG("dash::any_of()");
+  return internal::find_impl(policy, first, last, pred, true) <
+         dash::distance(first, last);
+}
+
+/**
+ * Whether the predicate \c pred returns \c true for any element in the
+ * range [first,last).
+ *
+ * Collective operation.
+ *
+ * \see      dash::any_of
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  typename ElementType,
+  class    PatternType,
+  class    UnaryPredicate >
+bool any_of(
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & last,
+  /// Predicate applied to elements
+  UnaryPredicate                             pred)
+{
+  return dash::any_of(dash::seq_local, first, last, pred);
+}
+
+/**
+ * Whether the predicate \c pred returns \c true for all elements in the
+ * range [first,last), or the range is empty, using the given execution
+ * policy for the local phase.
+ *
+ * Collective operation.
+ *
+ * \see      dash::any_of
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    PatternType,
+  class    UnaryPredicate >
+typename std::enable_if<
+  dash::is_execution_policy<ExecutionPolicy>::value, bool >::type
+all_of(
+  /// Execution policy of the local phase
+  const ExecutionPolicy                    & policy,
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & last,
+  /// Predicate applied to elements
+  UnaryPredicate                             pred)
+{
+  return !dash::any_of(policy, first, last,
+                       [&](const ElementType & e) { return !pred(e); });
+}
+
+/**
+ * Whether the predicate \c pred returns \c true for all elements in the
+ * range [first,last), or the range is empty.
+ *
+ * Collective operation.
+ *
+ * \see      dash::any_of
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  typename ElementType,
+  class    PatternType,
+  class    UnaryPredicate >
+bool all_of(
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & last,
+  /// Predicate applied to elements
+  UnaryPredicate                             pred)
+{
+  return dash::all_of(dash::seq_local, first, last, pred);
+}
+
+/**
+ * Whether the predicate \c pred returns \c false for all elements in the
+ * range [first,last), or the range is empty, using the given execution
+ * policy for the local phase.
+ *
+ * Collective operation.
+ *
+ * \see      dash::any_of
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    PatternType,
+  class    UnaryPredicate >
+typename std::enable_if<
+  dash::is_execution_policy<ExecutionPolicy>::value, bool >::type
+none_of(
+  /// Execution policy of the local phase
+  const ExecutionPolicy                    & policy,
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & last,
+  /// Predicate applied to elements
+  UnaryPredicate                             pred)
+{
+  return !dash::any_of(policy, first, last, pred);
+}
+
+/**
+ * Whether the predicate \c pred returns \c false for all elements in the
+ * range [first,last), or the range is empty.
+ *
+ * Collective operation.
+ *
+ * \see      dash::any_of
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  typename ElementType,
+  class    PatternType,
+  class    UnaryPredicate >
+bool none_of(
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & last,
+  /// Predicate applied to elements
+  UnaryPredicate                             pred)
+{
+  return dash::none_of(dash::seq_local, first, last, pred);
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__FIND_H__
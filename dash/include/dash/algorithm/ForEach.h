@@ -3,18 +3,103 @@
 
 #include <dash/GlobIter.h>
 #include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/ExecutionPolicy.h>
 #include <dash/internal/Logging.h>
 
+#include <type_traits>
+
 namespace dash {
 
+namespace internal {
+
+/**
+ * Invokes \c func on every local element in the local index range
+ * \c [l_begin, l_end) with the element's local and global index.
+ *
+ * Global indices are resolved once per run of local elements that are
+ * contiguous in global index space, e.g. once per block in a
+ * one-dimensional pattern, and incremented for elements within the run.
+ */
+template<
+  class ExecutionPolicy,
+  class PatternType,
+  class BinaryFunction >
+void for_each_local_index(
+  const ExecutionPolicy            & policy,
+  const PatternType                & pattern,
+  typename PatternType::index_type   l_begin,
+  typename PatternType::index_type   l_end,
+  /// Function invoked with local and global index of every element
+  BinaryFunction                     func)
+{
+  typedef typename PatternType::index_type index_t;
+  for_each_chunk_local(
+    policy, l_begin, l_end,
+    [&](index_t chunk_begin, index_t chunk_end, int) {
+      for (index_t l_run = chunk_begin; l_run < chunk_end; ) {
+        index_t g_run = pattern.global(l_run);
+        index_t nrun  = local_run_length(pattern, l_run, chunk_end, g_run);
+        for (index_t i = 0; i < nrun; ++i) {
+          func(l_run + i, g_run + i);
+        }
+        l_run += nrun;
+      }
+    });
+}
+
+} // namespace internal
+
+/**
+ * Invoke a function on every element in a range distributed by a pattern,
+ * using the given execution policy for the local phase.
+ * Being a collaborative operation, each unit will invoke the given
+ * function on its local elements only.
+ *
+ * \tparam      ExecutionPolicy  Execution policy of local phase, e.g.
+ *                               \c dash::par_unseq_local
+ * \tparam      UnaryFunction    Function invoked with the global index of
+ *                               every element, may be invoked concurrently
+ *                               for \c dash::par_unseq_local
+ * \complexity  O(d) + O(nl / t), with \c d dimensions in the global
+ *              iterators' pattern, \c nl local elements within the global
+ *              range and \c t threads per unit
+ *
+ * \ingroup     DashAlgorithms
+ */
+template<
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    PatternType,
+  class    UnaryFunction >
+typename std::enable_if<
+  dash::is_execution_policy<ExecutionPolicy>::value >::type
+for_each(
+  /// Execution policy of the local phase
+  const ExecutionPolicy                    & policy,
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & last,
+  /// Function to invoke on every index in the range
+  UnaryFunction                              func) {
+  typedef typename PatternType::index_type index_t;
+  auto index_range = dash::local_index_range(first, last);
+  dash::internal::for_each_local_index(
+    policy, first.pattern(), index_range.begin, index_range.end,
+    [&](index_t, index_t gindex) {
+      func(gindex);
+    });
+}
+
 /**
  * Invoke a function on every element in a range distributed by a pattern.
  * Being a collaborative operation, each unit will invoke the given
  * function on its local elements only.
  *
- * \tparam      ElementType  Type of the elements in the sequence
- * \tparam      IndexType    Parameter type expected by function to
- *                           invoke, deduced from parameter \c func
+ * \tparam      ElementType    Type of the elements in the sequence
+ * \tparam      UnaryFunction  Function invoked with the global index of
+ *                             every element, any callable like a lambda
+ *                             or \c std::function
  * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
  *              pattern and \c nl local elements within the global range
  *
@@ -22,32 +107,65 @@ namespace dash {
  */
 template<
   typename ElementType,
-  typename IndexType,
-  class PatternType>
+  class    PatternType,
+  class    UnaryFunction >
 void for_each(
   /// Iterator to the initial position in the sequence
   const GlobIter<ElementType, PatternType> & first,
   /// Iterator to the final position in the sequence
   const GlobIter<ElementType, PatternType> & last,
   /// Function to invoke on every index in the range
-  ::std::function<void(IndexType)> & func) {
-  /// Global iterators to local index range:
-  auto index_range  = dash::local_index_range(first, last);
-  auto lbegin_index = index_range.begin;
-  auto lend_index   = index_range.end;
-  if (lbegin_index == lend_index) {
-    // Local range is empty
-    return;
-  }
-  // Pattern from global begin iterator:
-  auto pattern = first.pattern();
-  // Iterate local index range:
-  for (IndexType lindex = lbegin_index;
-       lindex != lend_index;
-       ++lindex) {
-    IndexType gindex = pattern.global(lindex);
-    func(gindex);
-  }
+  UnaryFunction                              func) {
+  dash::for_each(dash::seq_local, first, last, func);
+}
+
+/**
+ * Invoke a function on every element in a range distributed by a pattern,
+ * using the given execution policy for the local phase.
+ * Being a collaborative operation, each unit will invoke the given
+ * function on its local elements only.
+ *
+ * Elements are passed to the function from local memory, no global
+ * references are created.
+ *
+ * \tparam      ExecutionPolicy  Execution policy of local phase, e.g.
+ *                               \c dash::par_unseq_local
+ * \tparam      BinaryFunction   Function invoked with every element and
+ *                               its global index, may be invoked
+ *                               concurrently for \c dash::par_unseq_local
+ * \complexity  O(d) + O(nl / t), with \c d dimensions in the global
+ *              iterators' pattern, \c nl local elements within the global
+ *              range and \c t threads per unit
+ *
+ * \ingroup     DashAlgorithms
+ */
+template<
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    PatternType,
+  class    BinaryFunction >
+typename std::enable_if<
+  dash::is_execution_policy<ExecutionPolicy>::value >::type
+for_each_with_index(
+  /// Execution policy of the local phase
+  const ExecutionPolicy                    & policy,
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & last,
+  /// Function to invoke on every element and its index in the range
+  BinaryFunction                             func) {
+  typedef typename PatternType::index_type index_t;
+  auto & pattern     = first.pattern();
+  auto   index_range = dash::local_index_range(first, last);
+  // Local elements are accessed in local memory:
+  const ElementType * lbegin = first.globmem().lbegin(
+                                 pattern.team().myid());
+  dash::internal::for_each_local_index(
+    policy, pattern, index_range.begin, index_range.end,
+    [&](index_t lindex, index_t gindex) {
+      func(lbegin[lindex], gindex);
+    });
 }
 
 /**
@@ -55,9 +173,13 @@ void for_each(
  * Being a collaborative operation, each unit will invoke the given
  * function on its local elements only.
  *
- * \tparam      ElementType  Type of the elements in the sequence
- * \tparam      IndexType    Parameter type expected by function to
- *                           invoke, deduced from parameter \c func
+ * Elements are passed to the function from local memory, no global
+ * references are created.
+ *
+ * \tparam      ElementType     Type of the elements in the sequence
+ * \tparam      BinaryFunction  Function invoked with every element and its
+ *                              global index, any callable like a lambda
+ *                              or \c std::function
  * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
  *              pattern and \c nl local elements within the global range
  *
@@ -65,34 +187,16 @@ void for_each(
  */
 template<
   typename ElementType,
-  typename IndexType,
-  class PatternType>
+  class    PatternType,
+  class    BinaryFunction >
 void for_each_with_index(
   /// Iterator to the initial position in the sequence
   const GlobIter<ElementType, PatternType> & first,
   /// Iterator to the final position in the sequence
   const GlobIter<ElementType, PatternType> & last,
-  /// Function to invoke on every index in the range
-  ::std::function<void(const ElementType &, IndexType)> & func) {
-  /// Global iterators to local index range:
-  auto index_range  = dash::local_index_range(first, last);
-  auto lbegin_index = index_range.begin;
-  auto lend_index   = index_range.end;
-  if (lbegin_index == lend_index) {
-    // Local range is empty
-    return;
-  }
-  // Pattern from global begin iterator:
-  auto pattern = first.pattern();
-  // Iterate local index range:
-  for (IndexType lindex = lbegin_index;
-       lindex != lend_index;
-       ++lindex) {
-    IndexType gindex  = pattern.global(lindex);
-    auto first_offset = first.pos();
-    auto element_it   = first + (gindex - first_offset);
-    func(*element_it, gindex);
-  }
+  /// Function to invoke on every element and its index in the range
+  BinaryFunction                             func) {
+  dash::for_each_with_index(dash::seq_local, first, last, func);
 }
 
 } // namespace dash
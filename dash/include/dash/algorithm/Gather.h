@@ -0,0 +1,415 @@
+#ifndef DASH__ALGORITHM__GATHER_H__
+#define DASH__ALGORITHM__GATHER_H__
+
+#include <dash/GlobIter.h>
+#include <dash/Future.h>
+#include <dash/Types.h>
+#include <dash/Exception.h>
+#include <dash/algorithm/Operation.h>
+#include <dash/internal/Logging.h>
+#include <dash/dart/if/dart_communication.h>
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace dash {
+
+namespace internal {
+
+/**
+ * Access to a single element in an indexed transfer.
+ */
+template<typename IndexType>
+struct indexed_access_t {
+  /// Unit owning the element, relative to the pattern's team
+  dart_unit_t unit;
+  /// Local index of the element at its owner
+  IndexType   lindex;
+  /// Position of the access in the index sequence
+  size_t      pos;
+};
+
+/**
+ * Resolves the owners and local indices of the elements at the given
+ * offsets relative to \c first. Accesses to elements in local memory are
+ * passed to \c local_func with the element's local index and position in
+ * the index sequence, all other accesses are returned grouped by owner
+ * unit and sorted by local index. The order of accesses to the same
+ * element is preserved.
+ */
+template<
+  typename ElementType,
+  class    PatternType,
+  class    IndexIt,
+  class    LocalFunction >
+std::vector< indexed_access_t<typename PatternType::index_type> >
+remote_accesses(
+  const GlobIter<ElementType, PatternType> & first,
+  IndexIt                                    index_first,
+  IndexIt                                    index_last,
+  bool                                       include_local,
+  LocalFunction                              local_func)
+{
+  typedef typename PatternType::index_type index_t;
+  auto & pattern = first.pattern();
+  auto   myid    = pattern.team().myid();
+  auto   g_first = first.pos();
+  std::vector< indexed_access_t<index_t> > accesses;
+  accesses.reserve(std::distance(index_first, index_last));
+  size_t pos = 0;
+  for (auto it = index_first; it != index_last; ++it, ++pos) {
+    auto l_pos = pattern.local(static_cast<index_t>(g_first + *it));
+    if (l_pos.unit == myid && !include_local) {
+      local_func(l_pos.index, pos);
+    } else {
+      accesses.push_back(
+        indexed_access_t<index_t> { l_pos.unit, l_pos.index, pos });
+    }
+  }
+  std::stable_sort(
+    accesses.begin(), accesses.end(),
+    [](const indexed_access_t<index_t> & a,
+       const indexed_access_t<index_t> & b) {
+      return (a.unit < b.unit) ||
+             (a.unit == b.unit && a.lindex < b.lindex);
+    });
+  return accesses;
+}
+
+/**
+ * Invokes \c run_func on the bounds of every run of sorted accesses to
+ * contiguous elements at the same owner unit. Accesses to the same
+ * element are contained in a single run.
+ */
+template<
+  typename IndexType,
+  class    RunFunction >
+void for_each_access_run(
+  const std::vector< indexed_access_t<IndexType> > & accesses,
+  RunFunction                                        run_func)
+{
+  size_t run_first = 0;
+  for (size_t a = 1; a <= accesses.size(); ++a) {
+    if (a < accesses.size() &&
+        accesses[a].unit == accesses[a - 1].unit &&
+        accesses[a].lindex - accesses[a - 1].lindex <= 1) {
+      continue;
+    }
+    if (run_first < a) {
+      run_func(run_first, a);
+    }
+    run_first = a;
+  }
+}
+
+/**
+ * Number of distinct elements in a sequence of sorted accesses.
+ */
+template<typename IndexType>
+size_t num_distinct_accesses(
+  const std::vector< indexed_access_t<IndexType> > & accesses)
+{
+  size_t ndistinct = 0;
+  for (size_t a = 0; a < accesses.size(); ++a) {
+    if (a == 0 ||
+        accesses[a].unit   != accesses[a - 1].unit ||
+        accesses[a].lindex != accesses[a - 1].lindex) {
+      ++ndistinct;
+    }
+  }
+  return ndistinct;
+}
+
+} // namespace internal
+
+/**
+ * Reads the elements at arbitrary offsets relative to \c first into a
+ * local buffer, \c out_first[i] = \c first[index_first[i]].
+ *
+ * Offsets are grouped by owner unit using the pattern and sorted by local
+ * index. Elements in local memory are copied immediately, every run of
+ * contiguous remote elements is read in a single non-blocking transfer.
+ * Elements requested more than once are transferred once.
+ *
+ * Example:
+ * \code
+ *     std::vector<long>   neighbors = adjacent_node_ids(v);
+ *     std::vector<node_t> nodes(neighbors.size());
+ *     auto fut = dash::gather(node_array.begin(),
+ *                             neighbors.begin(), neighbors.end(),
+ *                             nodes.data());
+ *     // ...
+ *     fut.wait();
+ * \endcode
+ *
+ * \returns  Future of the end of the output range, the output range is
+ *           valid once the future has completed
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  typename ElementType,
+  class    PatternType,
+  class    IndexIt >
+dash::Future<ElementType *> gather(
+  /// Global iterator offsets refer to, e.g. \c array.begin()
+  const GlobIter<ElementType, PatternType> & first,
+  /// Iterator to the initial offset of elements to read
+  IndexIt                                    index_first,
+  /// Iterator past the final offset of elements to read
+  IndexIt                                    index_last,
+  /// Pointer to the initial position of the output range
+  ElementType                              * out_first)
+{
+  typedef typename PatternType::index_type index_t;
+  DASH_LOG_DEBUG("dash::gather()");
+  auto & globmem  = first.globmem();
+  auto   myid     = first.pattern().team().myid();
+  const ElementType * lbegin = globmem.lbegin(myid);
+  auto   out_last = out_first + std::distance(index_first, index_last);
+  auto   accesses = dash::internal::remote_accesses(
+                      first, index_first, index_last, false,
+                      [&](index_t lindex, size_t pos) {
+                        out_first[pos] = lbegin[lindex];
+                      });
+  if (accesses.empty()) {
+    return dash::make_ready_future(out_last);
+  }
+  // Receive buffer of distinct remote elements in order of runs:
+  auto recv_buffer = std::make_shared< std::vector<ElementType> >(
+                       dash::internal::num_distinct_accesses(accesses));
+  // Position of every remote access in the receive buffer:
+  auto recv_pos    = std::make_shared<
+                       std::vector< std::pair<size_t, size_t> > >();
+  recv_pos->reserve(accesses.size());
+  std::vector<dart_handle_t> handles;
+  size_t buf_pos = 0;
+  dash::internal::for_each_access_run(
+    accesses,
+    [&](size_t a_first, size_t a_last) {
+      size_t run_begin = buf_pos;
+      for (size_t a = a_first; a < a_last; ++a) {
+        if (a > a_first && accesses[a].lindex == accesses[a - 1].lindex) {
+          --buf_pos;
+        }
+        recv_pos->push_back(std::make_pair(accesses[a].pos, buf_pos++));
+      }
+      dart_handle_t handle;
+      DASH_ASSERT_RETURNS(
+        dart_get_handle(
+          recv_buffer->data() + run_begin,
+          globmem.index_to_gptr(accesses[a_first].unit,
+                                accesses[a_first].lindex),
+          (buf_pos - run_begin) * sizeof(ElementType),
+          &handle),
+        DART_OK);
+      handles.push_back(handle);
+    });
+  DASH_LOG_TRACE("dash::gather >", "remote elements:", accesses.size(),
+                 "transfers:", handles.size());
+  return dash::Future<ElementType *>(
+           handles,
+           [=]() {
+             for (auto & pos : *recv_pos) {
+               out_first[pos.first] = (*recv_buffer)[pos.second];
+             }
+             return out_last;
+           });
+}
+
+/**
+ * Writes the values in a local buffer to the elements at arbitrary
+ * offsets relative to \c first, \c first[index_first[i]] =
+ * \c in_first[i].
+ *
+ * Offsets are grouped by owner unit using the pattern and sorted by local
+ * index. Elements in local memory are assigned immediately, every run of
+ * contiguous remote elements is written in a single non-blocking
+ * transfer. If an offset occurs more than once, the last value is
+ * stored.
+ *
+ * \returns  Future of the end of the input range, the values are stored
+ *           at their targets once the future has completed
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  typename ElementType,
+  class    PatternType,
+  class    IndexIt >
+dash::Future<const ElementType *> scatter(
+  /// Pointer to the initial position of the input range
+  const ElementType                        * in_first,
+  /// Iterator to the initial offset of elements to write
+  IndexIt                                    index_first,
+  /// Iterator past the final offset of elements to write
+  IndexIt                                    index_last,
+  /// Global iterator offsets refer to, e.g. \c array.begin()
+  const GlobIter<ElementType, PatternType> & first)
+{
+  typedef typename PatternType::index_type index_t;
+  DASH_LOG_DEBUG("dash::scatter()");
+  auto & globmem = first.globmem();
+  auto   myid    = first.pattern().team().myid();
+  ElementType * lbegin = const_cast<ElementType *>(globmem.lbegin(myid));
+  const ElementType * in_last = in_first +
+                                std::distance(index_first, index_last);
+  auto   accesses = dash::internal::remote_accesses(
+                      first, index_first, index_last, false,
+                      [&](index_t lindex, size_t pos) {
+                        lbegin[lindex] = in_first[pos];
+                      });
+  if (accesses.empty()) {
+    return dash::make_ready_future(in_last);
+  }
+  // Send buffer of distinct remote elements in order of runs, must remain
+  // valid until the transfers have completed:
+  auto send_buffer = std::make_shared< std::vector<ElementType> >();
+  send_buffer->reserve(dash::internal::num_distinct_accesses(accesses));
+  std::vector<dart_handle_t> handles;
+  dash::internal::for_each_access_run(
+    accesses,
+    [&](size_t a_first, size_t a_last) {
+      size_t run_begin = send_buffer->size();
+      for (size_t a = a_first; a < a_last; ++a) {
+        if (a > a_first && accesses[a].lindex == accesses[a - 1].lindex) {
+          // Last write to an element wins:
+          send_buffer->back() = in_first[accesses[a].pos];
+        } else {
+          send_buffer->push_back(in_first[accesses[a].pos]);
+        }
+      }
+      dart_handle_t handle;
+      DASH_ASSERT_RETURNS(
+        dart_put_handle(
+          globmem.index_to_gptr(accesses[a_first].unit,
+                                accesses[a_first].lindex),
+          send_buffer->data() + run_begin,
+          (send_buffer->size() - run_begin) * sizeof(ElementType),
+          &handle),
+        DART_OK);
+      handles.push_back(handle);
+    });
+  DASH_LOG_TRACE("dash::scatter >", "remote elements:", accesses.size(),
+                 "transfers:", handles.size());
+  return dash::Future<const ElementType *>(
+           handles,
+           [=]() {
+             // Send buffer is released with the continuation:
+             (void)(send_buffer);
+             return in_last;
+           },
+           true);
+}
+
+/**
+ * Combines the values in a local buffer with the elements at arbitrary
+ * offsets relative to \c first using a reduce operation,
+ * \c first[index_first[i]] = \c op(first[index_first[i]], in_first[i]).
+ *
+ * Updates of elements are atomic, concurrent calls of multiple units
+ * may update the same elements.
+ * Offsets are grouped by owner unit using the pattern and sorted by local
+ * index, values of the same element are combined locally. Every run of
+ * contiguous elements is updated in a single accumulate operation.
+ *
+ * Example:
+ * \code
+ *     // Histogram update:
+ *     std::vector<long> ones(bins.size(), 1);
+ *     dash::scatter_accumulate(ones.data(), bins.begin(), bins.end(),
+ *                              histogram.begin(), dash::plus<long>())
+ *       .wait();
+ * \endcode
+ *
+ * \returns  Future of the end of the input range, waiting on the future
+ *           completes the updates at their targets
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  typename ElementType,
+  class    PatternType,
+  class    IndexIt,
+  class    BinaryOperation >
+dash::Future<const ElementType *> scatter_accumulate(
+  /// Pointer to the initial position of the input range
+  const ElementType                        * in_first,
+  /// Iterator to the initial offset of elements to update
+  IndexIt                                    index_first,
+  /// Iterator past the final offset of elements to update
+  IndexIt                                    index_last,
+  /// Global iterator offsets refer to, e.g. \c array.begin()
+  const GlobIter<ElementType, PatternType> & first,
+  /// Reduce operation, e.g. \c dash::plus
+  BinaryOperation                            op)
+{
+  static_assert(dash::has_dart_datatype<ElementType>::value,
+                "scatter_accumulate requires element type with DART type");
+  DASH_LOG_DEBUG("dash::scatter_accumulate()");
+  auto & globmem = first.globmem();
+  auto   team_id = first.pattern().team().dart_id();
+  const ElementType * in_last = in_first +
+                                std::distance(index_first, index_last);
+  // Local elements are updated atomically, too:
+  auto   accesses = dash::internal::remote_accesses(
+                      first, index_first, index_last, true,
+                      [](typename PatternType::index_type, size_t) { });
+  if (accesses.empty()) {
+    return dash::make_ready_future(in_last);
+  }
+  std::vector<ElementType> send_buffer;
+  send_buffer.reserve(dash::internal::num_distinct_accesses(accesses));
+  std::vector<dart_gptr_t> targets;
+  dash::internal::for_each_access_run(
+    accesses,
+    [&](size_t a_first, size_t a_last) {
+      size_t run_begin = send_buffer.size();
+      for (size_t a = a_first; a < a_last; ++a) {
+        if (a > a_first && accesses[a].lindex == accesses[a - 1].lindex) {
+          send_buffer.back() = op(send_buffer.back(),
+                                  in_first[accesses[a].pos]);
+        } else {
+          send_buffer.push_back(in_first[accesses[a].pos]);
+        }
+      }
+      auto gptr = globmem.index_to_gptr(accesses[a_first].unit,
+                                        accesses[a_first].lindex);
+      DASH_ASSERT_RETURNS(
+        dart_accumulate(
+          gptr,
+          reinterpret_cast<char *>(send_buffer.data() + run_begin),
+          send_buffer.size() - run_begin,
+          dash::dart_datatype<ElementType>::value,
+          op.dart_operation(),
+          team_id),
+        DART_OK);
+      if (targets.empty() || targets.back().unitid != gptr.unitid) {
+        targets.push_back(gptr);
+      }
+    });
+  // Send buffer can be released once values have been sent:
+  for (auto & target : targets) {
+    DASH_ASSERT_RETURNS(
+      dart_flush_local(target),
+      DART_OK);
+  }
+  // There are no handles of accumulate operations, completion at the
+  // targets requires a blocking flush of every owner unit:
+  return dash::Future<const ElementType *>(
+           [=]() {
+             for (auto & target : targets) {
+               DASH_ASSERT_RETURNS(
+                 dart_flush(target),
+                 DART_OK);
+             }
+             return in_last;
+           });
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__GATHER_H__
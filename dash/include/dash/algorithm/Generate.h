@@ -4,8 +4,12 @@
 #include <dash/GlobIter.h>
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
+#include <dash/algorithm/ExecutionPolicy.h>
 #include <dash/dart/if/dart_communication.h>
 
+#include <algorithm>
+#include <type_traits>
+
 namespace dash {
 
 /**
@@ -38,6 +42,55 @@ void generate (
   std::generate(lfirst, llast, g);
 }
 
+/**
+ *  Assigns each element in range [first, last) a value generated by the
+ *  given function object g, using the given execution policy for the
+ *  local phase.
+ *
+ * \tparam      ExecutionPolicy  Execution policy of local phase, e.g.
+ *                               \c dash::par_unseq_local
+ * \tparam      Generator        Generator function, may be invoked
+ *                               concurrently in an unspecified order.
+ *                               Every chunk is assigned by a separate copy
+ *                               of \c g, so a stateful generator repeats
+ *                               its sequence in every chunk. Use
+ *                               \c dash::for_each_with_index to assign
+ *                               values depending on the element index.
+ * \complexity  O(d) + O(nl / t), with \c d dimensions in the global
+ *              iterators' pattern, \c nl local elements within the global
+ *              range and \c t threads per unit
+ *
+ * \ingroup     DashAlgorithms
+ */
+template<
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    PatternType,
+  class    Generator >
+typename std::enable_if<
+  dash::is_execution_policy<ExecutionPolicy>::value >::type
+generate (
+  /// Execution policy of the local phase
+  const ExecutionPolicy            & policy,
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType> first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType> last,
+  /// Generator function
+  Generator                          g)
+{
+  typedef typename PatternType::index_type index_t;
+  auto          lrange = dash::local_range(first, last);
+  ElementType * lfirst = lrange.begin;
+  dash::internal::for_each_chunk_local(
+    policy,
+    static_cast<index_t>(0),
+    static_cast<index_t>(lrange.end - lfirst),
+    [&](index_t chunk_begin, index_t chunk_end, int) {
+      std::generate(lfirst + chunk_begin, lfirst + chunk_end, g);
+    });
+}
+
 } // namespace dash
 
 #endif // DASH__ALGORITHM__GENERATE_H__
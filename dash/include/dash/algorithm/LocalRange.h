@@ -4,6 +4,9 @@
 #include <dash/GlobIter.h>
 #include <dash/internal/Logging.h>
 
+#include <algorithm>
+#include <type_traits>
+
 namespace dash {
 
 template<typename ElementType>
@@ -18,6 +21,196 @@ struct LocalIndexRange {
   IndexType end;
 };
 
+namespace internal {
+
+/**
+ * Local index of the first element at the calling unit with global index
+ * not less than \c g_index in a one-dimensional pattern, or the unit's
+ * local size if there is no such element.
+ *
+ * \complexity  O(log nl) with \c nl local elements
+ */
+template<class PatternType>
+typename PatternType::index_type local_index_lower_bound(
+  const PatternType                & pattern,
+  typename PatternType::index_type   g_index)
+{
+  typedef typename PatternType::index_type idx_t;
+  idx_t l_size = pattern.local_size();
+  if (g_index < static_cast<idx_t>(pattern.size())) {
+    auto l_pos = pattern.local(g_index);
+    if (l_pos.unit == pattern.team().myid()) {
+      return l_pos.index;
+    }
+  }
+  // Global indices of local elements are ascending in one-dimensional
+  // patterns:
+  idx_t l_first = 0;
+  idx_t l_count = l_size;
+  while (l_count > 0) {
+    idx_t l_step = l_count / 2;
+    idx_t l_mid  = l_first + l_step;
+    if (pattern.global(l_mid) < g_index) {
+      l_first  = l_mid + 1;
+      l_count -= l_step + 1;
+    } else {
+      l_count  = l_step;
+    }
+  }
+  return l_first;
+}
+
+/**
+ * Number of elements in the run of local elements starting at local index
+ * \c l_idx with global index \c g_idx that are contiguous in global index
+ * space, limited to the local index range end \c l_end.
+ *
+ * In one-dimensional patterns, the run is resolved from the block size
+ * in O(1) which is validated as some patterns do not align local blocks
+ * to block size, otherwise it is resolved element-wise.
+ */
+template<class PatternType>
+typename PatternType::index_type local_run_length(
+  const PatternType                & pattern,
+  typename PatternType::index_type   l_idx,
+  typename PatternType::index_type   l_end,
+  typename PatternType::index_type   g_idx)
+{
+  typedef typename PatternType::index_type idx_t;
+  if (PatternType::ndim() == 1) {
+    idx_t blocksize = pattern.blocksize(0);
+    idx_t nrun      = std::min<idx_t>(l_end - l_idx,
+                                      blocksize - (l_idx % blocksize));
+    if (pattern.global(l_idx + nrun - 1) == g_idx + nrun - 1) {
+      return nrun;
+    }
+  }
+  idx_t nrun = 1;
+  while (l_idx + nrun < l_end &&
+         pattern.global(l_idx + nrun) == g_idx + nrun) {
+    ++nrun;
+  }
+  return nrun;
+}
+
+/**
+ * Number of elements in the run of global indices beginning at \c g_idx
+ * that are contiguous in the local memory of the unit owning \c g_idx at
+ * local position \c l_pos, limited to \c max_elem, in a one-dimensional
+ * pattern.
+ *
+ * Global indices of a unit's local elements are ascending in
+ * one-dimensional patterns, so a run is contiguous if its last element
+ * is. The run is extended block by block, runs ending within a block of
+ * patterns that do not align blocks to the block size are bounded by
+ * binary search.
+ *
+ * \complexity  O(1) index mappings per block for blocks aligned to the
+ *              block size, otherwise O(log b) with block size \c b
+ */
+template<class PatternType, class LocalPosType>
+typename PatternType::index_type pattern_run_length(
+  const PatternType                & pattern,
+  typename PatternType::index_type   g_idx,
+  const LocalPosType               & l_pos,
+  typename PatternType::index_type   max_elem)
+{
+  typedef typename PatternType::index_type idx_t;
+  // Whether the run of nelem elements is contiguous in local memory:
+  auto contiguous = [&](idx_t nelem) {
+    auto last_pos = pattern.local(g_idx + nelem - 1);
+    return last_pos.unit  == l_pos.unit &&
+           last_pos.index == l_pos.index + nelem - 1;
+  };
+  idx_t blocksize = std::max<idx_t>(pattern.blocksize(0), 1);
+  // Run of nrun elements is contiguous:
+  idx_t nrun      = 1;
+  // Candidate run to the end of the block:
+  idx_t nnext     = std::min<idx_t>(max_elem,
+                                    blocksize - (g_idx % blocksize));
+  while (contiguous(nnext)) {
+    nrun = nnext;
+    if (nrun == max_elem || !contiguous(nrun + 1)) {
+      return nrun;
+    }
+    nnext = std::min<idx_t>(max_elem, nrun + blocksize);
+  }
+  // Run of nnext elements is not contiguous:
+  while (nnext - nrun > 1) {
+    idx_t nmid = nrun + (nnext - nrun) / 2;
+    if (contiguous(nmid)) {
+      nrun  = nmid;
+    } else {
+      nnext = nmid;
+    }
+  }
+  return nrun;
+}
+
+/**
+ * Number of elements in the run of global elements beginning at the
+ * position of \c g_first that are contiguous in the local memory of the
+ * unit owning the first element, limited to \c max_elem.
+ * Iterators on one-dimensional patterns without view are resolved block
+ * by block, see \c pattern_run_length.
+ */
+template<class GlobIterType>
+typename GlobIterType::index_type global_run_length(
+  GlobIterType                      g_first,
+  typename GlobIterType::index_type max_elem,
+  std::true_type)
+{
+  return pattern_run_length(g_first.pattern(), g_first.pos(),
+                            g_first.lpos(), max_elem);
+}
+
+/**
+ * Number of elements in the run of global elements beginning at the
+ * position of \c g_first that are contiguous in the local memory of the
+ * unit owning the first element, limited to \c max_elem, resolved
+ * element by element.
+ */
+template<class GlobIterType>
+typename GlobIterType::index_type global_run_length(
+  GlobIterType                      g_first,
+  typename GlobIterType::index_type max_elem,
+  std::false_type)
+{
+  typedef typename GlobIterType::index_type idx_t;
+  auto  run_lpos = g_first.lpos();
+  idx_t nrun     = 1;
+  for (++g_first; nrun < max_elem; ++g_first, ++nrun) {
+    auto lpos = g_first.lpos();
+    if (lpos.unit  != run_lpos.unit ||
+        lpos.index != run_lpos.index + nrun) {
+      break;
+    }
+  }
+  return nrun;
+}
+
+/**
+ * Number of elements in the run of global elements beginning at the
+ * position of \c g_first that are contiguous in the local memory of the
+ * unit owning the first element, limited to \c max_elem.
+ * Used to transfer every run in a single one-sided operation.
+ */
+template<class GlobIterType>
+typename GlobIterType::index_type global_run_length(
+  const GlobIterType              & g_first,
+  typename GlobIterType::index_type max_elem)
+{
+  typedef typename GlobIterType::pattern_type pattern_t;
+  return global_run_length(
+           g_first, max_elem,
+           std::integral_constant<
+             bool,
+             pattern_t::ndim() == 1 &&
+             !GlobIterType::has_view::value >());
+}
+
+} // namespace internal
+
 /**
  * Resolves the local index range between global iterators.
  *
@@ -83,6 +276,17 @@ local_index_range(
   // Intersect local range and global range, in global index domain:
   auto goffset_lbegin = std::max<idx_t>(lbegin_gindex, begin_gindex);
   auto goffset_lend   = std::min<idx_t>(lend_gindex, end_gindex);
+  if (pattern_t::ndim() == 1) {
+    // Elements at the boundaries of the intersection are not local in
+    // patterns with several blocks per unit, resolve local indices of
+    // the first local elements at or after the boundaries, O(log nl):
+    auto lbegin_index = internal::local_index_lower_bound(
+                          pattern, goffset_lbegin);
+    auto lend_index   = internal::local_index_lower_bound(
+                          pattern, goffset_lend);
+    DASH_LOG_TRACE("local_index_range ->", lbegin_index, lend_index);
+    return LocalIndexRange<idx_t> { lbegin_index, lend_index };
+  }
   // Global positions of local range to global coordinates, O(d):
   auto lbegin_gcoords = pattern.coords(goffset_lbegin);
   // Subtract 1 from global end offset as it points one coordinate
@@ -194,6 +398,17 @@ local_index_range(
   // Intersect local range and global range, in global index domain:
   auto goffset_lbegin = std::max<idx_t>(lbegin_gindex, begin_gindex);
   auto goffset_lend   = std::min<idx_t>(lend_gindex, end_gindex);
+  if (pattern_t::ndim() == 1) {
+    // Elements at the boundaries of the intersection are not local in
+    // patterns with several blocks per unit, resolve local indices of
+    // the first local elements at or after the boundaries, O(log nl):
+    auto lbegin_index = internal::local_index_lower_bound(
+                          pattern, goffset_lbegin);
+    auto lend_index   = internal::local_index_lower_bound(
+                          pattern, goffset_lend);
+    DASH_LOG_TRACE("local_index_range ->", lbegin_index, lend_index);
+    return LocalIndexRange<idx_t> { lbegin_index, lend_index };
+  }
   // Global positions of local range to global coordinates, O(d):
   auto lbegin_gcoords = pattern.coords(goffset_lbegin);
   // Subtract 1 from global end offset as it points one coordinate
@@ -2,126 +2,382 @@
 #define DASH__ALGORITHM__MIN_MAX_H__
 
 #include <dash/GlobIter.h>
+#include <dash/GlobPtr.h>
+#include <dash/Team.h>
+#include <dash/Exception.h>
 #include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/ExecutionPolicy.h>
 #include <dash/internal/Logging.h>
-#include <dash/Array.h>
+#include <dash/dart/if/dart_communication.h>
 
 #include <algorithm>
+#include <cstring>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace dash {
 
+namespace internal {
+
+/**
+ * Candidate for the global extremum contributed by a single unit.
+ */
+template<typename ElementType, typename IndexType>
+struct extremum_loc {
+  /// Value of the unit's local extremum
+  ElementType value;
+  /// Global index of the unit's local extremum, used to resolve ties
+  IndexType   g_index;
+  /// Offset of the unit's local extremum in the unit's local memory
+  IndexType   l_index;
+  /// Unit owning the local extremum
+  dart_unit_t unit;
+  /// Whether the unit's local range is non-empty
+  bool        valid;
+};
+
+/**
+ * Reduction operation on candidates for global extrema in
+ * \c dart_allreduce_custom.
+ * If \c minmax is set, candidates at odd positions are maxima and all
+ * other candidates are minima, otherwise all candidates are minima.
+ *
+ * Ties are resolved by global index: the first occurrence of an
+ * equivalent minimum and the last occurrence of an equivalent maximum is
+ * selected, so the operation is commutative.
+ */
+template<
+  typename ElementType,
+  typename IndexType,
+  class    Compare >
+struct extremum_reduce_op {
+  typedef extremum_reduce_op<ElementType, IndexType, Compare> self_t;
+  typedef extremum_loc<ElementType, IndexType>                loc_t;
+
+  /// Element comparison function
+  Compare compare;
+  /// Whether candidates at odd positions are maxima
+  bool    minmax;
+
+  /**
+   * Whether candidate \c loc replaces the current extremum \c ext.
+   */
+  bool select(const loc_t & loc, const loc_t & ext, bool is_max) const
+  {
+    if (!loc.valid) {
+      return false;
+    }
+    if (!ext.valid) {
+      return true;
+    }
+    if (is_max) {
+      return compare(ext.value, loc.value) ||
+             (!compare(loc.value, ext.value) && loc.g_index > ext.g_index);
+    }
+    return compare(loc.value, ext.value) ||
+           (!compare(ext.value, loc.value) && loc.g_index < ext.g_index);
+  }
+
+  static void reduce(
+    const void * invec,
+    void       * inoutvec,
+    size_t       nelem,
+    void       * userdata)
+  {
+    const self_t & op  = *static_cast<const self_t *>(userdata);
+    const char   * in  = static_cast<const char *>(invec);
+    char         * out = static_cast<char *>(inoutvec);
+    for (size_t i = 0; i < nelem; ++i) {
+      // Buffers of the reduction are not aligned for loc_t in general:
+      loc_t loc;
+      loc_t ext;
+      std::memcpy(&loc, in  + i * sizeof(loc_t), sizeof(loc_t));
+      std::memcpy(&ext, out + i * sizeof(loc_t), sizeof(loc_t));
+      if (op.select(loc, ext, op.minmax && i % 2 == 1)) {
+        std::memcpy(out + i * sizeof(loc_t), &loc, sizeof(loc_t));
+      }
+    }
+  }
+};
+
+/**
+ * Reduces the local extrema of all units in the team to the global
+ * extrema in a single \c dart_allreduce_custom, every unit determines the
+ * same result.
+ *
+ * Selected candidates are invalid if all local ranges are empty.
+ */
+template<
+  typename ElementType,
+  typename IndexType,
+  class    Compare >
+void team_extrema(
+  /// Local extrema of the calling unit
+  const extremum_loc<ElementType, IndexType> * l_locs,
+  /// Selected global extrema
+  extremum_loc<ElementType, IndexType>       * g_locs,
+  /// Number of extrema
+  size_t                                       nlocs,
+  /// Whether extrema at odd positions are maxima
+  bool                                         minmax,
+  dash::Team                                 & team,
+  Compare                                      compare)
+{
+  typedef extremum_loc<ElementType, IndexType>                loc_t;
+  typedef extremum_reduce_op<ElementType, IndexType, Compare> op_t;
+  static_assert(std::is_trivially_copyable<ElementType>::value,
+                "min_element and max_element require trivially "
+                "copyable element types");
+  op_t op = { compare, minmax };
+  DASH_ASSERT_RETURNS(
+    dart_allreduce_custom(
+      l_locs,
+      g_locs,
+      nlocs,
+      sizeof(loc_t),
+      &op_t::reduce,
+      &op,
+      team.dart_id()),
+    DART_OK);
+}
+
+/**
+ * Candidate for the global extremum at the element at offset \c l_index
+ * in the calling unit's local memory.
+ */
+template<
+  typename ElementType,
+  class    PatternType >
+extremum_loc<ElementType, typename PatternType::index_type>
+local_extremum(
+  const PatternType & pattern,
+  const ElementType * lbegin,
+  const ElementType * l_ext)
+{
+  typedef typename PatternType::index_type index_t;
+  extremum_loc<ElementType, index_t> loc;
+  loc.value   = *l_ext;
+  loc.l_index = static_cast<index_t>(l_ext - lbegin);
+  loc.g_index = pattern.global(loc.l_index);
+  loc.unit    = pattern.team().myid();
+  loc.valid   = true;
+  return loc;
+}
+
+/**
+ * Finds the first occurrence of the smallest element in the non-empty
+ * local range [l_first, l_last) using the given execution policy.
+ * Every thread finds the minimum in its chunk, chunk minima are combined
+ * in the order of chunks.
+ */
+template<
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    Compare >
+const ElementType * local_min_element(
+  const ExecutionPolicy & policy,
+  const ElementType     * l_first,
+  const ElementType     * l_last,
+  Compare                 compare)
+{
+  typedef decltype(l_last - l_first) offset_t;
+  // Minimum of every thread's chunk, initialized to end of range for
+  // threads without chunk:
+  std::vector<const ElementType *> chunk_mins(
+                                     local_max_threads(policy), l_last);
+  for_each_chunk_local(
+    policy, static_cast<offset_t>(0), l_last - l_first,
+    [&](offset_t chunk_begin, offset_t chunk_end, int thread) {
+      chunk_mins[thread] = std::min_element(l_first + chunk_begin,
+                                            l_first + chunk_end,
+                                            compare);
+    });
+  const ElementType * lmin = l_last;
+  for (auto chunk_min : chunk_mins) {
+    if (chunk_min != l_last &&
+        (lmin == l_last || compare(*chunk_min, *lmin))) {
+      lmin = chunk_min;
+    }
+  }
+  return lmin;
+}
+
+/**
+ * Finds the first occurrence of the smallest element and the last
+ * occurrence of the greatest element in the non-empty local range
+ * [l_first, l_last) using the given execution policy.
+ * Every thread finds the extrema in its chunk, chunk extrema are combined
+ * in the order of chunks.
+ */
+template<
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    Compare >
+std::pair<const ElementType *, const ElementType *> local_minmax_element(
+  const ExecutionPolicy & policy,
+  const ElementType     * l_first,
+  const ElementType     * l_last,
+  Compare                 compare)
+{
+  typedef decltype(l_last - l_first)                           offset_t;
+  typedef std::pair<const ElementType *, const ElementType *> minmax_t;
+  // Extrema of every thread's chunk, initialized to end of range for
+  // threads without chunk:
+  std::vector<minmax_t> chunk_minmax(local_max_threads(policy),
+                                     minmax_t(l_last, l_last));
+  for_each_chunk_local(
+    policy, static_cast<offset_t>(0), l_last - l_first,
+    [&](offset_t chunk_begin, offset_t chunk_end, int thread) {
+      chunk_minmax[thread] = std::minmax_element(l_first + chunk_begin,
+                                                 l_first + chunk_end,
+                                                 compare);
+    });
+  minmax_t lminmax(l_last, l_last);
+  for (auto & chunk : chunk_minmax) {
+    if (chunk.first == l_last) {
+      continue;
+    }
+    if (lminmax.first == l_last || compare(*chunk.first, *lminmax.first)) {
+      lminmax.first  = chunk.first;
+    }
+    if (lminmax.second == l_last ||
+        !compare(*chunk.second, *lminmax.second)) {
+      lminmax.second = chunk.second;
+    }
+  }
+  return lminmax;
+}
+
+} // namespace internal
+
 /**
  * Finds an iterator pointing to the element with the smallest value in
- * the range [first,last).
+ * the range [first,last), using the given execution policy for the local
+ * phase.
+ *
+ * Collective operation, must be called by all units in the team of the
+ * range's pattern. Every unit finds the minimum in its local subrange,
+ * the global minimum is then resolved in a single allreduce of the local
+ * minima and their positions. No global memory is allocated.
  *
  * \return      An iterator to the first occurrence of the smallest value
  *              in the range, or \c last if the range is empty.
  *
- * \tparam      ElementType  Type of the elements in the sequence
- * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
- *              pattern and \c nl local elements within the global range
+ * \tparam      ExecutionPolicy  Execution policy of local phase, e.g.
+ *                               \c dash::par_unseq_local
+ * \tparam      ElementType      Type of the elements in the sequence
+ * \tparam      Compare          Binary predicate type, must be inlinable
+ *                               in the local scan, e.g. a functor or
+ *                               lambda
+ * \complexity  O(d) + O(nl / t) + O(log p), with \c d dimensions in the
+ *              global iterators' pattern, \c nl local elements within the
+ *              global range, \c t threads per unit and \c p units in the
+ *              team
  *
  * \ingroup     DashAlgorithms
  */
 template<
+  class    ExecutionPolicy,
   typename ElementType,
-  class PatternType>
-GlobPtr<ElementType, PatternType> min_element(
+  class    PatternType,
+  class    Compare = std::less<ElementType> >
+typename std::enable_if<
+  dash::is_execution_policy<ExecutionPolicy>::value,
+  GlobPtr<ElementType, PatternType> >::type
+min_element(
+  /// Execution policy of the local phase
+  const ExecutionPolicy                    & policy,
   /// Iterator to the initial position in the sequence
   const GlobIter<ElementType, PatternType> & first,
   /// Iterator to the final position in the sequence
   const GlobIter<ElementType, PatternType> & last,
   /// Element comparison function, defaults to std::less
-  const std::function<
-      bool(const ElementType &, const ElementType)
-    > & compare
-      = std::less<const ElementType &>()) {
-  auto pattern      = first.pattern();
-  typedef dash::GlobPtr<ElementType, PatternType> globptr_t;
-  typedef typename decltype(pattern)::size_type   extent_t;
-
-  dash::Team & team = pattern.team();
-  DASH_LOG_DEBUG("dash::min_element()",
-                 "allocate minarr, size", team.size());
-  dash::Array<globptr_t> minarr(team.size());
-  // return last for empty array
+  Compare compare = Compare())
+{
+  typedef dash::GlobPtr<ElementType, PatternType>  globptr_t;
+  typedef typename PatternType::index_type           index_t;
+  typedef internal::extremum_loc<ElementType, index_t> loc_t;
+
+  // return last for empty range
   if (first == last) {
     return last;
   }
+  auto & pattern = first.pattern();
+  auto & team    = pattern.team();
+  DASH_LOG_DEBUG("dash::min_element()");
   // Find the local min. element in parallel
   // Get local address range between global iterators:
-  auto local_idx_range = dash::local_index_range(first, last);
+  auto  local_idx_range = dash::local_index_range(first, last);
+  loc_t l_min = loc_t();
+  l_min.valid = false;
   if (local_idx_range.begin == local_idx_range.end) {
-    // local range is empty
-    minarr[team.myid()] = nullptr;
     DASH_LOG_DEBUG("dash::min_element", "local range empty");
   } else {
     // Pointer to first element in local memory:
     const ElementType * lbegin        = first.globmem().lbegin(
-                                          pattern.team().myid());
+                                          team.myid());
     // Pointers to first / final element in local range:
     const ElementType * l_range_begin = lbegin + local_idx_range.begin;
     const ElementType * l_range_end   = lbegin + local_idx_range.end;
-    const ElementType * lmin          = ::std::min_element(l_range_begin,
-                                                           l_range_end,
-                                                           compare);
-    // Offset of local minimum in local memory:
-    auto l_idx_lmin = lmin - lbegin;
-    DASH_LOG_TRACE_VAR("dash::min_element", l_idx_lmin);
-    if (lmin != l_range_end) {
-      DASH_LOG_TRACE_VAR("dash::min_element", *lmin);
-    }
-    // Global pointer to local minimum:
-    globptr_t gptr_lmin(first.globmem().index_to_gptr(
-                                          team.myid(),
-                                          l_idx_lmin));
-    if (lmin != l_range_end) {
-      DASH_LOG_DEBUG("dash::min_element", gptr_lmin,
-                     "=", static_cast<ElementType>(*gptr_lmin));
-    }
-    minarr[team.myid()] = gptr_lmin;
-  }
-  DASH_LOG_TRACE("dash::min_element", "waiting for local min of other units");
-  team.barrier();
-  // Shared global pointer referencing element with global minimum:
-  dash::Shared<globptr_t> shared_min;
-  // Find the global min. element:
-  if (team.myid() == 0) {
-    DASH_LOG_TRACE("dash::min_element", "finding global min");
-    globptr_t minloc = nullptr;
-    ElementType minval = ElementType();
-    for (extent_t i = 0; i < minarr.size(); ++i) {
-      globptr_t lmingptr = minarr[i];
-      DASH_LOG_TRACE("dash::min_element", "unit:", i, "lmin_gptr:", lmingptr);
-      // Local gptr of units might be null if unit had empty range:
-      if (lmingptr != nullptr) {
-        ElementType val = *lmingptr;
-        DASH_LOG_TRACE("dash::min_element",
-                       "local min of unit", i, ": ", val);
-        if (minloc == nullptr || compare(val, minval)) {
-          DASH_LOG_TRACE("dash::min_element",
-                         "setting current minval to", val);
-          minloc = lmingptr;
-          minval = val;
-        }
-      }
-    }
-    DASH_LOG_TRACE("dash::min_element",
-                   "setting global min gptr to", minloc);
-    shared_min.set(minloc);
+    const ElementType * lmin          = internal::local_min_element(
+                                          policy,
+                                          l_range_begin,
+                                          l_range_end,
+                                          compare);
+    l_min = internal::local_extremum(pattern, lbegin, lmin);
+    DASH_LOG_TRACE("dash::min_element", "local min:", l_min.value,
+                   "gidx:", l_min.g_index);
   }
-  // Wait for unit 0 to resolve global minimum
-  team.barrier();
-  // Minimum has been set by unit 0 at this point
-  globptr_t minimum = shared_min.get();
-  if (minimum == nullptr) {
+  loc_t g_min = loc_t();
+  internal::team_extrema(&l_min, &g_min, 1, false, team, compare);
+  if (!g_min.valid) {
     return last;
   }
+  globptr_t minimum(first.globmem().index_to_gptr(g_min.unit,
+                                                  g_min.l_index));
   DASH_LOG_DEBUG("dash::min_element >", minimum,
-                 "=", (ElementType)(*minimum));
+                 "unit:", g_min.unit, "gidx:", g_min.g_index);
   return minimum;
 }
 
+/**
+ * Finds an iterator pointing to the element with the smallest value in
+ * the range [first,last).
+ *
+ * Collective operation, must be called by all units in the team of the
+ * range's pattern. Every unit finds the minimum in its local subrange,
+ * the global minimum is then resolved in a single allreduce of the local
+ * minima and their positions. No global memory is allocated.
+ *
+ * \return      An iterator to the first occurrence of the smallest value
+ *              in the range, or \c last if the range is empty.
+ *
+ * \tparam      ElementType  Type of the elements in the sequence
+ * \tparam      Compare      Binary predicate type, must be inlinable in
+ *                           the local scan, e.g. a functor or lambda
+ * \complexity  O(d) + O(nl) + O(log p), with \c d dimensions in the
+ *              global iterators' pattern, \c nl local elements within the
+ *              global range and \c p units in the team
+ *
+ * \ingroup     DashAlgorithms
+ */
+template<
+  typename ElementType,
+  class    PatternType,
+  class    Compare = std::less<ElementType> >
+GlobPtr<ElementType, PatternType> min_element(
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & last,
+  /// Element comparison function, defaults to std::less
+  Compare compare = Compare())
+{
+  return dash::min_element(dash::seq_local, first, last, compare);
+}
+
 /**
  * Finds an iterator pointing to the element with the smallest value in
  * the range [first,last).
@@ -131,23 +387,21 @@ GlobPtr<ElementType, PatternType> min_element(
  *              in the range, or \c last if the range is empty.
  *
  * \tparam      ElementType  Type of the elements in the sequence
- * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
- *              pattern and \c nl local elements within the global range
+ * \complexity  O(n), with \c n elements in the range
  *
  * \ingroup     DashAlgorithms
  */
-template<typename ElementType>
+template<
+  typename ElementType,
+  class    Compare = std::less<ElementType> >
 const ElementType * min_element(
   /// Iterator to the initial position in the sequence
   const ElementType * first,
   /// Iterator to the final position in the sequence
   const ElementType * last,
   /// Element comparison function, defaults to std::less
-  const std::function<
-      bool(const ElementType &, const ElementType)
-    > & compare
-      = std::less<const ElementType &>()) {
-  // Same as min_element with different compare function
+  Compare compare = Compare())
+{
   return std::min_element(first, last, compare);
 }
 
@@ -155,32 +409,74 @@ const ElementType * min_element(
  * Finds an iterator pointing to the element with the greatest value in
  * the range [first,last).
  *
+ * Collective operation, must be called by all units in the team of the
+ * range's pattern.
+ *
  * \return      An iterator to the first occurrence of the greatest value
  *              in the range, or \c last if the range is empty.
  *
  * \tparam      ElementType  Type of the elements in the sequence
- * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
- *              pattern and \c nl local elements within the global range
+ * \complexity  O(d) + O(nl) + O(log p), with \c d dimensions in the
+ *              global iterators' pattern, \c nl local elements within the
+ *              global range and \c p units in the team
+ *
+ * \see         dash::min_element
  *
  * \ingroup     DashAlgorithms
  */
 template<
   typename ElementType,
-  class    PatternType>
+  class    PatternType,
+  class    Compare = std::greater<ElementType> >
 GlobPtr<ElementType, PatternType> max_element(
   /// Iterator to the initial position in the sequence
   const GlobIter<ElementType, PatternType> & first,
   /// Iterator to the final position in the sequence
   const GlobIter<ElementType, PatternType> & last,
-  /// Element comparison function, defaults to std::less
-  const std::function<
-      bool(const ElementType &, const ElementType)
-    > & compare
-      = std::greater<const ElementType &>()) {
+  /// Element comparison function, defaults to std::greater
+  Compare compare = Compare())
+{
   // Same as min_element with different compare function
   return dash::min_element(first, last, compare);
 }
 
+/**
+ * Finds an iterator pointing to the element with the greatest value in
+ * the range [first,last), using the given execution policy for the local
+ * phase.
+ *
+ * Collective operation, must be called by all units in the team of the
+ * range's pattern.
+ *
+ * \return      An iterator to the first occurrence of the greatest value
+ *              in the range, or \c last if the range is empty.
+ *
+ * \see         dash::min_element
+ *
+ * \ingroup     DashAlgorithms
+ */
+template<
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    PatternType,
+  class    Compare = std::greater<ElementType> >
+typename std::enable_if<
+  dash::is_execution_policy<ExecutionPolicy>::value,
+  GlobPtr<ElementType, PatternType> >::type
+max_element(
+  /// Execution policy of the local phase
+  const ExecutionPolicy                    & policy,
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & last,
+  /// Element comparison function, defaults to std::greater
+  Compare compare = Compare())
+{
+  // Same as min_element with different compare function
+  return dash::min_element(policy, first, last, compare);
+}
+
 /**
  * Finds an iterator pointing to the element with the greatest value in
  * the range [first,last).
@@ -190,26 +486,174 @@ GlobPtr<ElementType, PatternType> max_element(
  *              in the range, or \c last if the range is empty.
  *
  * \tparam      ElementType  Type of the elements in the sequence
- * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
- *              pattern and \c nl local elements within the global range
+ * \complexity  O(n), with \c n elements in the range
  *
  * \ingroup     DashAlgorithms
  */
-template< typename ElementType >
+template<
+  typename ElementType,
+  class    Compare = std::greater<ElementType> >
 const ElementType * max_element(
   /// Iterator to the initial position in the sequence
   const ElementType * first,
   /// Iterator to the final position in the sequence
   const ElementType * last,
-  /// Element comparison function, defaults to std::less
-  const std::function<
-      bool(const ElementType &, const ElementType)
-    > & compare
-      = std::greater<const ElementType &>()) {
+  /// Element comparison function, defaults to std::greater
+  Compare compare = Compare())
+{
   // Same as min_element with different compare function
   return std::min_element(first, last, compare);
 }
 
+/**
+ * Finds iterators pointing to the elements with the smallest and the
+ * greatest value in the range [first,last) in a single pass, using the
+ * given execution policy for the local phase.
+ *
+ * Collective operation, must be called by all units in the team of the
+ * range's pattern. Local minima and maxima of all units and their
+ * positions are reduced in a single allreduce.
+ *
+ * \return      A pair of iterators to the first occurrence of the
+ *              smallest value and to the last occurrence of the greatest
+ *              value in the range like \c std::minmax_element, or a pair
+ *              of \c last if the range is empty.
+ *
+ * \tparam      ExecutionPolicy  Execution policy of local phase, e.g.
+ *                               \c dash::par_unseq_local
+ * \tparam      ElementType      Type of the elements in the sequence
+ * \complexity  O(d) + O(nl / t) + O(log p), with \c d dimensions in the
+ *              global iterators' pattern, \c nl local elements within the
+ *              global range, \c t threads per unit and \c p units in the
+ *              team
+ *
+ * \ingroup     DashAlgorithms
+ */
+template<
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    PatternType,
+  class    Compare = std::less<ElementType> >
+typename std::enable_if<
+  dash::is_execution_policy<ExecutionPolicy>::value,
+  std::pair<
+    GlobPtr<ElementType, PatternType>,
+    GlobPtr<ElementType, PatternType> > >::type
+minmax_element(
+  /// Execution policy of the local phase
+  const ExecutionPolicy                    & policy,
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & last,
+  /// Element comparison function, defaults to std::less
+  Compare compare = Compare())
+{
+  typedef dash::GlobPtr<ElementType, PatternType>  globptr_t;
+  typedef typename PatternType::index_type           index_t;
+  typedef internal::extremum_loc<ElementType, index_t> loc_t;
+
+  if (first == last) {
+    return std::make_pair(globptr_t(last), globptr_t(last));
+  }
+  auto & pattern = first.pattern();
+  auto & team    = pattern.team();
+  DASH_LOG_DEBUG("dash::minmax_element()");
+  auto  local_idx_range = dash::local_index_range(first, last);
+  // Local minimum and maximum are reduced in a single collective
+  // operation:
+  loc_t l_minmax[2] = { loc_t(), loc_t() };
+  l_minmax[0].valid = false;
+  l_minmax[1].valid = false;
+  if (local_idx_range.begin != local_idx_range.end) {
+    const ElementType * lbegin      = first.globmem().lbegin(
+                                        team.myid());
+    auto                l_minmax_it = internal::local_minmax_element(
+                                        policy,
+                                        lbegin + local_idx_range.begin,
+                                        lbegin + local_idx_range.end,
+                                        compare);
+    l_minmax[0] = internal::local_extremum(pattern, lbegin,
+                                           l_minmax_it.first);
+    l_minmax[1] = internal::local_extremum(pattern, lbegin,
+                                           l_minmax_it.second);
+  }
+  loc_t g_minmax[2] = { loc_t(), loc_t() };
+  internal::team_extrema(l_minmax, g_minmax, 2, true, team, compare);
+  const loc_t & g_min = g_minmax[0];
+  const loc_t & g_max = g_minmax[1];
+  if (!g_min.valid) {
+    return std::make_pair(globptr_t(last), globptr_t(last));
+  }
+  DASH_LOG_DEBUG("dash::minmax_element >",
+                 "min gidx:", g_min.g_index, "max gidx:", g_max.g_index);
+  return std::make_pair(
+           globptr_t(first.globmem().index_to_gptr(g_min.unit,
+                                                   g_min.l_index)),
+           globptr_t(first.globmem().index_to_gptr(g_max.unit,
+                                                   g_max.l_index)));
+}
+
+/**
+ * Finds iterators pointing to the elements with the smallest and the
+ * greatest value in the range [first,last) in a single pass.
+ *
+ * Collective operation, must be called by all units in the team of the
+ * range's pattern.
+ *
+ * \return      A pair of iterators to the first occurrence of the
+ *              smallest value and to the last occurrence of the greatest
+ *              value in the range like \c std::minmax_element, or a pair
+ *              of \c last if the range is empty.
+ *
+ * \tparam      ElementType  Type of the elements in the sequence
+ * \complexity  O(d) + O(nl) + O(log p), with \c d dimensions in the
+ *              global iterators' pattern, \c nl local elements within the
+ *              global range and \c p units in the team
+ *
+ * \see         dash::minmax_element
+ *
+ * \ingroup     DashAlgorithms
+ */
+template<
+  typename ElementType,
+  class    PatternType,
+  class    Compare = std::less<ElementType> >
+std::pair<
+  GlobPtr<ElementType, PatternType>,
+  GlobPtr<ElementType, PatternType> >
+minmax_element(
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & last,
+  /// Element comparison function, defaults to std::less
+  Compare compare = Compare())
+{
+  return dash::minmax_element(dash::seq_local, first, last, compare);
+}
+
+/**
+ * Finds iterators pointing to the elements with the smallest and the
+ * greatest value in the range [first,last).
+ * Specialization for local range, delegates to std::minmax_element.
+ *
+ * \ingroup     DashAlgorithms
+ */
+template<
+  typename ElementType,
+  class    Compare = std::less<ElementType> >
+std::pair<const ElementType *, const ElementType *> minmax_element(
+  /// Iterator to the initial position in the sequence
+  const ElementType * first,
+  /// Iterator to the final position in the sequence
+  const ElementType * last,
+  /// Element comparison function, defaults to std::less
+  Compare compare = Compare())
+{
+  return std::minmax_element(first, last, compare);
+}
+
 } // namespace dash
 
 #endif // DASH__ALGORITHM__MIN_MAX_H__
@@ -3,6 +3,7 @@
 
 #include <dash/dart/if/dart_types.h>
 #include <functional>
+#include <limits>
 
 /**
  * \defgroup DashReduceOperations
@@ -57,6 +58,100 @@ public:
     const ValueType & rhs) const {
     return lhs + rhs;
   }
+
+  /**
+   * Identity element of the operation.
+   */
+  static constexpr ValueType identity() {
+    return ValueType(0);
+  }
+};
+
+/**
+ * Reduce operands to their product.
+ *
+ * \ingroup  DashReduceOperations
+ */
+template< typename ValueType >
+struct multiplies : public ReduceOperation<ValueType> {
+
+public:
+  multiplies()
+  : ReduceOperation<ValueType>(DART_OP_PROD) {
+  }
+
+  ValueType operator()(
+    const ValueType & lhs,
+    const ValueType & rhs) const {
+    return lhs * rhs;
+  }
+
+  /**
+   * Identity element of the operation.
+   */
+  static constexpr ValueType identity() {
+    return ValueType(1);
+  }
+};
+
+/**
+ * Reduce operands to their minimum.
+ *
+ * \ingroup  DashReduceOperations
+ */
+template< typename ValueType >
+struct min : public ReduceOperation<ValueType> {
+
+public:
+  min()
+  : ReduceOperation<ValueType>(DART_OP_MIN) {
+  }
+
+  ValueType operator()(
+    const ValueType & lhs,
+    const ValueType & rhs) const {
+    return (rhs < lhs) ? rhs : lhs;
+  }
+
+  /**
+   * Identity element of the operation, positive infinity for types that
+   * represent it.
+   */
+  static constexpr ValueType identity() {
+    return std::numeric_limits<ValueType>::has_infinity
+           ? std::numeric_limits<ValueType>::infinity()
+           : std::numeric_limits<ValueType>::max();
+  }
+};
+
+/**
+ * Reduce operands to their maximum.
+ *
+ * \ingroup  DashReduceOperations
+ */
+template< typename ValueType >
+struct max : public ReduceOperation<ValueType> {
+
+public:
+  max()
+  : ReduceOperation<ValueType>(DART_OP_MAX) {
+  }
+
+  ValueType operator()(
+    const ValueType & lhs,
+    const ValueType & rhs) const {
+    return (lhs < rhs) ? rhs : lhs;
+  }
+
+  /**
+   * Identity element of the operation, negative infinity for types that
+   * represent it.
+   */
+  static constexpr ValueType identity() {
+    return std::numeric_limits<ValueType>::has_infinity
+           ? -std::numeric_limits<ValueType>::infinity()
+           : std::numeric_limits<ValueType>::lowest();
+  }
 };
 
 }  // namespace dash
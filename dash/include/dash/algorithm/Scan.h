@@ -0,0 +1,740 @@
+#ifndef DASH__ALGORITHM__SCAN_H__
+#define DASH__ALGORITHM__SCAN_H__
+
+#include <dash/GlobIter.h>
+#include <dash/Team.h>
+#include <dash/Exception.h>
+#include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/Operation.h>
+#include <dash/algorithm/Copy.h>
+#include <dash/algorithm/ExecutionPolicy.h>
+#include <dash/internal/Logging.h>
+#include <dash/dart/if/dart_communication.h>
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+namespace dash {
+
+namespace internal {
+
+/**
+ * Total of a run of local elements that are contiguous in global order.
+ */
+template<typename ValueType, typename IndexType>
+struct scan_run {
+  /// Offset of the run's first element in the global range
+  IndexType   g_offset;
+  /// Reduced value of all elements in the run
+  ValueType   total;
+  /// Unit owning the run
+  dart_unit_t unit;
+  /// Whether the entry holds a run, units without local elements
+  /// contribute an invalid entry
+  bool        valid;
+};
+
+/**
+ * Total of a unit's elements in a round of blocks, i.e. in the unit's
+ * block in one cycle of a block-cyclic distribution.
+ */
+template<typename ValueType>
+struct scan_total {
+  /// Reduced value of the elements
+  ValueType value;
+  /// Whether the unit holds elements in the round
+  bool      valid;
+};
+
+/**
+ * Combines totals of consecutive elements, the totals in \c lhs precede
+ * the totals in \c rhs.
+ */
+template<typename ValueType, class BinaryOperation>
+scan_total<ValueType> scan_combine(
+  const scan_total<ValueType> & lhs,
+  const scan_total<ValueType> & rhs,
+  BinaryOperation             & binary_op)
+{
+  if (!lhs.valid) {
+    return rhs;
+  }
+  if (!rhs.valid) {
+    return lhs;
+  }
+  scan_total<ValueType> total;
+  total.value = binary_op(lhs.value, rhs.value);
+  total.valid = true;
+  return total;
+}
+
+/**
+ * Reduction function of \c dart_exscan_custom combining the totals of
+ * rounds of preceding units in \c invec with the totals in \c inoutvec.
+ * Buffers of the reduction are not necessarily aligned.
+ */
+template<typename ValueType, class BinaryOperation>
+void scan_totals_op(
+  const void * invec,
+  void       * inoutvec,
+  size_t       nelem,
+  void       * userdata)
+{
+  typedef scan_total<ValueType> total_t;
+  auto       & binary_op = *static_cast<BinaryOperation *>(userdata);
+  const char * in        = static_cast<const char *>(invec);
+  char       * inout     = static_cast<char *>(inoutvec);
+  for (size_t i = 0; i < nelem; ++i) {
+    total_t lhs;
+    total_t rhs;
+    std::memcpy(&lhs, in    + i * sizeof(total_t), sizeof(total_t));
+    std::memcpy(&rhs, inout + i * sizeof(total_t), sizeof(total_t));
+    total_t total = scan_combine(lhs, rhs, binary_op);
+    std::memcpy(inout + i * sizeof(total_t), &total, sizeof(total_t));
+  }
+}
+
+/**
+ * Inclusive scan of the non-empty local range \c [in, in + nelem) to
+ * \c out using the given execution policy.
+ * Every thread scans its chunk, the chunk totals are combined to the
+ * prefix of every chunk which is then applied by the chunk's thread.
+ * Chunks are identical in both passes as they only depend on the number
+ * of elements and threads.
+ *
+ * \returns  The total of all elements
+ */
+template<
+  class    ExecutionPolicy,
+  typename InputType,
+  typename ValueType,
+  typename IndexType,
+  class    BinaryOperation >
+ValueType local_inclusive_scan(
+  const ExecutionPolicy & policy,
+  const InputType       * in,
+  ValueType             * out,
+  IndexType               nelem,
+  BinaryOperation       & binary_op)
+{
+  typedef scan_total<ValueType> total_t;
+  total_t invalid = total_t();
+  invalid.valid   = false;
+  std::vector<total_t> chunk_totals(local_max_threads(policy), invalid);
+  for_each_chunk_local(
+    policy, static_cast<IndexType>(0), nelem,
+    [&](IndexType chunk_begin, IndexType chunk_end, int thread) {
+      ValueType acc   = static_cast<ValueType>(in[chunk_begin]);
+      out[chunk_begin] = acc;
+      for (IndexType i = chunk_begin + 1; i < chunk_end; ++i) {
+        acc    = binary_op(acc, static_cast<ValueType>(in[i]));
+        out[i] = acc;
+      }
+      chunk_totals[thread].value = acc;
+      chunk_totals[thread].valid = true;
+    });
+  // Prefix of every chunk:
+  std::vector<total_t> chunk_prefix(chunk_totals.size(), invalid);
+  total_t total = invalid;
+  for (size_t t = 0; t < chunk_totals.size(); ++t) {
+    chunk_prefix[t] = total;
+    total = scan_combine(total, chunk_totals[t], binary_op);
+  }
+  if (chunk_totals.size() > 1) {
+    for_each_chunk_local(
+      policy, static_cast<IndexType>(0), nelem,
+      [&](IndexType chunk_begin, IndexType chunk_end, int thread) {
+        if (!chunk_prefix[thread].valid) {
+          return;
+        }
+        for (IndexType i = chunk_begin; i < chunk_end; ++i) {
+          out[i] = binary_op(chunk_prefix[thread].value, out[i]);
+        }
+      });
+  }
+  return total.value;
+}
+
+/**
+ * Implementation of \c dash::inclusive_scan and \c dash::exclusive_scan.
+ *
+ * 1. Every unit splits its local subrange into runs of elements that are
+ *    contiguous in global order, e.g. the blocks of a \c BLOCKCYCLIC
+ *    pattern, and scans every run locally.
+ * 2. The prefix of every run is resolved from the run totals:
+ *    - If every unit holds at most one run, like in \c BLOCKED
+ *      patterns, the run totals are exchanged in a single allgather.
+ *    - If units hold several blocks in round-robin order, block \c b of
+ *      unit \c u is global block <tt>b * nunits + u</tt>. The totals of
+ *      all rounds of blocks are combined in a single exscan over the
+ *      units, and the totals of the rounds are broadcast from the last
+ *      unit. Every unit only holds one total per round.
+ * 3. Every unit applies the prefix to its runs and writes them to the
+ *    output range.
+ */
+template<
+  class ExecutionPolicy,
+  class GlobInputIt,
+  class GlobOutputIt,
+  class ValueType,
+  class BinaryOperation >
+GlobOutputIt scan_impl(
+  /// Execution policy of the local scans
+  const ExecutionPolicy & policy,
+  GlobInputIt     in_first,
+  GlobInputIt     in_last,
+  GlobOutputIt    out_first,
+  /// Initial value, combined with the first element if \c has_init
+  ValueType       init,
+  bool            has_init,
+  BinaryOperation binary_op,
+  /// Whether the i-th element of the result includes the i-th element
+  /// of the input range
+  bool            inclusive)
+{
+  typedef typename GlobInputIt::index_type          index_t;
+  typedef typename GlobInputIt::value_type    in_value_t;
+  typedef typename GlobInputIt::pattern_type   pattern_t;
+  typedef scan_run<ValueType, index_t>               run_t;
+  typedef scan_total<ValueType>                    total_t;
+  static_assert(pattern_t::ndim() == 1,
+                "dash::inclusive_scan and dash::exclusive_scan require a "
+                "one-dimensional pattern");
+  static_assert(std::is_trivially_copyable<ValueType>::value,
+                "dash::inclusive_scan and dash::exclusive_scan require a "
+                "trivially copyable value type");
+
+  index_t nelem = dash::distance(in_first, in_last);
+  if (nelem <= 0) {
+    return out_first;
+  }
+  auto & pattern   = in_first.pattern();
+  auto & team      = pattern.team();
+  auto   myid      = team.myid();
+  auto   nunits    = static_cast<index_t>(team.size());
+  auto   g_first   = in_first.global().pos();
+  auto   blocksize = static_cast<index_t>(pattern.blocksize(0));
+
+  // Local elements in the input range are ordered by global index in
+  // one-dimensional patterns:
+  auto               l_idx_range = dash::local_index_range(in_first,
+                                                           in_last);
+  const in_value_t * l_in        = static_cast<const in_value_t *>(
+                                     in_first.globmem().lbegin(myid));
+  index_t            nlocal      = l_idx_range.end - l_idx_range.begin;
+  std::vector<ValueType> l_values(nlocal);
+  // Offsets of runs in local values, and offset past the last run:
+  std::vector<index_t>   l_run_offsets;
+  std::vector<run_t>     l_runs;
+  // Whether every local run is a block in round-robin order:
+  bool                   round_robin = true;
+  for (index_t l_offset = 0; l_offset < nlocal; ) {
+    index_t l_idx    = l_idx_range.begin + l_offset;
+    index_t g_idx    = pattern.global(l_idx);
+    index_t nrun     = dash::internal::local_run_length(
+                         pattern, l_idx, l_idx_range.end, g_idx);
+    // Local scan of the run, shifted by one element in exclusive scans:
+    const in_value_t * in  = l_in + l_idx;
+    ValueType        * out = l_values.data() + l_offset;
+    ValueType          acc;
+    if (inclusive) {
+      acc = local_inclusive_scan(policy, in, out, nrun, binary_op);
+    } else if (nrun > 1) {
+      acc = binary_op(
+              local_inclusive_scan(policy, in, out + 1, nrun - 1,
+                                   binary_op),
+              static_cast<ValueType>(in[nrun - 1]));
+    } else {
+      acc = static_cast<ValueType>(in[0]);
+    }
+    index_t g_block = g_idx / blocksize;
+    round_robin     = round_robin &&
+                      g_block % nunits == myid &&
+                      (g_idx + nrun - 1) / blocksize == g_block;
+    run_t run;
+    run.g_offset = g_idx - g_first;
+    run.total    = acc;
+    run.unit     = myid;
+    run.valid    = true;
+    l_runs.push_back(run);
+    l_run_offsets.push_back(l_offset);
+    l_offset    += nrun;
+  }
+  l_run_offsets.push_back(nlocal);
+  DASH_LOG_TRACE("dash::scan_impl", "local elements:", nlocal,
+                 "local runs:", l_runs.size());
+
+  // Maximum number of runs of a unit, and whether runs of any unit are
+  // not in round-robin order:
+  long l_flags[2] = { static_cast<long>(l_runs.size()),
+                      round_robin ? 0L : 1L };
+  long flags[2];
+  DASH_ASSERT_RETURNS(
+    dart_allreduce(l_flags, flags, 2, DART_TYPE_LONG, DART_OP_MAX,
+                   team.dart_id()),
+    DART_OK);
+  // Prefix of every local run in global order:
+  std::vector<total_t> l_prefix(l_runs.size());
+  total_t acc;
+  acc.value = init;
+  acc.valid = has_init;
+  if (flags[0] <= 1) {
+    // At most one run per unit, exchange run totals:
+    run_t l_run = run_t();
+    l_run.valid = false;
+    if (l_runs.size() > 0) {
+      l_run = l_runs[0];
+    }
+    std::vector<run_t> runs(team.size());
+    DASH_ASSERT_RETURNS(
+      dart_allgather(&l_run, runs.data(), sizeof(run_t), team.dart_id()),
+      DART_OK);
+    runs.erase(std::remove_if(runs.begin(), runs.end(),
+                              [](const run_t & r) { return !r.valid; }),
+               runs.end());
+    std::sort(runs.begin(), runs.end(),
+              [](const run_t & a, const run_t & b) {
+                return a.g_offset < b.g_offset;
+              });
+    for (auto & run : runs) {
+      if (run.unit == myid) {
+        l_prefix[0] = acc;
+      }
+      total_t run_total;
+      run_total.value = run.total;
+      run_total.valid = true;
+      acc = scan_combine(acc, run_total, binary_op);
+    }
+  } else if (flags[1] == 0) {
+    // Blocks in round-robin order, reduce totals per round:
+    index_t round_first = (g_first / blocksize) / nunits;
+    index_t nrounds     = ((g_first + nelem - 1) / blocksize) / nunits
+                          - round_first + 1;
+    total_t invalid = total_t();
+    invalid.valid   = false;
+    std::vector<total_t> l_totals(nrounds, invalid);
+    for (auto & run : l_runs) {
+      index_t round = ((g_first + run.g_offset) / blocksize) / nunits
+                      - round_first;
+      l_totals[round].value = run.total;
+      l_totals[round].valid = true;
+    }
+    // Totals of preceding units in every round:
+    std::vector<total_t> pre_totals(nrounds, invalid);
+    DASH_ASSERT_RETURNS(
+      dart_exscan_custom(
+        l_totals.data(), pre_totals.data(), nrounds, sizeof(total_t),
+        &scan_totals_op<ValueType, BinaryOperation>, &binary_op,
+        team.dart_id()),
+      DART_OK);
+    if (myid == 0) {
+      std::fill(pre_totals.begin(), pre_totals.end(), invalid);
+    }
+    // Totals of all units in every round, resolved at the last unit:
+    std::vector<total_t> round_totals(nrounds, invalid);
+    if (myid == nunits - 1) {
+      for (index_t r = 0; r < nrounds; ++r) {
+        round_totals[r] = scan_combine(pre_totals[r], l_totals[r],
+                                       binary_op);
+      }
+    }
+    DASH_ASSERT_RETURNS(
+      dart_bcast(round_totals.data(), nrounds * sizeof(total_t),
+                 nunits - 1, team.dart_id()),
+      DART_OK);
+    size_t l_run = 0;
+    for (index_t r = 0; r < nrounds; ++r) {
+      if (l_totals[r].valid) {
+        l_prefix[l_run++] = scan_combine(acc, pre_totals[r], binary_op);
+      }
+      acc = scan_combine(acc, round_totals[r], binary_op);
+    }
+  } else {
+    DASH_THROW(
+      dash::exception::NotImplemented,
+      "dash::scan_impl: patterns with several blocks per unit must map "
+      "blocks to units in round-robin order");
+  }
+
+  // Apply prefixes and write runs to output range:
+  std::vector<dart_handle_t> handles;
+  for (size_t r = 0; r < l_prefix.size(); ++r) {
+    ValueType     * run_first = l_values.data() + l_run_offsets[r];
+    ValueType     * run_last  = l_values.data() + l_run_offsets[r + 1];
+    const total_t & prefix    = l_prefix[r];
+    index_t         apply_idx = 0;
+    if (!inclusive) {
+      // Runs are shifted by one element, prefix is always valid as
+      // exclusive scans require an initial value:
+      *run_first = prefix.value;
+      apply_idx  = 1;
+    }
+    if (prefix.valid) {
+      for_each_index_local(
+        policy, apply_idx, static_cast<index_t>(run_last - run_first),
+        [&](index_t i) {
+          run_first[i] = binary_op(prefix.value, run_first[i]);
+        });
+    }
+    dash::internal::copy_async_impl(
+      run_first, run_last,
+      out_first + l_runs[r].g_offset,
+      handles);
+  }
+  if (handles.size() > 0) {
+    DASH_ASSERT_RETURNS(
+      dart_waitall(&handles[0], handles.size()),
+      DART_OK);
+  }
+  team.barrier();
+  return out_first + nelem;
+}
+
+} // namespace internal
+
+/**
+ * Computes the inclusive prefix sums of the elements in the range
+ * [in_first, in_last) using the given binary operation and writes them
+ * to the range beginning at \c out_first, using the given execution
+ * policy for the local scans.
+ *
+ * Collective operation, must be called by all units in the team of the
+ * input range's pattern. Input and output range may be identical.
+ * Every unit scans the elements in its local subrange. The totals of
+ * local blocks are combined to the offset of every block in a single
+ * exchange of one total per unit, or in a single exscan of the block
+ * totals per cycle for patterns with several blocks per unit like
+ * \c dash::BLOCKCYCLIC. Patterns with several blocks per unit must
+ * assign blocks to units in round-robin order.
+ * The value type must be trivially copyable.
+ *
+ * Semantics:
+ *
+ *     out[i] = in[0] (+) in[1] (+) ... (+) in[i]
+ *
+ * \returns  Output iterator past the last element written
+ *
+ * \tparam   ExecutionPolicy  Execution policy of local phase, e.g.
+ *                            \c dash::par_unseq_local
+ * \tparam   BinaryOperation  Associative binary operation
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  class ExecutionPolicy,
+  class GlobInputIt,
+  class GlobOutputIt,
+  class BinaryOperation >
+typename std::enable_if<
+  dash::is_execution_policy<ExecutionPolicy>::value, GlobOutputIt >::type
+inclusive_scan(
+  const ExecutionPolicy & policy,
+  GlobInputIt             in_first,
+  GlobInputIt             in_last,
+  GlobOutputIt            out_first,
+  BinaryOperation         binary_op)
+{
+  typedef typename GlobInputIt::value_type value_t;
+  DASH_LOG_DEBUG("dash::inclusive_scan()");
+  return dash::internal::scan_impl(
+           policy, in_first, in_last, out_first, value_t(), false,
+           binary_op, true);
+}
+
+/**
+ * Computes the inclusive prefix sums of the elements in the range
+ * [in_first, in_last) using the given binary operation and writes them
+ * to the range beginning at \c out_first.
+ *
+ * Collective operation, must be called by all units in the team of the
+ * input range's pattern. Input and output range may be identical.
+ *
+ * \returns  Output iterator past the last element written
+ *
+ * \tparam   BinaryOperation  Associative binary operation
+ *
+ * \see      dash::inclusive_scan
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  class GlobInputIt,
+  class GlobOutputIt,
+  class BinaryOperation >
+typename std::enable_if<
+  !dash::is_execution_policy<GlobInputIt>::value, GlobOutputIt >::type
+inclusive_scan(
+  GlobInputIt     in_first,
+  GlobInputIt     in_last,
+  GlobOutputIt    out_first,
+  BinaryOperation binary_op)
+{
+  return dash::inclusive_scan(dash::seq_local, in_first, in_last,
+                              out_first, binary_op);
+}
+
+/**
+ * Computes the inclusive prefix sums of the elements in the range
+ * [in_first, in_last) and writes them to the range beginning at
+ * \c out_first, using the given execution policy for the local scans.
+ *
+ * Collective operation, must be called by all units in the team of the
+ * input range's pattern.
+ *
+ * \see      dash::inclusive_scan
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  class ExecutionPolicy,
+  class GlobInputIt,
+  class GlobOutputIt >
+typename std::enable_if<
+  dash::is_execution_policy<ExecutionPolicy>::value, GlobOutputIt >::type
+inclusive_scan(
+  const ExecutionPolicy & policy,
+  GlobInputIt             in_first,
+  GlobInputIt             in_last,
+  GlobOutputIt            out_first)
+{
+  typedef typename GlobInputIt::value_type value_t;
+  return dash::inclusive_scan(policy, in_first, in_last, out_first,
+                              dash::plus<value_t>());
+}
+
+/**
+ * Computes the inclusive prefix sums of the elements in the range
+ * [in_first, in_last) and writes them to the range beginning at
+ * \c out_first.
+ *
+ * Collective operation, must be called by all units in the team of the
+ * input range's pattern.
+ *
+ * \see      dash::inclusive_scan
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  class GlobInputIt,
+  class GlobOutputIt >
+GlobOutputIt inclusive_scan(
+  GlobInputIt     in_first,
+  GlobInputIt     in_last,
+  GlobOutputIt    out_first)
+{
+  return dash::inclusive_scan(dash::seq_local, in_first, in_last,
+                              out_first);
+}
+
+/**
+ * Computes the inclusive prefix sums of the elements in the range
+ * [in_first, in_last) using the given binary operation, starting with
+ * the initial value \c init, using the given execution policy for the
+ * local scans.
+ *
+ * Collective operation, must be called by all units in the team of the
+ * input range's pattern.
+ *
+ * Semantics:
+ *
+ *     out[i] = init (+) in[0] (+) in[1] (+) ... (+) in[i]
+ *
+ * \see      dash::inclusive_scan
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  class ExecutionPolicy,
+  class GlobInputIt,
+  class GlobOutputIt,
+  class BinaryOperation,
+  class ValueType >
+typename std::enable_if<
+  dash::is_execution_policy<ExecutionPolicy>::value, GlobOutputIt >::type
+inclusive_scan(
+  const ExecutionPolicy & policy,
+  GlobInputIt             in_first,
+  GlobInputIt             in_last,
+  GlobOutputIt            out_first,
+  BinaryOperation         binary_op,
+  ValueType               init)
+{
+  DASH_LOG_DEBUG("dash::inclusive_scan()");
+  return dash::internal::scan_impl(
+           policy, in_first, in_last, out_first, init, true, binary_op,
+           true);
+}
+
+/**
+ * Computes the inclusive prefix sums of the elements in the range
+ * [in_first, in_last) using the given binary operation, starting with
+ * the initial value \c init.
+ *
+ * Collective operation, must be called by all units in the team of the
+ * input range's pattern.
+ *
+ * \see      dash::inclusive_scan
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  class GlobInputIt,
+  class GlobOutputIt,
+  class BinaryOperation,
+  class ValueType >
+typename std::enable_if<
+  !dash::is_execution_policy<GlobInputIt>::value, GlobOutputIt >::type
+inclusive_scan(
+  GlobInputIt     in_first,
+  GlobInputIt     in_last,
+  GlobOutputIt    out_first,
+  BinaryOperation binary_op,
+  ValueType       init)
+{
+  return dash::inclusive_scan(dash::seq_local, in_first, in_last,
+                              out_first, binary_op, init);
+}
+
+/**
+ * Computes the exclusive prefix sums of the elements in the range
+ * [in_first, in_last) using the given binary operation, starting with
+ * the initial value \c init, and writes them to the range beginning at
+ * \c out_first, using the given execution policy for the local scans.
+ *
+ * Collective operation, must be called by all units in the team of the
+ * input range's pattern. Input and output range may be identical.
+ *
+ * Semantics:
+ *
+ *     out[0] = init
+ *     out[i] = init (+) in[0] (+) in[1] (+) ... (+) in[i-1]
+ *
+ * Example:
+ *
+ * \code
+ *     // Row offsets from number of non-zero elements per row:
+ *     dash::exclusive_scan(row_nnz.begin(), row_nnz.end(),
+ *                          row_offsets.begin(), 0);
+ * \endcode
+ *
+ * \returns  Output iterator past the last element written
+ *
+ * \see      dash::inclusive_scan
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  class ExecutionPolicy,
+  class GlobInputIt,
+  class GlobOutputIt,
+  class ValueType,
+  class BinaryOperation >
+typename std::enable_if<
+  dash::is_execution_policy<ExecutionPolicy>::value, GlobOutputIt >::type
+exclusive_scan(
+  const ExecutionPolicy & policy,
+  GlobInputIt             in_first,
+  GlobInputIt             in_last,
+  GlobOutputIt            out_first,
+  ValueType               init,
+  BinaryOperation         binary_op)
+{
+  DASH_LOG_DEBUG("dash::exclusive_scan()");
+  return dash::internal::scan_impl(
+           policy, in_first, in_last, out_first, init, true, binary_op,
+           false);
+}
+
+/**
+ * Computes the exclusive prefix sums of the elements in the range
+ * [in_first, in_last) using the given binary operation, starting with
+ * the initial value \c init, and writes them to the range beginning at
+ * \c out_first.
+ *
+ * Collective operation, must be called by all units in the team of the
+ * input range's pattern.
+ *
+ * \see      dash::exclusive_scan
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  class GlobInputIt,
+  class GlobOutputIt,
+  class ValueType,
+  class BinaryOperation >
+typename std::enable_if<
+  !dash::is_execution_policy<GlobInputIt>::value, GlobOutputIt >::type
+exclusive_scan(
+  GlobInputIt     in_first,
+  GlobInputIt     in_last,
+  GlobOutputIt    out_first,
+  ValueType       init,
+  BinaryOperation binary_op)
+{
+  return dash::exclusive_scan(dash::seq_local, in_first, in_last,
+                              out_first, init, binary_op);
+}
+
+/**
+ * Computes the exclusive prefix sums of the elements in the range
+ * [in_first, in_last), starting with the initial value \c init, using
+ * the given execution policy for the local scans.
+ *
+ * Collective operation, must be called by all units in the team of the
+ * input range's pattern.
+ *
+ * \see      dash::exclusive_scan
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  class ExecutionPolicy,
+  class GlobInputIt,
+  class GlobOutputIt,
+  class ValueType >
+typename std::enable_if<
+  dash::is_execution_policy<ExecutionPolicy>::value, GlobOutputIt >::type
+exclusive_scan(
+  const ExecutionPolicy & policy,
+  GlobInputIt             in_first,
+  GlobInputIt             in_last,
+  GlobOutputIt            out_first,
+  ValueType               init)
+{
+  return dash::exclusive_scan(policy, in_first, in_last, out_first, init,
+                              dash::plus<ValueType>());
+}
+
+/**
+ * Computes the exclusive prefix sums of the elements in the range
+ * [in_first, in_last), starting with the initial value \c init.
+ *
+ * Collective operation, must be called by all units in the team of the
+ * input range's pattern.
+ *
+ * \see      dash::exclusive_scan
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  class GlobInputIt,
+  class GlobOutputIt,
+  class ValueType >
+typename std::enable_if<
+  !dash::is_execution_policy<GlobInputIt>::value, GlobOutputIt >::type
+exclusive_scan(
+  GlobInputIt     in_first,
+  GlobInputIt     in_last,
+  GlobOutputIt    out_first,
+  ValueType       init)
+{
+  return dash::exclusive_scan(dash::seq_local, in_first, in_last,
+                              out_first, init);
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__SCAN_H__
@@ -0,0 +1,423 @@
+#ifndef DASH__ALGORITHM__SORT_H__
+#define DASH__ALGORITHM__SORT_H__
+
+#include <dash/GlobIter.h>
+#include <dash/GlobMem.h>
+#include <dash/Team.h>
+#include <dash/Exception.h>
+#include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/Copy.h>
+#include <dash/algorithm/ExecutionPolicy.h>
+#include <dash/internal/Logging.h>
+#include <dash/dart/if/dart_communication.h>
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace dash {
+
+namespace internal {
+
+/**
+ * Sample of a unit's sorted local elements used in splitter selection.
+ * Equivalent elements are ordered by their unit and local position, so
+ * buckets of equivalent elements are split between units.
+ */
+template<typename ElementType>
+struct sort_sample {
+  ElementType value;
+  dart_unit_t unit;
+  size_t      index;
+  bool        valid;
+};
+
+/**
+ * Strict weak ordering of samples by value, unit and local position.
+ */
+template<
+  typename ElementType,
+  class    Compare >
+struct sort_sample_less {
+  Compare compare;
+
+  bool operator()(
+    const sort_sample<ElementType> & lhs,
+    const sort_sample<ElementType> & rhs) const
+  {
+    if (compare(lhs.value, rhs.value)) {
+      return true;
+    }
+    if (compare(rhs.value, lhs.value)) {
+      return false;
+    }
+    return lhs.unit < rhs.unit ||
+           (lhs.unit == rhs.unit && lhs.index < rhs.index);
+  }
+};
+
+/**
+ * Selects \c nunits - 1 splitters partitioning the elements into buckets
+ * of similar size from regular samples of every unit's sorted local
+ * range.
+ *
+ * Collective operation.
+ */
+template<
+  typename ElementType,
+  class    Compare >
+std::vector< sort_sample<ElementType> > sort_splitters(
+  const ElementType * l_first,
+  const ElementType * l_last,
+  dash::Team        & team,
+  Compare             compare)
+{
+  typedef sort_sample<ElementType> sample_t;
+  size_t nunits   = team.size();
+  size_t nlocal   = l_last - l_first;
+  // Oversampling by number of units:
+  size_t nsamples = nunits;
+  std::vector<sample_t> l_samples(nsamples);
+  for (size_t s = 0; s < nsamples; ++s) {
+    l_samples[s].valid = nlocal > 0;
+    l_samples[s].unit  = team.myid();
+    l_samples[s].index = ((2 * s + 1) * nlocal) / (2 * nsamples);
+    if (nlocal > 0) {
+      l_samples[s].value = l_first[l_samples[s].index];
+    }
+  }
+  std::vector<sample_t> g_samples(nsamples * nunits);
+  DASH_ASSERT_RETURNS(
+    dart_allgather(
+      l_samples.data(),
+      g_samples.data(),
+      nsamples * sizeof(sample_t),
+      team.dart_id()),
+    DART_OK);
+  std::vector<sample_t> samples;
+  samples.reserve(g_samples.size());
+  for (auto & sample : g_samples) {
+    if (sample.valid) {
+      samples.push_back(sample);
+    }
+  }
+  std::sort(samples.begin(), samples.end(),
+            sort_sample_less<ElementType, Compare> { compare });
+  std::vector<sample_t> splitters;
+  splitters.reserve(nunits - 1);
+  for (size_t b = 1; b < nunits && samples.size() > 0; ++b) {
+    splitters.push_back(samples[(b * samples.size()) / nunits]);
+  }
+  return splitters;
+}
+
+/**
+ * Offset past the last element in the sorted local range of the calling
+ * unit that is not greater than the given splitter in the order of
+ * value, unit and local position.
+ */
+template<
+  typename ElementType,
+  class    Compare >
+size_t sort_bucket_end(
+  const ElementType              * l_first,
+  const ElementType              * l_last,
+  const sort_sample<ElementType> & splitter,
+  dart_unit_t                      myid,
+  Compare                          compare)
+{
+  size_t l_lower = std::lower_bound(l_first, l_last, splitter.value,
+                                    compare) - l_first;
+  size_t l_upper = std::upper_bound(l_first, l_last, splitter.value,
+                                    compare) - l_first;
+  if (myid < splitter.unit) {
+    return l_upper;
+  }
+  if (myid > splitter.unit) {
+    return l_lower;
+  }
+  return std::min(std::max(splitter.index + 1, l_lower), l_upper);
+}
+
+/**
+ * Merges the consecutive sorted runs in \c buffer, separated by the given
+ * run offsets, into a single sorted run.
+ */
+template<
+  typename ElementType,
+  class    Compare >
+void merge_runs(
+  ElementType         * buffer,
+  std::vector<size_t>   run_offsets,
+  Compare               compare)
+{
+  // Bottom-up merge of adjacent runs, run_offsets contains the end offset
+  // of the last run:
+  while (run_offsets.size() > 2) {
+    std::vector<size_t> merged_offsets;
+    merged_offsets.reserve(run_offsets.size() / 2 + 1);
+    size_t r = 0;
+    for (; r + 2 < run_offsets.size(); r += 2) {
+      std::inplace_merge(buffer + run_offsets[r],
+                         buffer + run_offsets[r + 1],
+                         buffer + run_offsets[r + 2],
+                         compare);
+      merged_offsets.push_back(run_offsets[r]);
+    }
+    for (; r < run_offsets.size(); ++r) {
+      merged_offsets.push_back(run_offsets[r]);
+    }
+    run_offsets.swap(merged_offsets);
+  }
+}
+
+/**
+ * Sorts the local range [l_first, l_last) using the given execution
+ * policy. Every thread sorts its chunk, sorted chunks are merged.
+ */
+template<
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    Compare >
+void sort_local(
+  const ExecutionPolicy & policy,
+  ElementType           * l_first,
+  ElementType           * l_last,
+  Compare                 compare)
+{
+  // End offset of every thread's chunk, 0 for threads without chunk:
+  std::vector<size_t> chunk_ends(local_max_threads(policy), 0);
+  for_each_chunk_local(
+    policy, static_cast<size_t>(0), static_cast<size_t>(l_last - l_first),
+    [&](size_t chunk_begin, size_t chunk_end, int thread) {
+      std::sort(l_first + chunk_begin, l_first + chunk_end, compare);
+      chunk_ends[thread] = chunk_end;
+    });
+  // Chunks are contiguous and ordered by thread:
+  std::vector<size_t> run_offsets(1, 0);
+  for (auto chunk_end : chunk_ends) {
+    if (chunk_end > 0) {
+      run_offsets.push_back(chunk_end);
+    }
+  }
+  merge_runs(l_first, run_offsets, compare);
+}
+
+} // namespace internal
+
+/**
+ * Sorts the elements in the range [first,last) in ascending order with
+ * respect to the given comparison function, using the given execution
+ * policy for the local sort.
+ *
+ * Collective operation, must be called by all units in the team of the
+ * range's pattern. Implemented as sample sort:
+ *
+ * 1. Every unit sorts the elements in its local subrange. In parallel
+ *    execution, threads sort chunks of the local subrange which are
+ *    merged subsequently.
+ * 2. Splitters partitioning the elements into one bucket per unit are
+ *    selected from regular samples of all units' local elements.
+ *    Equivalent elements are ordered by their unit and local position,
+ *    so duplicate keys are split between buckets.
+ * 3. Every unit transfers its elements in a bucket to the bucket's unit
+ *    with a single put operation into a receive region of exact size.
+ *    Receive offsets are resolved in a single exchange of the bucket
+ *    sizes of all units, every unit only allocates memory for its own
+ *    bucket.
+ * 4. Every unit merges the sorted runs received in its bucket and copies
+ *    them to their final position in the range.
+ *
+ * The range keeps its pattern, so every unit holds the same number of
+ * elements in its local memory as before.
+ * The sort is not stable. Elements must be trivially copyable.
+ *
+ * Example:
+ *
+ * \code
+ *     dash::Array<int> keys(nkeys, dash::BLOCKED);
+ *     // ...
+ *     dash::sort(keys.begin(), keys.end());
+ * \endcode
+ *
+ * \tparam      ExecutionPolicy  Execution policy of the local sort, e.g.
+ *                               \c dash::par_unseq_local
+ * \tparam      ElementType      Type of the elements in the sequence
+ * \tparam      Compare          Binary predicate type, defaults to
+ *                               std::less
+ * \complexity  O(nl/t log nl) + O(n/p log p) local operations with
+ *              \c nl local elements, \c t threads per unit and \c p
+ *              units in the team, and O(p) transfers per unit
+ *
+ * \ingroup     DashAlgorithms
+ */
+template<
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    PatternType,
+  class    Compare = std::less<ElementType> >
+typename std::enable_if<
+  dash::is_execution_policy<ExecutionPolicy>::value >::type
+sort(
+  /// Execution policy of the local sort
+  const ExecutionPolicy            & policy,
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType> first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType> last,
+  /// Element comparison function, defaults to std::less
+  Compare compare = Compare())
+{
+  static_assert(PatternType::ndim() == 1,
+                "dash::sort requires a one-dimensional pattern");
+  static_assert(std::is_trivially_copyable<ElementType>::value,
+                "dash::sort requires a trivially copyable element type");
+  if (dash::distance(first, last) < 2) {
+    return;
+  }
+  auto & team   = first.pattern().team();
+  auto   myid   = team.myid();
+  size_t nunits = team.size();
+  DASH_LOG_DEBUG("dash::sort()", "nelem:", dash::distance(first, last));
+
+  // Local elements in the range are contiguous in local memory in
+  // one-dimensional patterns:
+  auto          l_idx_range = dash::local_index_range(first, last);
+  ElementType * l_first     = first.globmem().lbegin(myid) +
+                              l_idx_range.begin;
+  ElementType * l_last      = first.globmem().lbegin(myid) +
+                              l_idx_range.end;
+  internal::sort_local(policy, l_first, l_last, compare);
+
+  auto splitters = internal::sort_splitters<ElementType>(
+                     l_first, l_last, team, compare);
+  // Bucket of every unit in the local range, equivalent elements are
+  // ordered by unit and local position:
+  std::vector<size_t> l_bucket_offsets(nunits + 1, 0);
+  for (size_t b = 0; b < splitters.size(); ++b) {
+    l_bucket_offsets[b + 1] = internal::sort_bucket_end(
+                                l_first, l_last, splitters[b], myid,
+                                compare);
+  }
+  for (size_t b = splitters.size() + 1; b <= nunits; ++b) {
+    l_bucket_offsets[b] = l_last - l_first;
+  }
+  std::vector<size_t> l_bucket_sizes(nunits);
+  for (size_t b = 0; b < nunits; ++b) {
+    l_bucket_sizes[b] = l_bucket_offsets[b + 1] - l_bucket_offsets[b];
+  }
+  // Bucket sizes of all units, indexed [src * nunits + bucket]:
+  std::vector<size_t> bucket_sizes(nunits * nunits);
+  DASH_ASSERT_RETURNS(
+    dart_allgather(
+      l_bucket_sizes.data(),
+      bucket_sizes.data(),
+      nunits * sizeof(size_t),
+      team.dart_id()),
+    DART_OK);
+  // Total size and global offset of every bucket:
+  std::vector<size_t> bucket_totals(nunits, 0);
+  std::vector<size_t> bucket_goffsets(nunits, 0);
+  for (size_t src = 0; src < nunits; ++src) {
+    for (size_t b = 0; b < nunits; ++b) {
+      bucket_totals[b] += bucket_sizes[src * nunits + b];
+    }
+  }
+  for (size_t b = 1; b < nunits; ++b) {
+    bucket_goffsets[b] = bucket_goffsets[b - 1] + bucket_totals[b - 1];
+  }
+  DASH_LOG_TRACE("dash::sort", "local bucket size:", bucket_totals[myid]);
+
+  // Receive regions of all buckets in memory of the bucket's size
+  // registered at every unit:
+  std::vector<ElementType>   recv_local(
+                               std::max<size_t>(bucket_totals[myid], 1));
+  dash::GlobMem<ElementType> recv_mem(team, recv_local.data(),
+                                      recv_local.size());
+  ElementType * recv_buf = recv_local.data();
+  // MPI uses offset type int, do not transfer more than INT_MAX bytes:
+  size_t max_chunk = std::numeric_limits<int>::max() / sizeof(ElementType);
+  std::vector<dart_handle_t> handles;
+  for (size_t b = 0; b < nunits; ++b) {
+    // Offset of this unit's run in the receive region of bucket b:
+    size_t recv_offset = 0;
+    for (size_t src = 0; src < myid; ++src) {
+      recv_offset += bucket_sizes[src * nunits + b];
+    }
+    ElementType * run   = l_first + l_bucket_offsets[b];
+    size_t        nrun  = l_bucket_sizes[b];
+    if (b == static_cast<size_t>(myid)) {
+      std::copy(run, run + nrun, recv_buf + recv_offset);
+      continue;
+    }
+    for (size_t offset = 0; offset < nrun; offset += max_chunk) {
+      size_t        nchunk = std::min(max_chunk, nrun - offset);
+      dart_handle_t handle;
+      DASH_ASSERT_RETURNS(
+        dart_put_handle(
+          recv_mem.index_to_gptr(b, recv_offset + offset),
+          run + offset,
+          nchunk * sizeof(ElementType),
+          &handle),
+        DART_OK);
+      if (handle != NULL) {
+        handles.push_back(handle);
+      }
+    }
+  }
+  if (handles.size() > 0) {
+    DASH_ASSERT_RETURNS(
+      dart_waitall(&handles[0], handles.size()),
+      DART_OK);
+  }
+  // Wait for all units to complete transfers from their local range
+  // before it is overwritten:
+  team.barrier();
+
+  // Merge sorted runs received from all units:
+  std::vector<size_t> run_offsets(nunits + 1, 0);
+  for (size_t src = 0; src < nunits; ++src) {
+    run_offsets[src + 1] = run_offsets[src] +
+                           bucket_sizes[src * nunits + myid];
+  }
+  internal::merge_runs(recv_buf, run_offsets, compare);
+  // Copy bucket to its final position in the range:
+  if (bucket_totals[myid] > 0) {
+    dash::copy(recv_buf, recv_buf + bucket_totals[myid],
+               first + bucket_goffsets[myid]);
+  }
+  team.barrier();
+  DASH_LOG_DEBUG("dash::sort >");
+}
+
+/**
+ * Sorts the elements in the range [first,last) in ascending order with
+ * respect to the given comparison function.
+ *
+ * Collective operation, must be called by all units in the team of the
+ * range's pattern.
+ *
+ * \see         dash::sort
+ *
+ * \ingroup     DashAlgorithms
+ */
+template<
+  typename ElementType,
+  class    PatternType,
+  class    Compare = std::less<ElementType> >
+void sort(
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType> first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType> last,
+  /// Element comparison function, defaults to std::less
+  Compare compare = Compare())
+{
+  dash::sort(dash::seq_local, first, last, compare);
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__SORT_H__
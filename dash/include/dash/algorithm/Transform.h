@@ -6,8 +6,11 @@
 #include <dash/GlobAsyncRef.h>
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
+#include <dash/algorithm/ExecutionPolicy.h>
 #include <dash/dart/if/dart_communication.h>
 
+#include <type_traits>
+
 namespace dash {
 
 namespace internal {
@@ -144,7 +147,8 @@ OutputIt transform(
   BinaryOperation binary_op);
 
 /**
- * Transform operation on ranges with identical distribution and start offset.
+ * Transform operation on ranges with identical distribution and start offset,
+ * using the given execution policy for the local phase.
  * In this case, no communication is needed as all output values can be
  * obtained from input values in local memory:
  *
@@ -157,16 +161,20 @@ OutputIt transform(
  */
 template<
   typename ValueType,
+  class ExecutionPolicy,
   class InputAIt,
   class InputBIt,
   class OutputIt,
   class BinaryOperation >
-OutputIt transform_local(
-  InputAIt        in_a_first,
-  InputAIt        in_a_last,
-  InputBIt        in_b_first,
-  OutputIt        out_first,
-  BinaryOperation binary_op)
+typename std::enable_if<
+  dash::is_execution_policy<ExecutionPolicy>::value, OutputIt >::type
+transform_local(
+  const ExecutionPolicy & policy,
+  InputAIt                in_a_first,
+  InputAIt                in_a_last,
+  InputBIt                in_b_first,
+  OutputIt                out_first,
+  BinaryOperation         binary_op)
 {
   DASH_LOG_DEBUG("dash::transform_local()");
   DASH_ASSERT_MSG(in_a_first.pattern() == in_b_first.pattern(),
@@ -188,7 +196,7 @@ OutputIt transform_local(
   // Global offset of first local element:
   auto g_offset_first    = in_a_first.pattern().global(0);
   // Number of elements in global ranges:
-  auto num_gvalues       = dash::distance(in_a_first, in_b_first);
+  auto num_gvalues       = dash::distance(in_a_first, in_a_last);
   DASH_LOG_TRACE_VAR("dash::transform_local", num_gvalues);
   // Number of local elements:
   DASH_LOG_TRACE("dash::transform_local", "local elements:", lend_a-lbegin_a);
@@ -197,13 +205,48 @@ OutputIt transform_local(
   // Local pointer of initial output element:
   ValueType * lbegin_out = dash::local(out_first + g_offset_first);
   // Generate output values:
-  for (; lbegin_a != lend_a; ++lbegin_a, ++lbegin_b, ++lbegin_out) {
-    *lbegin_out = binary_op(*lbegin_a, *lbegin_b);
-  }
+  dash::internal::for_each_chunk_local(
+    policy,
+    static_cast<decltype(lend_a - lbegin_a)>(0),
+    lend_a - lbegin_a,
+    [&](decltype(lend_a - lbegin_a) chunk_begin,
+        decltype(lend_a - lbegin_a) chunk_end,
+        int) {
+      for (auto i = chunk_begin; i != chunk_end; ++i) {
+        lbegin_out[i] = binary_op(lbegin_a[i], lbegin_b[i]);
+      }
+    });
   // Return out_end iterator past final transformed element;
   return out_first + num_gvalues;
 }
 
+/**
+ * Transform operation on ranges with identical distribution and start offset.
+ *
+ * \see  dash::transform_local
+ */
+template<
+  typename ValueType,
+  class InputAIt,
+  class InputBIt,
+  class OutputIt,
+  class BinaryOperation >
+OutputIt transform_local(
+  InputAIt        in_a_first,
+  InputAIt        in_a_last,
+  InputBIt        in_b_first,
+  OutputIt        out_first,
+  BinaryOperation binary_op)
+{
+  return dash::transform_local<ValueType>(
+           dash::seq_local,
+           in_a_first,
+           in_a_last,
+           in_b_first,
+           out_first,
+           binary_op);
+}
+
 template<
   typename ValueType,
   class InputIt,
@@ -324,6 +367,52 @@ GlobOutputIt transform(
   return out_first + global_offset + num_local_elements;
 }
 
+/**
+ * Specialization of \c dash::transform for global lhs input range, using
+ * the given execution policy for the local phase.
+ * The execution policy applies if input and output ranges have identical
+ * distribution and start offset so that all units operate on local
+ * memory only, otherwise elements are transformed by the target units
+ * of \c dart_accumulate.
+ *
+ * \tparam   ExecutionPolicy  Execution policy of local phase, e.g.
+ *                            \c dash::par_unseq_local
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  class ExecutionPolicy,
+  typename ValueType,
+  class PatternType,
+  class GlobInputIt,
+  class GlobOutputIt,
+  class BinaryOperation >
+typename std::enable_if<
+  dash::is_execution_policy<ExecutionPolicy>::value, GlobOutputIt >::type
+transform(
+  const ExecutionPolicy          & policy,
+  GlobIter<ValueType, PatternType> in_a_first,
+  GlobIter<ValueType, PatternType> in_a_last,
+  GlobInputIt                      in_b_first,
+  GlobOutputIt                     out_first,
+  BinaryOperation                  binary_op)
+{
+  if (in_a_first.pattern() == in_b_first.pattern() &&
+      in_a_first.pattern() == out_first.pattern()  &&
+      in_a_first.pos()     == in_b_first.pos()     &&
+      in_a_first.pos()     == out_first.pos()) {
+    return dash::transform_local<ValueType>(
+             policy,
+             in_a_first,
+             in_a_last,
+             in_b_first,
+             out_first,
+             binary_op);
+  }
+  return dash::transform(in_a_first, in_a_last, in_b_first, out_first,
+                         binary_op);
+}
+
 /**
  * Specialization of \c dash::transform as non-blocking operation.
  *
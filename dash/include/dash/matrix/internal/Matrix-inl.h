@@ -354,7 +354,7 @@ Matrix<T, NumDim, IndexT, PatternT>
   size_type offset,
   size_type extent)
 {
-  return _ref.sub<SubDimension>(offset, extent);
+  return _ref.template sub<SubDimension>(offset, extent);
 }
 
 template <typename T, dim_t NumDim, typename IndexT, class PatternT>
@@ -364,7 +364,7 @@ Matrix<T, NumDim, IndexT, PatternT>
 ::sub(
   size_type n)
 {
-  return _ref.sub<SubDimension>(n);
+  return _ref.template sub<SubDimension>(n);
 }
 
 template <typename T, dim_t NumDim, typename IndexT, class PatternT>
@@ -373,7 +373,7 @@ Matrix<T, NumDim, IndexT, PatternT>
 ::col(
   size_type n)
 {
-  return _ref.sub<0>(n);
+  return _ref.template sub<0>(n);
 }
 
 template <typename T, dim_t NumDim, typename IndexT, class PatternT>
@@ -382,7 +382,7 @@ Matrix<T, NumDim, IndexT, PatternT>
 ::row(
   size_type n)
 {
-  return _ref.sub<1>(n);
+  return _ref.template sub<1>(n);
 }
 
 template <typename T, dim_t NumDim, typename IndexT, class PatternT>
@@ -392,7 +392,7 @@ Matrix<T, NumDim, IndexT, PatternT>
   size_type offset,
   size_type extent)
 {
-  return _ref.sub<1>(offset, extent);
+  return _ref.template sub<1>(offset, extent);
 }
 
 template <typename T, dim_t NumDim, typename IndexT, class PatternT>
@@ -402,7 +402,7 @@ Matrix<T, NumDim, IndexT, PatternT>
   size_type offset,
   size_type extent)
 {
-  return _ref.sub<0>(offset, extent);
+  return _ref.template sub<0>(offset, extent);
 }
 
 template <typename T, dim_t NumDim, typename IndexT, class PatternT>
@@ -445,7 +445,7 @@ inline bool Matrix<T, NumDim, IndexT, PatternT>
 ::is_local(
   size_type g_pos) const
 {
-  return _ref.is_local<Dimension>(g_pos);
+  return _ref.template is_local<Dimension>(g_pos);
 }
 
 template <typename T, dim_t NumDim, typename IndexT, class PatternT>
@@ -454,7 +454,7 @@ inline dash::HView<Matrix<T, NumDim, IndexT, PatternT>, level>
 Matrix<T, NumDim, IndexT, PatternT>
 ::hview()
 {
-  return _ref.hview<level>();
+  return _ref.template hview<level>();
 }
 
 template <typename T, dim_t NumDim, typename IndexT, class PatternT>
@@ -7,6 +7,7 @@
 
 #include <iostream>
 #include <unistd.h>
+#include <sched.h>
 #include <string>
 #include <vector>
 #include <array>
@@ -102,14 +103,28 @@ public:
     int numa_node = 0;
 #ifdef DASH_ENABLE_NUMA
     int cpu;
-    cpu       = sched_getcpu();
+    cpu       = UnitCPU();
     numa_node = numa_node_of_cpu(cpu);
 #endif
     return numa_node;
   }
 
+  /**
+   * The CPU the calling unit is pinned to or, if the unit is not
+   * pinned to a single CPU, the CPU it is currently running on.
+   */
   static inline int UnitCPU() {
 #ifdef DASH__PLATFORM__LINUX
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    if (sched_getaffinity(0, sizeof(cpuset), &cpuset) == 0 &&
+        CPU_COUNT(&cpuset) == 1) {
+      for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+        if (CPU_ISSET(cpu, &cpuset)) {
+          return cpu;
+        }
+      }
+    }
     return sched_getcpu();
 #endif
     DASH_THROW(
@@ -18,6 +18,9 @@
 #include <dash/GlobIter.h>
 #include <dash/GlobRef.h>
 #include <dash/GlobAsyncRef.h>
+#include <dash/GlobAsyncBatch.h>
+#include <dash/PrefetchRange.h>
+#include <dash/WriteCombiningIter.h>
 
 #include <dash/Onesided.h>
 
@@ -26,6 +29,8 @@
 #include <dash/Container.h>
 #include <dash/Shared.h>
 #include <dash/SharedCounter.h>
+#include <dash/RPC.h>
+#include <dash/Tasks.h>
 #include <dash/Exception.h>
 #include <dash/Algorithm.h>
 
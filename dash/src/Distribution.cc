@@ -1,6 +1,8 @@
 #include <dash/Enums.h>
 #include <dash/Distribution.h>
 
+#include <sstream>
+
 const dash::Distribution dash::BLOCKED =
   dash::Distribution(dash::internal::DIST_BLOCKED, -1);
 
@@ -18,3 +20,21 @@ dash::Distribution dash::BLOCKCYCLIC(int blockSize) {
   return Distribution(dash::internal::DIST_BLOCKCYCLIC, blockSize);
 }
 
+
+std::ostream & dash::operator<<(
+  std::ostream             & os,
+  const dash::Distribution & distribution)
+{
+  std::ostringstream ss;
+  ss << "Distribution(";
+  switch (distribution.type) {
+    case dash::internal::DIST_NONE:        ss << "NONE";        break;
+    case dash::internal::DIST_BLOCKED:     ss << "BLOCKED";     break;
+    case dash::internal::DIST_CYCLIC:      ss << "CYCLIC";      break;
+    case dash::internal::DIST_BLOCKCYCLIC: ss << "BLOCKCYCLIC"; break;
+    case dash::internal::DIST_TILE:        ss << "TILE";        break;
+    default:                               ss << "UNDEFINED";   break;
+  }
+  ss << "," << distribution.blocksz << ")";
+  return operator<<(os, ss.str());
+}
@@ -1,5 +1,6 @@
 #include <dash/Init.h>
 #include <dash/Team.h>
+#include <dash/RPC.h>
 #include <dash/util/Locality.h>
 
 namespace dash {
@@ -13,6 +14,7 @@ void dash::init(int *argc, char ***argv)
   DASH_LOG_DEBUG("dash::init()");
   dart_init(argc,argv);
   dash::_initialized = true;
+  dash::internal::rpc_init();
   dash::util::Locality::init();
   DASH_LOG_DEBUG("dash::init >");
 }
@@ -27,8 +29,8 @@ void dash::finalize()
     return;
   }
 
-  // Wait for all units:
-  dash::barrier();
+  // Complete remote procedure calls and wait for all units:
+  dash::internal::rpc_finalize();
 
   // Deallocate global memory allocated in teams:
   DASH_LOG_DEBUG("dash::finalize", "free team global memory");
@@ -0,0 +1,231 @@
+#include <dash/RPC.h>
+#include <dash/Exception.h>
+#include <dash/internal/Logging.h>
+
+#include <cstring>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace dash {
+namespace internal {
+
+namespace {
+
+/// DART handler of remote procedure call messages
+dart_am_handler_id_t _rpc_call_handler  = -1;
+/// DART handler of replies of remote procedure calls
+dart_am_handler_id_t _rpc_reply_handler = -1;
+/// Last token of a reply
+uint64_t             _rpc_last_token    = 0;
+/// Whether the DART implementation supports active messages
+bool                 _rpc_supported     = false;
+/// Whether the calling unit has sent a call or reply since rpc_init
+int                  _rpc_issued        = 0;
+
+/**
+ * Remote procedures by key. Procedures are registered in static
+ * initialization, so the registry is created on first use.
+ */
+std::unordered_map<uint64_t, rpc_invoke_t> & rpc_registry()
+{
+  static std::unordered_map<uint64_t, rpc_invoke_t> registry;
+  return registry;
+}
+
+/// Replies of remote procedure calls that have not arrived yet, by token
+std::unordered_map< uint64_t, std::shared_ptr<rpc_reply_t> >
+  _rpc_pending_replies;
+
+void rpc_call_handler(
+  dart_unit_t  source,
+  const void * payload,
+  size_t       nbytes,
+  void       * userdata)
+{
+  rpc_header_t header;
+  std::memcpy(&header, payload, sizeof(rpc_header_t));
+  auto & registry  = rpc_registry();
+  auto   procedure = registry.find(header.key);
+  if (procedure == registry.end()) {
+    DASH_LOG_ERROR("dash::rpc", "unknown procedure", header.key,
+                   "called by unit", source);
+    return;
+  }
+  procedure->second(
+    source,
+    static_cast<const char *>(payload) + sizeof(rpc_header_t),
+    header.reply_token);
+}
+
+void rpc_reply_handler(
+  dart_unit_t  source,
+  const void * payload,
+  size_t       nbytes,
+  void       * userdata)
+{
+  uint64_t token;
+  std::memcpy(&token, payload, sizeof(uint64_t));
+  auto pending = _rpc_pending_replies.find(token);
+  if (pending == _rpc_pending_replies.end()) {
+    DASH_LOG_ERROR("dash::rpc", "unexpected reply", token,
+                   "from unit", source);
+    return;
+  }
+  const char * value = static_cast<const char *>(payload) +
+                       sizeof(uint64_t);
+  auto & reply = *(pending->second);
+  reply.value.assign(value, value + (nbytes - sizeof(uint64_t)));
+  reply.ready = true;
+  _rpc_pending_replies.erase(pending);
+}
+
+} // namespace
+
+void rpc_init()
+{
+  DASH_LOG_DEBUG("dash::internal::rpc_init()",
+                 "procedures:", rpc_registry().size());
+  _rpc_issued = 0;
+  auto ret = dart_am_register(&rpc_call_handler, nullptr,
+                              &_rpc_call_handler);
+  _rpc_supported = (ret == DART_OK);
+  if (ret == DART_ERR_NOTSUPPORTED) {
+    DASH_LOG_DEBUG("dash::internal::rpc_init",
+                   "active messages not supported, rpc disabled");
+    return;
+  }
+  DASH_ASSERT_RETURNS(ret, DART_OK);
+  DASH_ASSERT_RETURNS(
+    dart_am_register(&rpc_reply_handler, nullptr, &_rpc_reply_handler),
+    DART_OK);
+}
+
+void rpc_finalize()
+{
+  int issued = 0;
+  DASH_ASSERT_RETURNS(
+    dart_allreduce(
+      &_rpc_issued,
+      &issued,
+      1,
+      DART_TYPE_INT,
+      DART_OP_MAX,
+      DART_TEAM_ALL),
+    DART_OK);
+  DASH_LOG_DEBUG("dash::internal::rpc_finalize", "issued:", issued);
+  if (issued) {
+    dash::rpc_fence();
+  }
+}
+
+bool rpc_register(
+  uint64_t     key,
+  rpc_invoke_t invoke)
+{
+  auto & registry = rpc_registry();
+  auto   entry    = registry.find(key);
+  if (entry != registry.end() && entry->second != invoke) {
+    DASH_THROW(
+      dash::exception::RuntimeError,
+      "dash::rpc: key collision of remote procedures");
+  }
+  registry[key] = invoke;
+  return true;
+}
+
+rpc_invoke_t rpc_lookup(
+  uint64_t     key)
+{
+  auto & registry = rpc_registry();
+  auto   entry    = registry.find(key);
+  if (entry == registry.end()) {
+    return nullptr;
+  }
+  return entry->second;
+}
+
+void rpc_send(
+  dart_unit_t  unit,
+  const char * msg,
+  size_t       nbytes)
+{
+  if (!_rpc_supported) {
+    DASH_THROW(
+      dash::exception::NotImplemented,
+      "dash::rpc: active messages are not supported by the DART "
+      "implementation");
+  }
+  _rpc_issued = 1;
+  DASH_ASSERT_RETURNS(
+    dart_am_send(unit, _rpc_call_handler, msg, nbytes),
+    DART_OK);
+}
+
+void rpc_send_reply(
+  dart_unit_t  unit,
+  uint64_t     reply_token,
+  const void * value,
+  size_t       nbytes)
+{
+  std::vector<char> msg(sizeof(uint64_t) + nbytes);
+  std::memcpy(msg.data(), &reply_token, sizeof(uint64_t));
+  if (nbytes > 0) {
+    std::memcpy(msg.data() + sizeof(uint64_t), value, nbytes);
+  }
+  _rpc_issued = 1;
+  DASH_ASSERT_RETURNS(
+    dart_am_send(unit, _rpc_reply_handler, msg.data(), msg.size()),
+    DART_OK);
+}
+
+uint64_t rpc_expect_reply(
+  const std::shared_ptr<rpc_reply_t> & reply)
+{
+  uint64_t token = ++_rpc_last_token;
+  _rpc_pending_replies[token] = reply;
+  return token;
+}
+
+void rpc_wait_reply(
+  dart_unit_t         unit,
+  const rpc_reply_t & reply)
+{
+  DASH_ASSERT_RETURNS(
+    dart_am_flush(unit),
+    DART_OK);
+  while (!reply.ready) {
+    DASH_ASSERT_RETURNS(
+      dart_am_progress(nullptr),
+      DART_OK);
+  }
+}
+
+} // namespace internal
+
+void rpc_flush()
+{
+  DASH_ASSERT_RETURNS(
+    dart_am_flush_all(),
+    DART_OK);
+}
+
+size_t rpc_progress()
+{
+  size_t num_processed = 0;
+  DASH_ASSERT_RETURNS(
+    dart_am_progress(&num_processed),
+    DART_OK);
+  return num_processed;
+}
+
+void rpc_fence()
+{
+  DASH_LOG_DEBUG("dash::rpc_fence()");
+  DASH_ASSERT_RETURNS(
+    dart_am_fence(),
+    DART_OK);
+  DASH_LOG_DEBUG("dash::rpc_fence >");
+}
+
+} // namespace dash
@@ -0,0 +1,503 @@
+#include <dash/Tasks.h>
+#include <dash/Queue.h>
+#include <dash/SharedCounter.h>
+#include <dash/Team.h>
+#include <dash/Init.h>
+#include <dash/Exception.h>
+#include <dash/internal/Logging.h>
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#ifdef DASH_ENABLE_OPENMP
+#include <omp.h>
+#endif
+
+namespace dash {
+namespace tasks {
+namespace internal {
+
+namespace {
+
+/// Number of task descriptors in the queue of every unit
+constexpr size_t QueueCapacity         = 4096;
+/// Number of tasks executed by the master thread between scheduling steps
+constexpr size_t CommunicationInterval = 16;
+/// Number of published task descriptors at a unit above which created
+/// stealable tasks are executed locally
+constexpr size_t PublishThreshold      = 64;
+
+typedef struct task_s {
+  /// Function executed by the task
+  task_func_t             func;
+  /// Declared accesses to global memory
+  std::vector<dependency> deps;
+  /// Number of unfinished tasks the task depends on
+  size_t                  npred = 0;
+  /// Tasks depending on the task
+  std::vector<task_s *>   successors;
+} task_t;
+
+/**
+ * Declared access of an unfinished task to a range in a segment.
+ */
+typedef struct {
+  dependency dep;
+  task_t   * task;
+} access_t;
+
+/**
+ * Deque of ready tasks of a thread.
+ */
+typedef struct {
+  std::mutex           mutex;
+  std::deque<task_t *> tasks;
+} worker_t;
+
+typedef struct {
+  std::atomic<size_t> executed;
+  std::atomic<size_t> published;
+  std::atomic<size_t> thread_steals;
+  std::atomic<size_t> remote_steal_attempts;
+  std::atomic<size_t> remote_steals;
+  std::atomic<size_t> remote_tasks_stolen;
+} counters_t;
+
+/**
+ * State of the task runtime at the calling unit.
+ */
+class runtime_t
+{
+public:
+  runtime_t()
+  {
+#ifdef DASH_ENABLE_OPENMP
+    int nthreads = omp_get_max_threads();
+#else
+    int nthreads = 1;
+#endif
+    for (int t = 0; t < nthreads; ++t) {
+      workers.emplace_back(new worker_t());
+    }
+    created   = 0;
+    completed = 0;
+    nactive   = 0;
+    done      = false;
+    reset_counters();
+  }
+
+  void reset_counters()
+  {
+    counters.executed              = 0;
+    counters.published             = 0;
+    counters.thread_steals         = 0;
+    counters.remote_steal_attempts = 0;
+    counters.remote_steals         = 0;
+    counters.remote_tasks_stolen   = 0;
+  }
+
+  void trace(trace_event event, int thread, int victim) const
+  {
+    if (hook) {
+      hook(event, thread, victim);
+    }
+  }
+
+public:
+  /// Deques of ready tasks by thread
+  std::vector< std::unique_ptr<worker_t> > workers;
+  /// Tasks created since the last scheduling step
+  std::atomic<long>                        created;
+  /// Tasks completed since the last scheduling step
+  std::atomic<long>                        completed;
+  /// Tasks at the unit that have not been completed
+  std::atomic<long>                        nactive;
+  /// Whether termination has been detected
+  std::atomic<bool>                        done;
+  /// Descriptors of stealable tasks that have not been published
+  std::vector<task_descriptor_t>           pending;
+  std::mutex                               pending_mutex;
+  /// Declared accesses of unfinished tasks by unit and segment
+  std::map< std::pair<dart_unit_t, int16_t>,
+            std::vector<access_t> >        accesses;
+  std::mutex                               accesses_mutex;
+  /// Queues of published task descriptors, allocated in the first
+  /// call of \c complete
+  std::unique_ptr< dash::Queue<task_descriptor_t> > queue;
+  /// Number of unfinished tasks in the team
+  std::unique_ptr< dash::SharedCounter<long> >      counter;
+  /// Unit to steal task descriptors from first
+  dart_unit_t                              next_victim = 0;
+  counters_t                               counters;
+  trace_hook_t                             hook;
+};
+
+runtime_t & runtime()
+{
+  static runtime_t rt;
+  return rt;
+}
+
+int current_thread(const runtime_t & rt)
+{
+#ifdef DASH_ENABLE_OPENMP
+  return omp_get_thread_num() % rt.workers.size();
+#else
+  return 0;
+#endif
+}
+
+bool conflicts(const dependency & a, const dependency & b)
+{
+  return (a.write || b.write) && a.begin < b.end && b.begin < a.end;
+}
+
+void enqueue(runtime_t & rt, int thread, task_t * task)
+{
+  auto & worker = *rt.workers[thread];
+  std::lock_guard<std::mutex> lock(worker.mutex);
+  worker.tasks.push_back(task);
+}
+
+/**
+ * Removes the accesses of a finished task and enqueues successors that
+ * have no unfinished predecessors.
+ */
+void release(runtime_t & rt, int thread, task_t * task)
+{
+  if (task->deps.empty()) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(rt.accesses_mutex);
+  for (auto & dep : task->deps) {
+    auto & accesses = rt.accesses[std::make_pair(dep.unit, dep.segid)];
+    accesses.erase(
+      std::remove_if(accesses.begin(), accesses.end(),
+                     [=](const access_t & access) {
+                       return access.task == task;
+                     }),
+      accesses.end());
+  }
+  for (auto succ : task->successors) {
+    if (--succ->npred == 0) {
+      enqueue(rt, thread, succ);
+    }
+  }
+}
+
+void execute(runtime_t & rt, int thread, task_t * task)
+{
+  rt.trace(trace_event::task_begin, thread, -1);
+  task->func();
+  rt.trace(trace_event::task_end, thread, -1);
+  release(rt, thread, task);
+  delete task;
+  ++rt.counters.executed;
+  // Tasks created by the task have been counted before its completion:
+  ++rt.completed;
+  --rt.nactive;
+}
+
+/**
+ * Executes the next task of the thread's deque, or a task stolen from
+ * the deque of another thread.
+ *
+ * \return  false if all deques are empty
+ */
+bool execute_next(runtime_t & rt, int thread)
+{
+  task_t * task     = nullptr;
+  int      nworkers = rt.workers.size();
+  for (int i = 0; task == nullptr && i < nworkers; ++i) {
+    int    victim = (thread + i) % nworkers;
+    auto & worker = *rt.workers[victim];
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    if (worker.tasks.empty()) {
+      continue;
+    }
+    if (i == 0) {
+      task = worker.tasks.back();
+      worker.tasks.pop_back();
+    } else {
+      task = worker.tasks.front();
+      worker.tasks.pop_front();
+      ++rt.counters.thread_steals;
+      rt.trace(trace_event::thread_steal, thread, victim);
+    }
+  }
+  if (task == nullptr) {
+    return false;
+  }
+  execute(rt, thread, task);
+  return true;
+}
+
+/**
+ * Enqueues a task executing a stealable task descriptor at the master
+ * thread, the task has been counted at its creation.
+ */
+void enqueue_descriptor(runtime_t & rt, const task_descriptor_t & desc)
+{
+  task_t * task = new task_t();
+  task->func = [desc]() {
+                 auto invoke = dash::internal::rpc_lookup(desc.key);
+                 if (invoke == nullptr) {
+                   DASH_LOG_ERROR("dash::tasks", "unknown task", desc.key,
+                                  "created at unit", desc.source);
+                   return;
+                 }
+                 invoke(desc.source, desc.args, 0);
+               };
+  ++rt.nactive;
+  enqueue(rt, 0, task);
+}
+
+/**
+ * Scheduling step of the master thread: publishes pending task
+ * descriptors and adds the tasks created and completed since the last
+ * step to the team's counter of unfinished tasks.
+ */
+void communicate(runtime_t & rt)
+{
+  std::vector<task_descriptor_t> publish;
+  {
+    std::lock_guard<std::mutex> lock(rt.pending_mutex);
+    publish.swap(rt.pending);
+  }
+  // Creations of all pending descriptors and of all tasks created by
+  // completed tasks are counted in this step:
+  long ncompleted = rt.completed.exchange(0);
+  long ncreated   = rt.created.exchange(0);
+  if (ncreated != ncompleted) {
+    rt.counter->inc(ncreated - ncompleted);
+  }
+  if (publish.empty()) {
+    return;
+  }
+  dart_unit_t myid = dash::myid();
+  for (auto & desc : publish) {
+    desc.source = myid;
+  }
+  // Only the oldest descriptors are published while enough published
+  // descriptors are available to other units:
+  size_t nqueued  = rt.queue->lsize();
+  size_t npublish = nqueued < PublishThreshold
+                    ? std::min(publish.size(), PublishThreshold - nqueued)
+                    : 0;
+  size_t npushed  = rt.queue->push(publish.data(),
+                                   publish.data() + npublish,
+                                   myid);
+  rt.counters.published += npushed;
+  // Remaining tasks are executed locally:
+  for (size_t i = npushed; i < publish.size(); ++i) {
+    enqueue_descriptor(rt, publish[i]);
+  }
+}
+
+/**
+ * Dequeues task descriptors published at the calling unit, or steals
+ * task descriptors from other units.
+ *
+ * \return  false if no descriptors have been found
+ */
+bool fetch_descriptors(runtime_t & rt)
+{
+  dart_unit_t myid   = dash::myid();
+  size_t      nunits = dash::size();
+  std::vector<task_descriptor_t> descs(rt.workers.size());
+  size_t n = rt.queue->pop_from(myid, descs.data(),
+                                descs.data() + descs.size());
+  for (size_t i = 1; n == 0 && i < nunits; ++i) {
+    dart_unit_t victim = rt.next_victim;
+    rt.next_victim = (rt.next_victim + 1) % nunits;
+    if (victim == myid) {
+      continue;
+    }
+    ++rt.counters.remote_steal_attempts;
+    n = rt.queue->pop_from(victim, descs.data(),
+                           descs.data() + descs.size());
+    if (n == 0) {
+      rt.trace(trace_event::remote_steal_failed, 0, victim);
+      continue;
+    }
+    ++rt.counters.remote_steals;
+    rt.counters.remote_tasks_stolen += n;
+    rt.trace(trace_event::remote_steal, 0, victim);
+  }
+  for (size_t i = 0; i < n; ++i) {
+    enqueue_descriptor(rt, descs[i]);
+  }
+  return n > 0;
+}
+
+void run_master(runtime_t & rt)
+{
+  size_t nexecuted = 0;
+  for (;;) {
+    if (execute_next(rt, 0)) {
+      if (++nexecuted % CommunicationInterval == 0) {
+        communicate(rt);
+      }
+      continue;
+    }
+    communicate(rt);
+    if (fetch_descriptors(rt)) {
+      continue;
+    }
+    if (rt.nactive == 0 && rt.counter->load() == 0) {
+      break;
+    }
+  }
+  rt.done = true;
+}
+
+void run_worker(runtime_t & rt, int thread)
+{
+  while (!rt.done) {
+    if (!execute_next(rt, thread)) {
+      std::this_thread::yield();
+    }
+  }
+}
+
+} // namespace
+
+void spawn(
+  task_func_t      && func,
+  const dependency  * deps,
+  size_t              ndeps)
+{
+  auto   & rt     = runtime();
+  int      thread = current_thread(rt);
+  task_t * task   = new task_t();
+  task->func = std::move(func);
+  ++rt.created;
+  ++rt.nactive;
+  if (ndeps > 0) {
+    task->deps.assign(deps, deps + ndeps);
+    std::lock_guard<std::mutex> lock(rt.accesses_mutex);
+    for (size_t d = 0; d < ndeps; ++d) {
+      auto & accesses = rt.accesses[
+                          std::make_pair(deps[d].unit, deps[d].segid)];
+      for (auto & access : accesses) {
+        auto & pred = *access.task;
+        if (conflicts(access.dep, deps[d]) &&
+            (pred.successors.empty() || pred.successors.back() != task)) {
+          pred.successors.push_back(task);
+          ++task->npred;
+        }
+      }
+    }
+    for (size_t d = 0; d < ndeps; ++d) {
+      rt.accesses[std::make_pair(deps[d].unit, deps[d].segid)].push_back(
+        access_t { deps[d], task });
+    }
+    if (task->npred > 0) {
+      return;
+    }
+  }
+  enqueue(rt, thread, task);
+}
+
+void spawn_stealable(
+  const task_descriptor_t & desc)
+{
+  auto & rt = runtime();
+  // Counted before it can be published:
+  ++rt.created;
+  std::lock_guard<std::mutex> lock(rt.pending_mutex);
+  rt.pending.push_back(desc);
+}
+
+dependency make_dependency(
+  bool        write,
+  dart_gptr_t first,
+  dart_gptr_t last)
+{
+  if (first.unitid != last.unitid || first.segid != last.segid ||
+      first.addr_or_offs.offset > last.addr_or_offs.offset) {
+    DASH_THROW(
+      dash::exception::InvalidArgument,
+      "dash::tasks: dependency range is not located at a single unit");
+  }
+  dependency dep;
+  dep.write = write;
+  dep.unit  = first.unitid;
+  dep.segid = first.segid;
+  dep.begin = first.addr_or_offs.offset;
+  dep.end   = last.addr_or_offs.offset;
+  return dep;
+}
+
+} // namespace internal
+
+void complete()
+{
+  DASH_LOG_DEBUG("dash::tasks::complete()");
+  auto & rt = internal::runtime();
+  if (!rt.queue) {
+    rt.queue.reset(
+      new dash::Queue<internal::task_descriptor_t>(
+            internal::QueueCapacity));
+    rt.counter.reset(new dash::SharedCounter<long>());
+  }
+  rt.done = false;
+  // Tasks created before are counted before any unit checks for
+  // termination:
+  internal::communicate(rt);
+  dash::Team::All().barrier();
+#ifdef DASH_ENABLE_OPENMP
+  #pragma omp parallel num_threads(rt.workers.size())
+  {
+    int thread = omp_get_thread_num();
+    if (thread == 0) {
+      internal::run_master(rt);
+    } else {
+      internal::run_worker(rt, thread);
+    }
+  }
+#else
+  internal::run_master(rt);
+#endif
+  dash::Team::All().barrier();
+  DASH_LOG_DEBUG("dash::tasks::complete >");
+}
+
+int num_threads()
+{
+  return internal::runtime().workers.size();
+}
+
+void set_trace_hook(
+  trace_hook_t hook)
+{
+  internal::runtime().hook = hook;
+}
+
+statistics_t statistics()
+{
+  auto & counters = internal::runtime().counters;
+  statistics_t stats;
+  stats.executed              = counters.executed;
+  stats.published             = counters.published;
+  stats.thread_steals         = counters.thread_steals;
+  stats.remote_steal_attempts = counters.remote_steal_attempts;
+  stats.remote_steals         = counters.remote_steals;
+  stats.remote_tasks_stolen   = counters.remote_tasks_stolen;
+  return stats;
+}
+
+void reset_statistics()
+{
+  internal::runtime().reset_counters();
+}
+
+} // namespace tasks
+} // namespace dash
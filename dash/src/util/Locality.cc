@@ -76,7 +76,11 @@ void Locality::init()
   for (obj = hwloc_get_obj_by_type(topology, HWLOC_OBJ_PU, 0);
        obj;
        obj = obj->parent) {
+#if HWLOC_API_VERSION >= 0x00020000
+    if (hwloc_obj_type_is_cache(obj->type)) {
+#else
     if (obj->type == HWLOC_OBJ_CACHE) {
+#endif
       _cache_sizes[level]      = obj->attr->cache.size;
       _cache_line_sizes[level] = obj->attr->cache.linesize;
       ++level;
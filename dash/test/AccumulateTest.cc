@@ -0,0 +1,123 @@
+#include <libdash.h>
+#include <gtest/gtest.h>
+#include "TestBase.h"
+#include "AccumulateTest.h"
+
+TEST_F(AccumulateTest, SimpleStart)
+{
+  const size_t num_elem_local = 100;
+  size_t num_elem_total       = dash::size() * num_elem_local;
+  dash::Array<int> target(num_elem_total, dash::BLOCKCYCLIC(7));
+
+  for (size_t l = 0; l < target.lsize(); ++l) {
+    target.local[l] = target.pattern().global(l) + 1;
+  }
+  target.barrier();
+
+  int expected = (num_elem_total * (num_elem_total + 1)) / 2;
+  int result   = dash::accumulate(target.begin(), target.end(), 0);
+  ASSERT_EQ_U(expected, result);
+
+  // Initial value is added once:
+  result = dash::reduce(target.begin(), target.end(), 100);
+  ASSERT_EQ_U(expected + 100, result);
+}
+
+TEST_F(AccumulateTest, MinMax)
+{
+  const size_t num_elem_local = 23;
+  size_t num_elem_total       = dash::size() * num_elem_local;
+  dash::Array<double> target(num_elem_total);
+
+  for (size_t l = 0; l < target.lsize(); ++l) {
+    double g = target.pattern().global(l);
+    target.local[l] = (g - num_elem_total / 2) * 0.5;
+  }
+  target.barrier();
+
+  double min = dash::accumulate(target.begin(), target.end(),
+                                std::numeric_limits<double>::max(),
+                                dash::min<double>());
+  double max = dash::accumulate(target.begin(), target.end(),
+                                std::numeric_limits<double>::lowest(),
+                                dash::max<double>());
+  ASSERT_EQ_U((0.0 - num_elem_total / 2) * 0.5, min);
+  ASSERT_EQ_U((num_elem_total - 1.0 - num_elem_total / 2) * 0.5, max);
+}
+
+TEST_F(AccumulateTest, MinMaxInfinity)
+{
+  // Range only contains elements of the first unit:
+  const size_t num_elem_local = 10;
+  size_t num_elem_total       = dash::size() * num_elem_local;
+  dash::Array<double> target(num_elem_total, dash::BLOCKED);
+  double inf = std::numeric_limits<double>::infinity();
+
+  for (size_t l = 0; l < target.lsize(); ++l) {
+    target.local[l] = inf;
+  }
+  target.barrier();
+
+  double min = dash::accumulate(target.begin(), target.begin() + 3, inf,
+                                dash::min<double>());
+  ASSERT_EQ_U(inf, min);
+
+  target.barrier();
+  for (size_t l = 0; l < target.lsize(); ++l) {
+    target.local[l] = -inf;
+  }
+  target.barrier();
+
+  double max = dash::accumulate(target.begin(), target.begin() + 3, -inf,
+                                dash::max<double>());
+  ASSERT_EQ_U(-inf, max);
+}
+
+TEST_F(AccumulateTest, Subrange)
+{
+  // Range only contains elements of the first unit:
+  const size_t num_elem_local = 10;
+  size_t num_elem_total       = dash::size() * num_elem_local;
+  dash::Array<long> target(num_elem_total, dash::BLOCKED);
+
+  for (size_t l = 0; l < target.lsize(); ++l) {
+    target.local[l] = 2;
+  }
+  target.barrier();
+
+  long result = dash::accumulate(target.begin() + 2,
+                                 target.begin() + num_elem_local - 1,
+                                 1L,
+                                 dash::multiplies<long>());
+  ASSERT_EQ_U(1L << (num_elem_local - 3), result);
+}
+
+TEST_F(AccumulateTest, TransformReduce)
+{
+  const size_t num_elem_local = 50;
+  size_t num_elem_total       = dash::size() * num_elem_local;
+  dash::Array<int> target(num_elem_total);
+
+  for (size_t l = 0; l < target.lsize(); ++l) {
+    target.local[l] = target.pattern().global(l);
+  }
+  target.barrier();
+
+  // Sum of squares with reduce operation supported by DART:
+  double expected = 0;
+  for (size_t g = 0; g < num_elem_total; ++g) {
+    expected += static_cast<double>(g) * g;
+  }
+  double result = dash::transform_reduce(
+                    target.begin(), target.end(), 0.0,
+                    dash::plus<double>(),
+                    [](int v) { return static_cast<double>(v) * v; });
+  ASSERT_EQ_U(expected, result);
+
+  // Custom reduce operation:
+  size_t num_odd = dash::transform_reduce(
+                     target.begin(), target.end(), size_t(0),
+                     [](size_t a, size_t b) { return a + b; },
+                     [](int v) { return static_cast<size_t>(v % 2); });
+  ASSERT_EQ_U(num_elem_total / 2, num_odd);
+}
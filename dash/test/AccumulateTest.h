@@ -0,0 +1,26 @@
+#ifndef DASH__TEST__ACCUMULATE_TEST_H_
+#define DASH__TEST__ACCUMULATE_TEST_H_
+
+#include <gtest/gtest.h>
+#include <libdash.h>
+
+/**
+ * Test fixture for dash::accumulate and related reductions
+ */
+class AccumulateTest : public ::testing::Test {
+protected:
+
+  AccumulateTest() {
+  }
+
+  virtual ~AccumulateTest() {
+  }
+
+  virtual void SetUp() {
+  }
+
+  virtual void TearDown() {
+  }
+};
+
+#endif // DASH__TEST__ACCUMULATE_TEST_H_
@@ -105,3 +105,39 @@ TEST_F(ArrayTest, TileSize)
   EXPECT_EQ_U(tilesize * (nunits - 1),
               block_glob_dist);
 }
+
+TEST_F(ArrayTest, IteratorLocalPosition)
+{
+  typedef dash::Array<int> array_t;
+
+  // Underfilled last block to cover the end of the local range:
+  size_t blocksize = 7;
+  size_t size      = (_dash_size * 3 - 1) * blocksize + 3;
+
+  array_t arr(size, dash::BLOCKCYCLIC(blocksize));
+  const auto & pattern = arr.pattern();
+
+  // Forward traversal with a single iterator:
+  auto it = arr.begin();
+  for (size_t g = 0; g < size; ++g, ++it) {
+    auto expected = pattern.local(g);
+    auto lpos     = it.lpos();
+    ASSERT_EQ_U(expected.unit,  lpos.unit);
+    ASSERT_EQ_U(expected.index, lpos.index);
+    ASSERT_EQ_U(expected.unit,  it.dart_gptr().unitid);
+  }
+  // Backward traversal:
+  for (size_t g = size; g > 0; --g) {
+    --it;
+    auto expected = pattern.local(g-1);
+    ASSERT_EQ_U(expected.unit,  it.lpos().unit);
+    ASSERT_EQ_U(expected.index, it.lpos().index);
+  }
+  // Iterators derived by arithmetic:
+  for (size_t g = 0; g < size; g += 5) {
+    auto expected = pattern.local(g);
+    auto git      = it + g;
+    ASSERT_EQ_U(expected.unit,  git.lpos().unit);
+    ASSERT_EQ_U(expected.index, git.lpos().index);
+  }
+}
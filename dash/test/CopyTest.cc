@@ -36,6 +36,46 @@ TEST_F(CopyTest, BlockingGlobalToLocalBlock)
   delete[] local_copy;
 }
 
+TEST_F(CopyTest, BlockingGlobalToLocalBlockcyclic)
+{
+  // Copy ranges spanning several blocks of every unit, including local
+  // blocks interleaved with remote blocks.
+  const int blocksize      = 3;
+  size_t    num_elem_total = _dash_size * 7 * blocksize + 2;
+
+  dash::Array<int> array(num_elem_total, dash::BLOCKCYCLIC(blocksize));
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    array.local[l] = ((dash::myid() + 1) * 1000) + l;
+  }
+  array.barrier();
+
+  std::vector<int> expected(num_elem_total);
+  for (size_t g = 0; g < num_elem_total; ++g) {
+    expected[g] = array[g];
+  }
+  // Ranges beginning and ending within blocks:
+  size_t offset_first = 1;
+  size_t offset_last  = num_elem_total - 1;
+  std::vector<int> local_copy(offset_last - offset_first);
+  int * dest_end = dash::copy(array.begin() + offset_first,
+                              array.begin() + offset_last,
+                              local_copy.data());
+  ASSERT_EQ_U(local_copy.data() + local_copy.size(), dest_end);
+  for (size_t i = 0; i < local_copy.size(); ++i) {
+    EXPECT_EQ_U(expected[offset_first + i], local_copy[i]);
+  }
+
+  std::fill(local_copy.begin(), local_copy.end(), -1);
+  auto fut = dash::copy_async(array.begin() + offset_first,
+                              array.begin() + offset_last,
+                              local_copy.data());
+  fut.wait();
+  for (size_t i = 0; i < local_copy.size(); ++i) {
+    EXPECT_EQ_U(expected[offset_first + i], local_copy[i]);
+  }
+  array.barrier();
+}
+
 TEST_F(CopyTest, Blocking2DimGlobalToLocalBlock)
 {
   // Copy all blocks from a single remote unit.
@@ -386,6 +426,41 @@ TEST_F(CopyTest, BlockingLocalToGlobalBlock)
   }
 }
 
+TEST_F(CopyTest, BlockingLocalToGlobalMultiUnit)
+{
+  // Copy local range to a global range spanning the blocks of all units,
+  // starting and ending in the middle of a block.
+  const size_t num_elem_per_unit = 20;
+  const size_t num_elem_total    = _dash_size * num_elem_per_unit;
+  const size_t offset            = num_elem_per_unit / 2;
+  const size_t num_elem_copy     = num_elem_total - 2 * offset;
+
+  dash::Array<int> array(num_elem_total, dash::BLOCKED);
+  for (size_t l = 0; l < num_elem_per_unit; ++l) {
+    array.local[l] = -1;
+  }
+  array.barrier();
+
+  if (dash::myid() == 0) {
+    std::vector<int> local_range(num_elem_copy);
+    for (size_t i = 0; i < num_elem_copy; ++i) {
+      local_range[i] = offset + i;
+    }
+    auto out_last = dash::copy(local_range.data(),
+                               local_range.data() + num_elem_copy,
+                               array.begin() + offset);
+    ASSERT_EQ_U(offset + num_elem_copy, out_last.pos());
+  }
+  array.barrier();
+
+  for (size_t g = 0; g < num_elem_total; ++g) {
+    int expected = (g < offset || g >= offset + num_elem_copy)
+                   ? -1
+                   : static_cast<int>(g);
+    ASSERT_EQ_U(expected, static_cast<int>(array[g]));
+  }
+}
+
 TEST_F(CopyTest, BlockingGlobalToLocalSubBlock)
 {
   // Copy all elements contained in a single, continuous block,
@@ -654,7 +729,7 @@ TEST_F(CopyTest, AsyncGlobalToLocalTiles)
     auto req = dash::copy_async(gblock_a.begin(),
                                 gblock_a.end(),
                                 matrix_b_dest);
-    req_handles.push_back(req);
+    req_handles.push_back(std::move(req));
     dst_pointers.push_back(matrix_b_dest);
   }
 
@@ -668,7 +743,7 @@ TEST_F(CopyTest, AsyncGlobalToLocalTiles)
   // To prevent compiler from removing work load loop in optimization:
   LOG_MESSAGE("Dummy result: %f", m);
 
-  for (auto req : req_handles) {
+  for (auto & req : req_handles) {
     // Wait for completion of async copy operation.
     // Returns pointer to final element copied into target range:
     value_t * copy_dest_end   = req.get();
@@ -757,3 +832,158 @@ TEST_F(CopyTest, AsyncAllToLocalVector)
   }
 }
 #endif
+
+TEST_F(CopyTest, BlockingGlobalToGlobal)
+{
+  // Copy between arrays with different distribution patterns:
+  const size_t num_elem_per_unit = 31;
+  const size_t num_elem_total    = _dash_size * num_elem_per_unit;
+  const size_t in_offset         = 5;
+  const size_t out_offset        = 2;
+  const size_t num_elem_copy     = num_elem_total - in_offset - 3;
+
+  dash::Array<int> array_in(num_elem_total, dash::BLOCKED);
+  dash::Array<int> array_out(num_elem_total, dash::BLOCKCYCLIC(4));
+
+  for (size_t l = 0; l < array_in.lsize(); ++l) {
+    array_in.local[l]  = array_in.pattern().global(l);
+  }
+  for (size_t l = 0; l < array_out.lsize(); ++l) {
+    array_out.local[l] = -1;
+  }
+  array_in.barrier();
+
+  auto out_last = dash::copy(array_in.begin() + in_offset,
+                             array_in.begin() + in_offset + num_elem_copy,
+                             array_out.begin() + out_offset);
+  ASSERT_EQ_U(out_offset + num_elem_copy, out_last.pos());
+
+  for (size_t g = 0; g < num_elem_total; ++g) {
+    int expected = (g < out_offset || g >= out_offset + num_elem_copy)
+                   ? -1
+                   : static_cast<int>(g - out_offset + in_offset);
+    ASSERT_EQ_U(expected, static_cast<int>(array_out[g]));
+  }
+  array_out.barrier();
+}
+
+TEST_F(CopyTest, AsyncGlobalToGlobal)
+{
+  const size_t num_elem_per_unit = 23;
+  const size_t num_elem_total    = _dash_size * num_elem_per_unit;
+
+  dash::Array<int> array_in(num_elem_total, dash::BLOCKCYCLIC(3));
+  dash::Array<int> array_out(num_elem_total, dash::BLOCKED);
+
+  for (size_t l = 0; l < array_in.lsize(); ++l) {
+    array_in.local[l] = array_in.pattern().global(l) * 10;
+  }
+  array_in.barrier();
+
+  auto fut_out_last = dash::copy_async(array_in.begin(),
+                                       array_in.end(),
+                                       array_out.begin());
+  auto out_last     = fut_out_last.get();
+  ASSERT_EQ_U(num_elem_total, out_last.pos());
+
+  for (size_t l = 0; l < array_out.lsize(); ++l) {
+    ASSERT_EQ_U(array_out.pattern().global(l) * 10,
+                static_cast<int>(array_out.local[l]));
+  }
+  array_out.barrier();
+}
+
+TEST_F(CopyTest, AsyncLocalToGlobalScatter)
+{
+  // Every unit writes a local range to a global range spanning blocks of
+  // all units.
+  const size_t num_elem_per_unit = 24;
+  const size_t num_elem_total    = _dash_size * num_elem_per_unit;
+  const size_t num_elem_copy     = num_elem_total / _dash_size;
+
+  dash::Array<int> array(num_elem_total, dash::BLOCKCYCLIC(5));
+
+  std::vector<int> local_range(num_elem_copy);
+  size_t out_offset = dash::myid() * num_elem_copy;
+  for (size_t i = 0; i < num_elem_copy; ++i) {
+    local_range[i] = out_offset + i;
+  }
+  auto fut_out_last = dash::copy_async(local_range.data(),
+                                       local_range.data() + num_elem_copy,
+                                       array.begin() + out_offset);
+  auto out_last     = fut_out_last.get();
+  ASSERT_EQ_U(out_offset + num_elem_copy, out_last.pos());
+  array.barrier();
+
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    ASSERT_EQ_U(array.pattern().global(l),
+                static_cast<int>(array.local[l]));
+  }
+  array.barrier();
+}
+
+TEST_F(CopyTest, CopyPlanGlobalToLocal)
+{
+  const size_t num_elem_per_unit = 17;
+  const size_t num_elem_total    = _dash_size * num_elem_per_unit;
+  const size_t offset            = 3;
+  const size_t num_elem_copy     = num_elem_total - offset - 2;
+
+  dash::Array<int> array(num_elem_total, dash::BLOCKCYCLIC(4));
+  std::vector<int> local_copy(num_elem_copy);
+
+  dash::CopyPlan<int> plan(array.begin() + offset,
+                           array.begin() + offset + num_elem_copy,
+                           local_copy.data());
+  // Range is split into runs at block boundaries:
+  ASSERT_GT_U(plan.num_remote_transfers() + plan.num_local_copies(), 1);
+
+  // Execute the plan repeatedly with changing values:
+  for (int iter = 0; iter < 3; ++iter) {
+    for (size_t l = 0; l < array.lsize(); ++l) {
+      array.local[l] = array.pattern().global(l) + iter * 1000;
+    }
+    array.barrier();
+
+    if (iter % 2 == 0) {
+      plan.execute();
+    } else {
+      plan.execute_async();
+      plan.wait();
+    }
+    for (size_t i = 0; i < num_elem_copy; ++i) {
+      ASSERT_EQ_U(static_cast<int>(offset + i + iter * 1000),
+                  local_copy[i]);
+    }
+    array.barrier();
+  }
+}
+
+TEST_F(CopyTest, CopyPlanLocalToGlobal)
+{
+  const size_t num_elem_per_unit = 12;
+  const size_t num_elem_total    = _dash_size * num_elem_per_unit;
+
+  dash::Array<int> array(num_elem_total, dash::BLOCKCYCLIC(5));
+  std::vector<int> local_range(num_elem_per_unit);
+
+  // Every unit writes to a range of elements at several units:
+  size_t out_offset = dash::myid() * num_elem_per_unit;
+  dash::CopyPlan<int> plan(local_range.data(),
+                           local_range.data() + num_elem_per_unit,
+                           array.begin() + out_offset);
+
+  for (int iter = 0; iter < 2; ++iter) {
+    for (size_t i = 0; i < num_elem_per_unit; ++i) {
+      local_range[i] = out_offset + i + iter * 1000;
+    }
+    plan.execute();
+    array.barrier();
+
+    for (size_t l = 0; l < array.lsize(); ++l) {
+      ASSERT_EQ_U(static_cast<int>(array.pattern().global(l) + iter * 1000),
+                  static_cast<int>(array.local[l]));
+    }
+    array.barrier();
+  }
+}
@@ -0,0 +1,189 @@
+#include <libdash.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "TestBase.h"
+#include "ExecutionPolicyTest.h"
+
+TEST_F(ExecutionPolicyTest, FillGenerateForEach)
+{
+  typedef long value_t;
+  // Local ranges large enough to be processed by multiple threads:
+  size_t num_elem = 10000 * dash::size() + 13;
+  dash::Array<value_t> array(num_elem, dash::BLOCKED);
+
+  dash::fill(dash::par_unseq_local, array.begin(), array.end(), 3L);
+  for (auto li = 0; li < array.lsize(); ++li) {
+    EXPECT_EQ_U(3, array.local[li]);
+  }
+  array.barrier();
+
+  dash::generate(dash::par_unseq_local, array.begin(), array.end(),
+                 []() { return 5L; });
+  for (auto li = 0; li < array.lsize(); ++li) {
+    EXPECT_EQ_U(5, array.local[li]);
+  }
+  array.barrier();
+
+  value_t * lbegin = array.lbegin();
+  auto    & pattern = array.pattern();
+  dash::for_each(dash::par_unseq_local,
+                 array.begin() + 7, array.end() - 5,
+                 [&](long gindex) {
+                   lbegin[pattern.local(gindex).index] = gindex;
+                 });
+  for (auto li = 0; li < array.lsize(); ++li) {
+    value_t gi = pattern.global(li);
+    if (gi < 7 || gi >= static_cast<value_t>(num_elem) - 5) {
+      EXPECT_EQ_U(5, array.local[li]);
+    } else {
+      EXPECT_EQ_U(gi, array.local[li]);
+    }
+  }
+  array.barrier();
+}
+
+TEST_F(ExecutionPolicyTest, TransformLocal)
+{
+  typedef int value_t;
+  size_t num_elem = 9000 * dash::size();
+  dash::Array<value_t> array_a(num_elem, dash::BLOCKCYCLIC(1000));
+  dash::Array<value_t> array_b(num_elem, dash::BLOCKCYCLIC(1000));
+  for (auto li = 0; li < array_a.lsize(); ++li) {
+    array_a.local[li] = array_a.pattern().global(li);
+    array_b.local[li] = 2;
+  }
+  array_a.barrier();
+
+  auto out_last = dash::transform(dash::par_unseq_local,
+                                  array_a.begin(), array_a.end(),
+                                  array_b.begin(), array_b.begin(),
+                                  dash::plus<value_t>());
+  EXPECT_EQ_U(array_b.end(), out_last);
+  for (auto li = 0; li < array_b.lsize(); ++li) {
+    EXPECT_EQ_U(array_a.pattern().global(li) + 2, array_b.local[li]);
+  }
+  array_b.barrier();
+}
+
+TEST_F(ExecutionPolicyTest, MinElementAccumulate)
+{
+  typedef int value_t;
+  size_t num_elem = 20000 * dash::size();
+  dash::Array<value_t> array(num_elem, dash::BLOCKED);
+  for (auto li = 0; li < array.lsize(); ++li) {
+    array.local[li] = (array.pattern().global(li) % 1000) + 10;
+  }
+  array.barrier();
+  size_t min_gidx = num_elem / 2 + 17;
+  if (dash::myid() == 0) {
+    // Two occurrences of the minimum in the same local range:
+    array[min_gidx]       = 1;
+    array[min_gidx + 500] = 1;
+  }
+  array.barrier();
+
+  auto min = dash::min_element(dash::par_unseq_local,
+                               array.begin(), array.end());
+  EXPECT_EQ_U(1, static_cast<value_t>(*min));
+  EXPECT_EQ_U(min, array.begin() + min_gidx);
+
+  auto max = dash::max_element(dash::par_unseq_local,
+                               array.begin(), array.end());
+  EXPECT_EQ_U(1009, static_cast<value_t>(*max));
+  EXPECT_EQ_U(max, array.begin() + 999);
+
+  long expected = 0;
+  for (size_t i = 0; i < num_elem; ++i) {
+    expected += (i % 1000) + 10;
+  }
+  expected -= ((min_gidx % 1000) + 10) - 1;
+  expected -= (((min_gidx + 500) % 1000) + 10) - 1;
+  EXPECT_EQ_U(expected,
+              dash::accumulate(dash::par_unseq_local,
+                               array.begin(), array.end(), 0L));
+  EXPECT_EQ_U(dash::accumulate(array.begin(), array.end(), 0L),
+              dash::accumulate(dash::par_unseq_local,
+                               array.begin(), array.end(), 0L));
+  array.barrier();
+}
+
+TEST_F(ExecutionPolicyTest, MinMaxFindCount)
+{
+  typedef int value_t;
+  size_t num_elem = 20000 * dash::size();
+  dash::Array<value_t> array(num_elem, dash::BLOCKED);
+  for (auto li = 0; li < array.lsize(); ++li) {
+    array.local[li] = (array.pattern().global(li) % 1000) + 10;
+  }
+  array.barrier();
+  size_t min_gidx = num_elem / 2 + 17;
+  if (dash::myid() == 0) {
+    array[min_gidx]       = 1;
+    array[min_gidx + 500] = 1;
+  }
+  array.barrier();
+
+  auto minmax = dash::minmax_element(dash::par_unseq_local,
+                                     array.begin(), array.end());
+  EXPECT_EQ_U(minmax.first, array.begin() + min_gidx);
+  // Last occurrence of the maximum:
+  EXPECT_EQ_U(minmax.second, array.begin() + (num_elem - 1));
+
+  auto found = dash::find(dash::par_unseq_local,
+                          array.begin(), array.end(), 1);
+  EXPECT_EQ_U(found, array.begin() + min_gidx);
+  EXPECT_EQ_U(2, dash::count(dash::par_unseq_local,
+                             array.begin(), array.end(), 1));
+  EXPECT_EQ_U(num_elem / 1000,
+              dash::count_if(dash::par_unseq_local,
+                             array.begin(), array.end(),
+                             [](value_t v) { return v == 1009; }));
+  EXPECT_TRUE_U(dash::any_of(dash::par_unseq_local,
+                             array.begin(), array.end(),
+                             [](value_t v) { return v < 5; }));
+  EXPECT_TRUE_U(dash::none_of(dash::par_unseq_local,
+                              array.begin(), array.end(),
+                              [](value_t v) { return v > 1009; }));
+  EXPECT_FALSE_U(dash::all_of(dash::par_unseq_local,
+                              array.begin(), array.end(),
+                              [](value_t v) { return v >= 10; }));
+  array.barrier();
+}
+
+TEST_F(ExecutionPolicyTest, SortScan)
+{
+  typedef long value_t;
+  size_t num_elem = 10000 * dash::size() + 7;
+  dash::Array<value_t> array(num_elem, dash::BLOCKED);
+  for (auto li = 0; li < array.lsize(); ++li) {
+    value_t gi = array.pattern().global(li);
+    array.local[li] = (gi * 7919) % 10007;
+  }
+  array.barrier();
+
+  dash::sort(dash::par_unseq_local, array.begin(), array.end());
+  std::vector<value_t> sorted(num_elem);
+  dash::copy(array.begin(), array.end(), sorted.data());
+  for (size_t i = 1; i < num_elem; ++i) {
+    EXPECT_LE_U(sorted[i - 1], sorted[i]);
+  }
+  array.barrier();
+
+  dash::fill(array.begin(), array.end(), 1L);
+  dash::inclusive_scan(dash::par_unseq_local,
+                       array.begin(), array.end(), array.begin());
+  for (auto li = 0; li < array.lsize(); ++li) {
+    EXPECT_EQ_U(array.pattern().global(li) + 1, array.local[li]);
+  }
+  array.barrier();
+
+  dash::fill(array.begin(), array.end(), 1L);
+  dash::exclusive_scan(dash::par_unseq_local,
+                       array.begin(), array.end(), array.begin(), 5L);
+  for (auto li = 0; li < array.lsize(); ++li) {
+    EXPECT_EQ_U(array.pattern().global(li) + 5, array.local[li]);
+  }
+  array.barrier();
+}
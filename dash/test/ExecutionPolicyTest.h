@@ -0,0 +1,26 @@
+#ifndef DASH__TEST__EXECUTION_POLICY_TEST_H_
+#define DASH__TEST__EXECUTION_POLICY_TEST_H_
+
+#include <gtest/gtest.h>
+#include <libdash.h>
+
+/**
+ * Test fixture for algorithm variants with execution policy dash::par_unseq_local
+ */
+class ExecutionPolicyTest : public ::testing::Test {
+protected:
+
+  ExecutionPolicyTest() {
+  }
+
+  virtual ~ExecutionPolicyTest() {
+  }
+
+  virtual void SetUp() {
+  }
+
+  virtual void TearDown() {
+  }
+};
+
+#endif // DASH__TEST__EXECUTION_POLICY_TEST_H_
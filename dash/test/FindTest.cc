@@ -0,0 +1,108 @@
+#include <libdash.h>
+#include <gtest/gtest.h>
+
+#include "TestBase.h"
+#include "FindTest.h"
+
+TEST_F(FindTest, FindBlocked)
+{
+  typedef int value_t;
+  size_t num_elem = 53 * dash::size();
+  dash::Array<value_t> array(num_elem, dash::BLOCKED);
+  for (auto li = 0; li < array.lsize(); ++li) {
+    array.local[li] = array.pattern().global(li);
+  }
+  array.barrier();
+
+  value_t value = num_elem - 7;
+  auto found = dash::find(array.begin(), array.end(), value);
+  EXPECT_EQ_U(num_elem - 7, found.pos());
+  EXPECT_EQ_U(value, static_cast<value_t>(*found));
+
+  auto not_found = dash::find(array.begin(), array.end(), -1);
+  EXPECT_EQ_U(array.end(), not_found);
+
+  // Empty range:
+  auto empty = dash::find(array.begin() + 3, array.begin() + 3, 3);
+  EXPECT_EQ_U(array.begin() + 3, empty);
+  array.barrier();
+}
+
+TEST_F(FindTest, FindIfBlockcyclicSubrange)
+{
+  typedef long value_t;
+  size_t num_elem = 41 * dash::size();
+  dash::Array<value_t> array(num_elem, dash::BLOCKCYCLIC(4));
+  for (auto li = 0; li < array.lsize(); ++li) {
+    // Multiple matches at every unit:
+    array.local[li] = array.pattern().global(li) % 10;
+  }
+  array.barrier();
+
+  // First element with value 9 after offset 11 is at index 19:
+  auto found = dash::find_if(array.begin() + 11, array.end(),
+                             [](const value_t & v) { return v == 9; });
+  EXPECT_EQ_U(19, found.pos());
+
+  // No match in subrange:
+  auto not_found = dash::find_if(array.begin() + 20, array.begin() + 29,
+                                 [](const value_t & v) { return v > 8; });
+  EXPECT_EQ_U(array.begin() + 29, not_found);
+  array.barrier();
+}
+
+TEST_F(FindTest, EarlyExitLargeRange)
+{
+  typedef int value_t;
+  // Range large enough to enable early termination of local scans:
+  size_t num_elem = 20000 * dash::size();
+  dash::Array<value_t> array(num_elem, dash::BLOCKED);
+  for (auto li = 0; li < array.lsize(); ++li) {
+    array.local[li] = 0;
+  }
+  array.barrier();
+  if (dash::myid() == 0) {
+    array[num_elem / 3]     = 1;
+    array[num_elem / 2]     = 1;
+    array[num_elem - 1]     = 1;
+  }
+  array.barrier();
+
+  auto found = dash::find(array.begin(), array.end(), 1);
+  EXPECT_EQ_U(num_elem / 3, found.pos());
+
+  EXPECT_TRUE_U(dash::any_of(array.begin(), array.end(),
+                             [](const value_t & v) { return v == 1; }));
+  EXPECT_FALSE_U(dash::any_of(array.begin(), array.end(),
+                              [](const value_t & v) { return v > 1; }));
+  EXPECT_FALSE_U(dash::all_of(array.begin(), array.end(),
+                              [](const value_t & v) { return v == 0; }));
+  EXPECT_TRUE_U(dash::all_of(array.begin(), array.end(),
+                             [](const value_t & v) { return v >= 0; }));
+  EXPECT_TRUE_U(dash::none_of(array.begin(), array.end(),
+                              [](const value_t & v) { return v < 0; }));
+  array.barrier();
+}
+
+TEST_F(FindTest, CountIf)
+{
+  typedef int value_t;
+  size_t num_elem = 67 * dash::size();
+  dash::Array<value_t> array(num_elem, dash::BLOCKCYCLIC(5));
+  for (auto li = 0; li < array.lsize(); ++li) {
+    array.local[li] = array.pattern().global(li) % 3;
+  }
+  array.barrier();
+
+  size_t expected = 0;
+  for (size_t i = 0; i < num_elem; ++i) {
+    if (i % 3 == 0) {
+      ++expected;
+    }
+  }
+  EXPECT_EQ_U(expected, dash::count(array.begin(), array.end(), 0));
+  EXPECT_EQ_U(num_elem - expected,
+              dash::count_if(array.begin(), array.end(),
+                             [](const value_t & v) { return v != 0; }));
+  array.barrier();
+}
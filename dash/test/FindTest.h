@@ -0,0 +1,26 @@
+#ifndef DASH__TEST__FIND_TEST_H_
+#define DASH__TEST__FIND_TEST_H_
+
+#include <gtest/gtest.h>
+#include <libdash.h>
+
+/**
+ * Test fixture for search algorithms dash::find, dash::count and dash::any_of
+ */
+class FindTest : public ::testing::Test {
+protected:
+
+  FindTest() {
+  }
+
+  virtual ~FindTest() {
+  }
+
+  virtual void SetUp() {
+  }
+
+  virtual void TearDown() {
+  }
+};
+
+#endif // DASH__TEST__FIND_TEST_H_
@@ -32,3 +32,48 @@ TEST_F(ForEachTest, TestArrayAllInvoked)
     num_invoked_indices_all);
   EXPECT_EQ(_num_elem, num_invoked_indices_all);
 }
+
+TEST_F(ForEachTest, ForEachWithIndexBlockcyclic)
+{
+  typedef long value_t;
+  dash::Array<value_t> array(_num_elem * dash::size(),
+                             dash::BLOCKCYCLIC(7));
+  for (auto li = 0; li < array.lsize(); ++li) {
+    array.local[li] = 3 * array.pattern().global(li);
+  }
+  array.barrier();
+
+  // Subrange with boundaries within blocks:
+  index_t offset_first = 3;
+  index_t offset_last  = array.size() - 9;
+  size_t  num_invoked  = 0;
+  dash::for_each_with_index(
+    array.begin() + offset_first,
+    array.begin() + offset_last,
+    [&](const value_t & value, index_t gindex) {
+      EXPECT_EQ_U(3 * gindex, value);
+      EXPECT_GE_U(gindex, offset_first);
+      EXPECT_LT_U(gindex, offset_last);
+      ++num_invoked;
+    });
+  // Global indices passed to lambda match elements in local memory:
+  std::vector<index_t> gindices;
+  dash::for_each(
+    array.begin() + offset_first,
+    array.begin() + offset_last,
+    [&](index_t gindex) {
+      gindices.push_back(gindex);
+    });
+  EXPECT_EQ_U(num_invoked, gindices.size());
+  for (auto gindex : gindices) {
+    auto lpos = array.pattern().local(gindex);
+    EXPECT_EQ_U(dash::myid(), lpos.unit);
+  }
+
+  dash::SharedCounter<size_t> count_invokes;
+  dash::Team::All().barrier();
+  count_invokes.inc(num_invoked);
+  array.barrier();
+  EXPECT_EQ_U(offset_last - offset_first, count_invokes.get());
+  array.barrier();
+}
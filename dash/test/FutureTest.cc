@@ -0,0 +1,141 @@
+#include <libdash.h>
+#include <gtest/gtest.h>
+
+#include "TestBase.h"
+#include "FutureTest.h"
+
+#include <vector>
+
+TEST_F(FutureTest, CopyAsyncTestThen)
+{
+  typedef int value_t;
+  const size_t num_local_elem = 1000;
+  size_t num_elem = num_local_elem * dash::size();
+  dash::Array<value_t> array(num_elem, dash::BLOCKED);
+  for (size_t li = 0; li < num_local_elem; ++li) {
+    array.local[li] = dash::myid() * num_local_elem + li;
+  }
+  array.barrier();
+
+  // Copy block of right neighbor:
+  size_t  neighbor = (dash::myid() + 1) % dash::size();
+  auto    g_first  = array.begin() + neighbor * num_local_elem;
+  std::vector<value_t> buf(num_local_elem);
+  auto fut = dash::copy_async(g_first, g_first + num_local_elem,
+                              buf.data());
+  EXPECT_TRUE_U(fut.valid());
+  while (!fut.test()) { }
+  EXPECT_EQ_U(buf.data() + num_local_elem, fut.get());
+  for (size_t i = 0; i < num_local_elem; ++i) {
+    EXPECT_EQ_U(neighbor * num_local_elem + i, buf[i]);
+  }
+
+  // Continuation of a pending copy:
+  std::vector<value_t> buf_cont(num_local_elem);
+  value_t * buf_cont_begin = buf_cont.data();
+  auto fut_ncopied = dash::copy_async(g_first, g_first + num_local_elem,
+                                      buf_cont_begin)
+                       .then([=](value_t * out_last) {
+                               return out_last - buf_cont_begin;
+                             });
+  EXPECT_EQ_U(num_local_elem, fut_ncopied.get());
+  EXPECT_EQ_U(buf, buf_cont);
+
+  // Moved-from futures are invalid:
+  auto fut_moved = std::move(fut);
+  EXPECT_FALSE_U(fut.valid());
+  EXPECT_TRUE_U(fut_moved.valid());
+  EXPECT_TRUE_U(fut_moved.test());
+
+  auto fut_ready = dash::make_ready_future(42);
+  EXPECT_TRUE_U(fut_ready.test());
+  EXPECT_EQ_U(43, fut_ready.then([](int v) { return v + 1; }).get());
+  array.barrier();
+}
+
+TEST_F(FutureTest, WhenAllWhenAny)
+{
+  typedef double value_t;
+  // More copies than handles stored inline in a single future:
+  const size_t num_chunks     = 2 * dash::Future<int>::NumInlineHandles + 1;
+  const size_t chunk_size     = 100;
+  const size_t num_local_elem = num_chunks * chunk_size;
+  size_t num_elem = num_local_elem * dash::size();
+  dash::Array<value_t> array(num_elem, dash::BLOCKED);
+  for (size_t li = 0; li < num_local_elem; ++li) {
+    array.local[li] = dash::myid() * num_local_elem + li;
+  }
+  array.barrier();
+
+  size_t neighbor = (dash::myid() + 1) % dash::size();
+  auto   g_first  = array.begin() + neighbor * num_local_elem;
+  std::vector<value_t> buf(num_local_elem);
+  std::vector< dash::Future<value_t *> > futs;
+  for (size_t c = 0; c < num_chunks; ++c) {
+    futs.push_back(
+      dash::copy_async(g_first + c * chunk_size,
+                       g_first + (c + 1) * chunk_size,
+                       buf.data() + c * chunk_size));
+  }
+  // Any future is completed first:
+  auto fut_any = dash::when_any(futs.begin(), futs.end());
+  ASSERT_NE_U(futs.end(), fut_any);
+  EXPECT_TRUE_U(fut_any->test());
+
+  auto fut_all = dash::when_all(futs.begin(), futs.end());
+  for (auto & fut : futs) {
+    EXPECT_FALSE_U(fut.valid());
+  }
+  auto & out_lasts = fut_all.get();
+  ASSERT_EQ_U(num_chunks, out_lasts.size());
+  for (size_t c = 0; c < num_chunks; ++c) {
+    EXPECT_EQ_U(buf.data() + (c + 1) * chunk_size, out_lasts[c]);
+  }
+  for (size_t i = 0; i < num_local_elem; ++i) {
+    EXPECT_EQ_U(neighbor * num_local_elem + i, buf[i]);
+  }
+
+  // No valid futures in range:
+  EXPECT_EQ_U(futs.end(), dash::when_any(futs.begin(), futs.end()));
+  array.barrier();
+}
+
+TEST_F(FutureTest, DiscardedFutures)
+{
+  typedef int value_t;
+  const size_t num_local_elem = 100;
+  size_t num_elem = num_local_elem * dash::size();
+  dash::Array<value_t> array_in(num_elem, dash::BLOCKED);
+  dash::Array<value_t> array_out(num_elem, dash::BLOCKED);
+  for (size_t li = 0; li < num_local_elem; ++li) {
+    array_in.local[li]  = dash::myid() * num_local_elem + li;
+    array_out.local[li] = -1;
+  }
+  array_in.barrier();
+
+  // Deferred function of a discarded future is evaluated:
+  int nevaluated = 0;
+  {
+    dash::Future<int> fut([&nevaluated]() { return ++nevaluated; });
+  }
+  EXPECT_EQ_U(1, nevaluated);
+  {
+    dash::Future<int> fut([&nevaluated]() { return ++nevaluated; });
+    fut.wait();
+  }
+  EXPECT_EQ_U(2, nevaluated);
+
+  // Collective completion of global-to-global copy at units that only
+  // wait for the future at even unit ids:
+  {
+    auto fut = dash::copy_async(array_in.begin(), array_in.end(),
+                                array_out.begin());
+    if (dash::myid() % 2 == 0) {
+      fut.wait();
+    }
+  }
+  for (size_t li = 0; li < num_local_elem; ++li) {
+    EXPECT_EQ_U(dash::myid() * num_local_elem + li, array_out.local[li]);
+  }
+  array_out.barrier();
+}
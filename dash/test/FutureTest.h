@@ -0,0 +1,26 @@
+#ifndef DASH__TEST__FUTURE_TEST_H_
+#define DASH__TEST__FUTURE_TEST_H_
+
+#include <gtest/gtest.h>
+#include <libdash.h>
+
+/**
+ * Test fixture for class dash::Future
+ */
+class FutureTest : public ::testing::Test {
+protected:
+
+  FutureTest() {
+  }
+
+  virtual ~FutureTest() {
+  }
+
+  virtual void SetUp() {
+  }
+
+  virtual void TearDown() {
+  }
+};
+
+#endif // DASH__TEST__FUTURE_TEST_H_
@@ -0,0 +1,116 @@
+#include <libdash.h>
+#include <gtest/gtest.h>
+
+#include "TestBase.h"
+#include "GatherTest.h"
+
+#include <vector>
+
+TEST_F(GatherTest, GatherBlockcyclic)
+{
+  typedef long value_t;
+  size_t num_elem = 37 * dash::size();
+  dash::Array<value_t> array(num_elem, dash::BLOCKCYCLIC(5));
+  for (auto li = 0; li < array.lsize(); ++li) {
+    array.local[li] = array.pattern().global(li) * 3;
+  }
+  array.barrier();
+
+  // Scattered, unordered offsets including duplicates and contiguous runs:
+  std::vector<long> indices;
+  for (size_t i = 0; i < num_elem; i += 3) {
+    indices.push_back((i * 7 + dash::myid()) % num_elem);
+  }
+  indices.push_back(0);
+  indices.push_back(0);
+  indices.push_back(num_elem - 1);
+  for (size_t i = 10; i < 20; ++i) {
+    indices.push_back(i);
+  }
+  std::vector<value_t> values(indices.size(), -1);
+  auto fut = dash::gather(array.begin(), indices.begin(), indices.end(),
+                          values.data());
+  EXPECT_EQ_U(values.data() + values.size(), fut.get());
+  for (size_t i = 0; i < indices.size(); ++i) {
+    EXPECT_EQ_U(indices[i] * 3, values[i]);
+  }
+
+  // Offsets relative to an iterator in the range:
+  std::vector<int> rel_indices { 4, 1, 2 };
+  std::vector<value_t> rel_values(rel_indices.size());
+  dash::gather(array.begin() + 6, rel_indices.begin(), rel_indices.end(),
+               rel_values.data()).wait();
+  EXPECT_EQ_U(30, rel_values[0]);
+  EXPECT_EQ_U(21, rel_values[1]);
+  EXPECT_EQ_U(24, rel_values[2]);
+  array.barrier();
+}
+
+TEST_F(GatherTest, Scatter)
+{
+  typedef int value_t;
+  size_t elem_per_unit = 23;
+  size_t num_elem      = elem_per_unit * dash::size();
+  dash::Array<value_t> array(num_elem, dash::BLOCKCYCLIC(3));
+  dash::fill(array.begin(), array.end(), -1);
+  array.barrier();
+
+  // Every unit writes every dash::size()-th element, offset by its id:
+  std::vector<long>    indices;
+  std::vector<value_t> values;
+  for (size_t i = dash::myid(); i < num_elem; i += dash::size()) {
+    indices.push_back(i);
+    values.push_back(i + 1000);
+  }
+  // Repeated write to the same element, last value is stored:
+  indices.push_back(indices.front());
+  values.push_back(indices.front() + 2000);
+  auto fut = dash::scatter(values.data(), indices.begin(), indices.end(),
+                           array.begin());
+  EXPECT_EQ_U(values.data() + values.size(), fut.get());
+  array.barrier();
+
+  for (auto li = 0; li < array.lsize(); ++li) {
+    auto gi = array.pattern().global(li);
+    if (gi < static_cast<long>(dash::size())) {
+      EXPECT_EQ_U(gi + 2000, array.local[li]);
+    } else {
+      EXPECT_EQ_U(gi + 1000, array.local[li]);
+    }
+  }
+  array.barrier();
+}
+
+TEST_F(GatherTest, ScatterAccumulate)
+{
+  typedef long value_t;
+  size_t num_bins = 5 * dash::size() + 3;
+  dash::Array<value_t> histogram(num_bins);
+  dash::fill(histogram.begin(), histogram.end(), value_t(0));
+  histogram.barrier();
+
+  // Every unit adds 1 to every bin and (myid + 1) to bin 0, partially by
+  // repeated offsets:
+  std::vector<long> bins;
+  for (size_t b = 0; b < num_bins; ++b) {
+    bins.push_back(num_bins - b - 1);
+  }
+  for (size_t r = 0; r < dash::myid(); ++r) {
+    bins.push_back(0);
+  }
+  std::vector<value_t> ones(bins.size(), 1);
+  dash::scatter_accumulate(ones.data(), bins.begin(), bins.end(),
+                           histogram.begin(), dash::plus<value_t>())
+    .wait();
+  histogram.barrier();
+
+  value_t nunits = dash::size();
+  EXPECT_EQ_U(nunits + (nunits * (nunits - 1)) / 2,
+              static_cast<value_t>(histogram[0]));
+  for (auto li = 0; li < histogram.lsize(); ++li) {
+    if (histogram.pattern().global(li) > 0) {
+      EXPECT_EQ_U(nunits, histogram.local[li]);
+    }
+  }
+  histogram.barrier();
+}
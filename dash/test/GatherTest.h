@@ -0,0 +1,26 @@
+#ifndef DASH__TEST__GATHER_TEST_H_
+#define DASH__TEST__GATHER_TEST_H_
+
+#include <gtest/gtest.h>
+#include <libdash.h>
+
+/**
+ * Test fixture for indexed gather and scatter algorithms.
+ */
+class GatherTest : public ::testing::Test {
+protected:
+
+  GatherTest() {
+  }
+
+  virtual ~GatherTest() {
+  }
+
+  virtual void SetUp() {
+  }
+
+  virtual void TearDown() {
+  }
+};
+
+#endif // DASH__TEST__GATHER_TEST_H_
@@ -50,3 +50,47 @@ TEST_F(GlobAsyncRefTest, Push) {
   }
 }
 
+
+/**
+ * Batched scattered writes and reads to distributed array.
+ */
+TEST_F(GlobAsyncRefTest, BatchPutGet) {
+  typedef long value_t;
+  size_t num_elem_per_unit = 30;
+  size_t num_elem          = _dash_size * num_elem_per_unit;
+  dash::Array<value_t> array(num_elem, dash::BLOCKCYCLIC(4));
+  for (size_t li = 0; li < array.lsize(); ++li) {
+    array.local[li] = -1;
+  }
+  array.barrier();
+  // Every unit writes a strided subset of elements in reverse order,
+  // some elements are written twice:
+  for (size_t gi = num_elem; gi > 0; --gi) {
+    size_t g_idx = gi - 1;
+    if (g_idx % _dash_size == static_cast<size_t>(_dash_id)) {
+      array.async.put(g_idx, 0);
+      array.async.put(g_idx, g_idx * 10);
+    }
+  }
+  array.async.flush();
+  array.barrier();
+  for (size_t li = 0; li < array.lsize(); ++li) {
+    value_t g_idx = array.pattern().global(li);
+    ASSERT_EQ_U(g_idx * 10, array.local[li]);
+  }
+  // Scattered reads, including duplicates, in arbitrary order:
+  std::vector<size_t> read_idcs;
+  for (size_t r = 0; r < 2 * num_elem; ++r) {
+    read_idcs.push_back((r * 7 + _dash_id) % num_elem);
+  }
+  for (auto g_idx : read_idcs) {
+    array.async.get(g_idx);
+  }
+  auto fut_values = array.async.fetch_values();
+  auto & values   = fut_values.get();
+  ASSERT_EQ_U(read_idcs.size(), values.size());
+  for (size_t r = 0; r < read_idcs.size(); ++r) {
+    EXPECT_EQ_U(static_cast<value_t>(read_idcs[r] * 10), values[r]);
+  }
+  array.barrier();
+}
@@ -0,0 +1,35 @@
+#include <libdash.h>
+#include <gtest/gtest.h>
+#include "TestBase.h"
+#include "GlobMemTest.h"
+
+TEST_F(GlobMemTest, IndexToGptr)
+{
+  typedef int value_t;
+
+  size_t num_local_elem = 17;
+  dash::GlobMem<value_t> globmem(dash::Team::All(), num_local_elem);
+
+  // Initialize local values:
+  auto lbegin = globmem.lbegin();
+  for (size_t l_idx = 0; l_idx < num_local_elem; ++l_idx) {
+    lbegin[l_idx] = dash::myid() * 1000 + l_idx;
+  }
+  globmem.barrier();
+
+  for (size_t unit = 0; unit < dash::size(); ++unit) {
+    for (size_t l_idx = 0; l_idx < num_local_elem; ++l_idx) {
+      dart_gptr_t gptr = globmem.index_to_gptr(unit, l_idx);
+      ASSERT_EQ_U(unit, gptr.unitid);
+      if (unit == static_cast<size_t>(dash::myid())) {
+        void * addr;
+        ASSERT_EQ_U(DART_OK, dart_gptr_getaddr(gptr, &addr));
+        ASSERT_EQ_U(lbegin + l_idx, static_cast<value_t *>(addr));
+      }
+      value_t value;
+      dash::get_value(&value, dash::GlobPtr<value_t>(gptr));
+      ASSERT_EQ_U(unit * 1000 + l_idx, value);
+    }
+  }
+  globmem.barrier();
+}
@@ -0,0 +1,26 @@
+#ifndef DASH__TEST__GLOB_MEM_TEST_H_
+#define DASH__TEST__GLOB_MEM_TEST_H_
+
+#include <gtest/gtest.h>
+#include <libdash.h>
+
+/**
+ * Test fixture for class dash::GlobMem
+ */
+class GlobMemTest : public ::testing::Test {
+protected:
+
+  GlobMemTest() {
+  }
+
+  virtual ~GlobMemTest() {
+  }
+
+  virtual void SetUp() {
+  }
+
+  virtual void TearDown() {
+  }
+};
+
+#endif // DASH__TEST__GLOB_MEM_TEST_H_
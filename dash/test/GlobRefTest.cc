@@ -0,0 +1,73 @@
+#include <libdash.h>
+#include <gtest/gtest.h>
+
+#include "TestBase.h"
+#include "GlobRefTest.h"
+
+#include <algorithm>
+#include <vector>
+
+TEST_F(GlobRefTest, AtomicCompoundAssignment)
+{
+  typedef long value_t;
+  size_t nunits = dash::size();
+  dash::Array<value_t> array(nunits);
+  array.local[0] = 100;
+  array.barrier();
+
+  // Every unit updates the element at unit 0 concurrently:
+  array[0] += 3;
+  array[0] -= 1;
+  ++array[0];
+  --array[0];
+  ++array[0];
+  array.barrier();
+  EXPECT_EQ_U(static_cast<value_t>(100 + 3 * nunits),
+              static_cast<value_t>(array[0]));
+  array.barrier();
+
+  // Postfix operators return distinct previous values:
+  value_t prev = array[0]++;
+  array.barrier();
+  std::vector<value_t> prev_all(nunits);
+  dash::Array<value_t> prev_values(nunits);
+  prev_values.local[0] = prev;
+  prev_values.barrier();
+  for (size_t u = 0; u < nunits; ++u) {
+    prev_all[u] = prev_values[u];
+  }
+  std::sort(prev_all.begin(), prev_all.end());
+  for (size_t u = 0; u < nunits; ++u) {
+    EXPECT_EQ_U(static_cast<value_t>(100 + 3 * nunits + u), prev_all[u]);
+  }
+  EXPECT_EQ_U(static_cast<value_t>(100 + 4 * nunits),
+              static_cast<value_t>(array[0]));
+  array.barrier();
+}
+
+TEST_F(GlobRefTest, AddSubFlush)
+{
+  typedef unsigned long value_t;
+  size_t nunits = dash::size();
+  dash::Array<value_t> hist(nunits);
+  hist.local[0] = 10;
+  hist.barrier();
+
+  // Fire-and-forget updates at every unit:
+  for (size_t u = 0; u < nunits; ++u) {
+    hist[u].add(u + 2);
+    hist[u].sub(1);
+  }
+  for (size_t u = 0; u < nunits; ++u) {
+    hist[u].flush();
+  }
+  hist.barrier();
+  EXPECT_EQ_U(10 + (dash::myid() + 1) * nunits,
+              static_cast<value_t>(hist.local[0]));
+  hist.barrier();
+
+  value_t prev = hist[0].fetch_add(1);
+  EXPECT_LE_U(10 + nunits, prev);
+  EXPECT_LT_U(prev, 10 + 2 * nunits);
+  hist.barrier();
+}
@@ -0,0 +1,26 @@
+#ifndef DASH__TEST__GLOBREF_TEST_H_
+#define DASH__TEST__GLOBREF_TEST_H_
+
+#include <gtest/gtest.h>
+#include <libdash.h>
+
+/**
+ * Test fixture for class dash::GlobRef
+ */
+class GlobRefTest : public ::testing::Test {
+protected:
+
+  GlobRefTest() {
+  }
+
+  virtual ~GlobRefTest() {
+  }
+
+  virtual void SetUp() {
+  }
+
+  virtual void TearDown() {
+  }
+};
+
+#endif // DASH__TEST__GLOBREF_TEST_H_
@@ -742,3 +742,75 @@ TEST_F(MatrixTest, StorageOrder)
     }
   }
 }
+
+namespace {
+
+/**
+ * Traverses all elements of a matrix with a single iterator, crossing
+ * local and remote blocks.
+ */
+template<class MatrixT>
+void test_iterator_local_position(MatrixT & matrix)
+{
+  typedef typename MatrixT::index_type index_t;
+  const auto & pattern = matrix.pattern();
+  for (auto l = matrix.lbegin(); l != matrix.lend(); ++l) {
+    *l = dash::myid() * 1000000 + (l - matrix.lbegin());
+  }
+  matrix.barrier();
+
+  auto it = matrix.begin();
+  for (index_t g = 0; g < static_cast<index_t>(pattern.size());
+       ++g, ++it) {
+    auto expected = pattern.local_index(pattern.coords(g));
+    auto lpos     = it.lpos();
+    ASSERT_EQ_U(expected.unit,  lpos.unit);
+    ASSERT_EQ_U(expected.index, lpos.index);
+    ASSERT_EQ_U(expected.unit * 1000000 + expected.index,
+                static_cast<long>(*it));
+  }
+  // Iterators derived by arithmetic:
+  for (index_t g = pattern.size(); g > 0; g -= 3) {
+    auto expected = pattern.local_index(pattern.coords(g - 1));
+    auto git      = matrix.begin() + (g - 1);
+    ASSERT_EQ_U(expected.unit,  git.lpos().unit);
+    ASSERT_EQ_U(expected.index, git.lpos().index);
+  }
+  matrix.barrier();
+}
+
+} // namespace
+
+TEST_F(MatrixTest, IteratorLocalPosition)
+{
+  typedef dash::default_index_t                  index_t;
+  typedef dash::TilePattern<2, dash::ROW_MAJOR>  tile_pattern_t;
+  typedef dash::Pattern<2, dash::ROW_MAJOR>      block_pattern_t;
+
+  size_t tilesize_x = 3;
+  size_t tilesize_y = 2;
+  tile_pattern_t tile_pattern(
+    dash::SizeSpec<2>(
+      tilesize_x * 2 * _dash_size,
+      tilesize_y * 3),
+    dash::DistributionSpec<2>(
+      dash::TILE(tilesize_x),
+      dash::TILE(tilesize_y)));
+  // Underfilled last blocks in both dimensions:
+  block_pattern_t block_pattern(
+    dash::SizeSpec<2>(
+      5 * _dash_size + 2,
+      7 * 2 + 3),
+    dash::DistributionSpec<2>(
+      dash::BLOCKCYCLIC(5),
+      dash::BLOCKCYCLIC(7)),
+    dash::TeamSpec<2>(_dash_size, 1),
+    dash::Team::All());
+
+  dash::Matrix<long, 2, index_t, tile_pattern_t>  tile_matrix(tile_pattern);
+  dash::Matrix<long, 2, index_t, block_pattern_t> block_matrix(
+                                                    block_pattern);
+
+  test_iterator_local_position(tile_matrix);
+  test_iterator_local_position(block_matrix);
+}
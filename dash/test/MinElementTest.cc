@@ -2,6 +2,7 @@
 #include <gtest/gtest.h>
 
 #include <limits>
+#include <cstdlib>
 
 #include "TestBase.h"
 #include "MinElementTest.h"
@@ -254,3 +255,61 @@ TEST_F(MinElementTest, TestFindMatrixDefault)
   EXPECT_EQ(min_value, found_min);
 }
 
+
+TEST_F(MinElementTest, TestCompareFirstOccurrence)
+{
+  // Equivalent minimum values at every unit, the first occurrence in
+  // global order must be found:
+  dash::Array<Element_t> array(_num_elem, dash::BLOCKCYCLIC(5));
+  for (auto li = 0; li < array.local.size(); ++li) {
+    array.local[li] = 1000 + li;
+  }
+  array.barrier();
+  // Unit 0 holds first block, minimum value 1000 at every unit:
+  dash::GlobPtr<Element_t> min_gptr =
+    dash::min_element(
+      array.begin(),
+      array.end(),
+      [](const Element_t & a, const Element_t & b) {
+        return a < b;
+      });
+  EXPECT_EQ_U(min_gptr, array.begin());
+  // Compare by absolute distance to 1002, minimum at local index 2 of
+  // every unit, first occurrence at global index 2:
+  min_gptr = dash::min_element(
+               array.begin() + 1,
+               array.end(),
+               [](const Element_t & a, const Element_t & b) {
+                 return std::abs(a - 1002) < std::abs(b - 1002);
+               });
+  EXPECT_EQ_U(1002, static_cast<Element_t>(*min_gptr));
+  EXPECT_EQ_U(min_gptr, (array.begin() + 2));
+}
+
+TEST_F(MinElementTest, TestMinMaxElement)
+{
+  Array_t array(_num_elem, dash::BLOCKCYCLIC(7));
+  if (dash::myid() == 0) {
+    for (auto i = 0; i < array.size(); ++i) {
+      array[i] = (i * 31) % 97 + 10;
+    }
+    array[_num_elem / 3]     = 1;
+    array[_num_elem / 2]     = 1;
+    array[_num_elem / 4]     = 500;
+    array[_num_elem * 2 / 3] = 500;
+  }
+  array.barrier();
+
+  auto minmax = dash::minmax_element(array.begin(), array.end());
+  // First occurrence of minimum, last occurrence of maximum as in
+  // std::minmax_element:
+  EXPECT_EQ_U(minmax.first, (array.begin() + _num_elem / 3));
+  EXPECT_EQ_U(minmax.second, (array.begin() + _num_elem * 2 / 3));
+  EXPECT_EQ_U(1,   static_cast<Element_t>(*minmax.first));
+  EXPECT_EQ_U(500, static_cast<Element_t>(*minmax.second));
+
+  // Empty range:
+  auto minmax_empty = dash::minmax_element(array.begin(), array.begin());
+  EXPECT_EQ_U(minmax_empty.first, array.begin());
+  array.barrier();
+}
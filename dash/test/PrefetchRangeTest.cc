@@ -0,0 +1,45 @@
+#include <libdash.h>
+#include <gtest/gtest.h>
+#include "TestBase.h"
+#include "PrefetchRangeTest.h"
+
+TEST_F(PrefetchRangeTest, BlockcyclicArray)
+{
+  typedef int value_t;
+
+  size_t blocksize      = 5;
+  size_t num_local_elem = 37;
+  size_t num_elem       = dash::size() * num_local_elem;
+  dash::Array<value_t> array(num_elem, dash::BLOCKCYCLIC(blocksize));
+
+  for (size_t g = 0; g < array.size(); ++g) {
+    if (array[g].is_local()) {
+      array[g] = g;
+    }
+  }
+  array.barrier();
+
+  // Window sizes smaller and larger than blocks and range:
+  for (size_t window : { 1, 3, 17, 64, 4096 }) {
+    size_t g = 0;
+    for (auto value : dash::prefetch_range(
+                        array.begin(), array.end(), window)) {
+      ASSERT_EQ_U(g, value);
+      ++g;
+    }
+    ASSERT_EQ_U(num_elem, g);
+  }
+
+  // Subrange:
+  auto   sub_first = array.begin() + 3;
+  auto   sub_last  = array.end()   - 2;
+  auto   range     = dash::prefetch_range(sub_first, sub_last, 8);
+  size_t g         = 3;
+  ASSERT_EQ_U(num_elem - 5, range.size());
+  for (auto it = range.begin(); it != range.end(); ++it, ++g) {
+    ASSERT_EQ_U(g, *it);
+  }
+  ASSERT_EQ_U(num_elem - 2, g);
+
+  array.barrier();
+}
@@ -0,0 +1,26 @@
+#ifndef DASH__TEST__PREFETCH_RANGE_TEST_H_
+#define DASH__TEST__PREFETCH_RANGE_TEST_H_
+
+#include <gtest/gtest.h>
+#include <libdash.h>
+
+/**
+ * Test fixture for dash::prefetch_range
+ */
+class PrefetchRangeTest : public ::testing::Test {
+protected:
+
+  PrefetchRangeTest() {
+  }
+
+  virtual ~PrefetchRangeTest() {
+  }
+
+  virtual void SetUp() {
+  }
+
+  virtual void TearDown() {
+  }
+};
+
+#endif // DASH__TEST__PREFETCH_RANGE_TEST_H_
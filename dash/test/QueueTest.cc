@@ -0,0 +1,129 @@
+#include <libdash.h>
+#include <gtest/gtest.h>
+
+#include "TestBase.h"
+#include "QueueTest.h"
+
+#include <vector>
+
+TEST_F(QueueTest, PushPopLocal)
+{
+  typedef dash::Queue<int> queue_t;
+  // Capacity is rounded up to a power of two:
+  queue_t queue(100);
+  int nlocal = queue.lcapacity();
+  EXPECT_EQ_U(128, nlocal);
+  EXPECT_EQ_U(128 * dash::size(), queue.capacity());
+
+  int myid = dash::myid();
+  for (int i = 0; i < nlocal; ++i) {
+    EXPECT_TRUE_U(queue.push(myid * 1000 + i));
+  }
+  // Ring is full:
+  EXPECT_FALSE(queue.push(-1));
+  EXPECT_EQ_U(nlocal, queue.lsize());
+  queue.barrier();
+  EXPECT_EQ_U(nlocal * dash::size(), queue.size());
+
+  // Elements are dequeued in FIFO order:
+  int value;
+  for (int i = 0; i < nlocal; ++i) {
+    EXPECT_EQ_U(1, queue.pop_from(myid, &value, &value + 1));
+    EXPECT_EQ_U(myid * 1000 + i, value);
+  }
+  EXPECT_EQ_U(0, queue.pop_from(myid, &value, &value + 1));
+  queue.barrier();
+  EXPECT_TRUE_U(queue.empty());
+}
+
+TEST_F(QueueTest, BulkPushSteal)
+{
+  typedef dash::Queue<long> queue_t;
+  long    nunits  = dash::size();
+  long    myid    = dash::myid();
+  long    nelem   = 240;
+  queue_t queue(nelem);
+
+  // Every unit pushes blocks of elements to all units:
+  std::vector<long> values(nelem);
+  for (long i = 0; i < nelem; ++i) {
+    values[i] = myid * nelem + i;
+  }
+  long block = nelem / nunits;
+  for (long u = 0; u < nunits; ++u) {
+    long first  = u * block;
+    long last   = (u == nunits - 1) ? nelem : first + block;
+    auto target = (myid + u) % nunits;
+    EXPECT_EQ_U(last - first,
+                queue.push(values.data() + first, values.data() + last,
+                           target));
+  }
+  queue.barrier();
+
+  // Units dequeue elements in bulk until all rings are empty:
+  long              count = 0;
+  long              sum   = 0;
+  std::vector<long> buf(17);
+  for (;;) {
+    auto n = queue.pop(buf.data(), buf.data() + buf.size());
+    if (n == 0) {
+      break;
+    }
+    for (size_t i = 0; i < n; ++i) {
+      sum += buf[i];
+    }
+    count += n;
+  }
+  dash::Array<long> counts(2 * nunits);
+  counts.local[0] = count;
+  counts.local[1] = sum;
+  counts.barrier();
+
+  long total = nelem * nunits;
+  long total_count = 0;
+  long total_sum   = 0;
+  for (long u = 0; u < nunits; ++u) {
+    total_count += counts[2 * u];
+    total_sum   += counts[2 * u + 1];
+  }
+  EXPECT_EQ_U(total, total_count);
+  EXPECT_EQ_U(total * (total - 1) / 2, total_sum);
+  EXPECT_TRUE_U(queue.empty());
+  counts.barrier();
+}
+
+TEST_F(QueueTest, ConcurrentWrapAround)
+{
+  typedef dash::Queue<int> queue_t;
+  // Ring capacity much smaller than number of elements:
+  queue_t queue(16);
+  int nunits = dash::size();
+  int myid   = dash::myid();
+  int nelem  = 2000;
+  int next   = (myid + 1) % nunits;
+  int prev   = (myid + nunits - 1) % nunits;
+
+  std::vector<int> values(nelem);
+  for (int i = 0; i < nelem; ++i) {
+    values[i] = myid * nelem + i;
+  }
+  // Push to the next unit while dequeueing from the local ring which
+  // receives the elements of the previous unit only:
+  int npushed   = 0;
+  int nreceived = 0;
+  int buf[5];
+  while (npushed < nelem || nreceived < nelem) {
+    if (npushed < nelem) {
+      int last  = std::min(npushed + 7, nelem);
+      npushed  += queue.push(values.data() + npushed, values.data() + last,
+                             next);
+    }
+    auto n = queue.pop_from(myid, buf, buf + 5);
+    for (size_t i = 0; i < n; ++i, ++nreceived) {
+      // Elements of a single producer are received in FIFO order:
+      ASSERT_EQ_U(prev * nelem + nreceived, buf[i]);
+    }
+  }
+  EXPECT_EQ_U(0, queue.lsize());
+  queue.barrier();
+}
@@ -0,0 +1,26 @@
+#ifndef DASH__TEST__QUEUE_TEST_H_
+#define DASH__TEST__QUEUE_TEST_H_
+
+#include <gtest/gtest.h>
+#include <libdash.h>
+
+/**
+ * Test fixture for class dash::Queue
+ */
+class QueueTest : public ::testing::Test {
+protected:
+
+  QueueTest() {
+  }
+
+  virtual ~QueueTest() {
+  }
+
+  virtual void SetUp() {
+  }
+
+  virtual void TearDown() {
+  }
+};
+
+#endif // DASH__TEST__QUEUE_TEST_H_
@@ -0,0 +1,122 @@
+#include <libdash.h>
+#include <gtest/gtest.h>
+
+#include "TestBase.h"
+#include "RPCTest.h"
+
+#include <vector>
+
+namespace {
+
+long                * rpc_test_counters = nullptr;
+dash::Array<long>   * rpc_test_table    = nullptr;
+
+/// Adds a value to the counter of a source unit at the target unit
+struct add_counter {
+  void operator()(int source, long value) {
+    rpc_test_counters[source] += value;
+  }
+};
+
+/// Increments an element in the local block of the target unit
+struct increment_local {
+  void operator()(long lindex) {
+    rpc_test_table->local[lindex] += 1;
+  }
+};
+
+/// Forwards a call to the next unit until the number of hops is zero
+struct forward_hops {
+  void operator()(int hops) {
+    rpc_test_counters[0] += 1;
+    if (hops > 1) {
+      dash::rpc<forward_hops>((dash::myid() + 1) % dash::size(), hops - 1);
+    }
+  }
+};
+
+/// Returns the square of a value plus the target unit's id
+struct square_plus_id {
+  long operator()(long value) {
+    return value * value + dash::myid();
+  }
+};
+
+} // namespace
+
+TEST_F(RPCTest, RemoteAdd)
+{
+  std::vector<long> counters(dash::size(), 0);
+  rpc_test_counters = counters.data();
+  dash::barrier();
+
+  int  myid      = dash::myid();
+  long num_calls = 5000;
+  // Number of calls exceeds the capacity of a single batch:
+  for (long c = 0; c < num_calls; ++c) {
+    for (size_t u = 0; u < dash::size(); ++u) {
+      dash::rpc<add_counter>(u, myid, c);
+    }
+  }
+  dash::rpc_fence();
+
+  long expected = (num_calls * (num_calls - 1)) / 2;
+  for (size_t u = 0; u < dash::size(); ++u) {
+    EXPECT_EQ_U(expected, counters[u]);
+  }
+  dash::barrier();
+  rpc_test_counters = nullptr;
+}
+
+TEST_F(RPCTest, RandomUpdates)
+{
+  size_t num_elem = 100 * dash::size();
+  dash::Array<long> table(num_elem, dash::BLOCKCYCLIC(7));
+  dash::fill(table.begin(), table.end(), 0L);
+  rpc_test_table = &table;
+  table.barrier();
+
+  long num_updates = 2000;
+  unsigned int seed = 17 + dash::myid();
+  for (long i = 0; i < num_updates; ++i) {
+    auto gidx  = rand_r(&seed) % num_elem;
+    auto l_pos = table.pattern().local(gidx);
+    dash::rpc<increment_local>(l_pos.unit, l_pos.index);
+  }
+  dash::rpc_fence();
+
+  long total = dash::accumulate(table.begin(), table.end(), 0L);
+  EXPECT_EQ_U(num_updates * static_cast<long>(dash::size()), total);
+  table.barrier();
+  rpc_test_table = nullptr;
+}
+
+TEST_F(RPCTest, CallsFromProcedures)
+{
+  std::vector<long> counters(1, 0);
+  rpc_test_counters = counters.data();
+  dash::barrier();
+
+  int hops = 3 * dash::size() + 1;
+  dash::rpc<forward_hops>((dash::myid() + 1) % dash::size(), hops);
+  // Fence completes calls issued by remote procedures:
+  dash::rpc_fence();
+
+  // Every unit receives hops calls in total:
+  EXPECT_EQ_U(hops, counters[0]);
+  dash::barrier();
+  rpc_test_counters = nullptr;
+}
+
+TEST_F(RPCTest, AsyncResult)
+{
+  std::vector< dash::Future<long> > futs;
+  for (size_t u = 0; u < dash::size(); ++u) {
+    futs.push_back(dash::rpc_async<square_plus_id>(u, 3L + u));
+  }
+  for (size_t u = 0; u < dash::size(); ++u) {
+    long expected = (3 + u) * (3 + u) + u;
+    EXPECT_EQ_U(expected, futs[u].get());
+  }
+  dash::rpc_fence();
+}
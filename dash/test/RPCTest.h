@@ -0,0 +1,26 @@
+#ifndef DASH__TEST__RPC_TEST_H_
+#define DASH__TEST__RPC_TEST_H_
+
+#include <gtest/gtest.h>
+#include <libdash.h>
+
+/**
+ * Test fixture for remote procedure calls.
+ */
+class RPCTest : public ::testing::Test {
+protected:
+
+  RPCTest() {
+  }
+
+  virtual ~RPCTest() {
+  }
+
+  virtual void SetUp() {
+  }
+
+  virtual void TearDown() {
+  }
+};
+
+#endif // DASH__TEST__RPC_TEST_H_
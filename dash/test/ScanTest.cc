@@ -0,0 +1,148 @@
+#include <libdash.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "TestBase.h"
+#include "ScanTest.h"
+
+namespace {
+
+/**
+ * Affine map x -> a * x + b modulo a prime.
+ */
+struct affine_t {
+  long a;
+  long b;
+};
+
+/**
+ * Composition of affine maps, associative but not commutative:
+ * applies lhs first.
+ */
+struct affine_compose {
+  affine_t operator()(const affine_t & lhs, const affine_t & rhs) const {
+    const long prime = 1000003;
+    affine_t result;
+    result.a = (rhs.a * lhs.a) % prime;
+    result.b = (rhs.a * lhs.b + rhs.b) % prime;
+    return result;
+  }
+};
+
+} // namespace
+
+TEST_F(ScanTest, InclusiveBlockedInPlace)
+{
+  typedef long value_t;
+  size_t num_elem = 100 * dash::size() + 3;
+  dash::Array<value_t> array(num_elem, dash::BLOCKED);
+  for (auto li = 0; li < array.lsize(); ++li) {
+    array.local[li] = array.pattern().global(li) + 1;
+  }
+  array.barrier();
+
+  auto out_last = dash::inclusive_scan(array.begin(), array.end(),
+                                       array.begin());
+  EXPECT_EQ_U(array.end(), out_last);
+
+  for (auto li = 0; li < array.lsize(); ++li) {
+    value_t n = array.pattern().global(li) + 1;
+    EXPECT_EQ_U((n * (n + 1)) / 2, array.local[li]);
+  }
+  array.barrier();
+}
+
+TEST_F(ScanTest, ExclusiveBlockcyclic)
+{
+  typedef int value_t;
+  size_t num_elem = 37 * dash::size();
+  dash::Array<value_t> in(num_elem,  dash::BLOCKCYCLIC(5));
+  dash::Array<value_t> out(num_elem, dash::BLOCKCYCLIC(5));
+  for (auto li = 0; li < in.lsize(); ++li) {
+    in.local[li] = in.pattern().global(li) % 7;
+  }
+  in.barrier();
+
+  dash::exclusive_scan(in.begin(), in.end(), out.begin(), 10);
+
+  if (dash::myid() == 0) {
+    value_t expected = 10;
+    for (size_t i = 0; i < num_elem; ++i) {
+      EXPECT_EQ_U(expected, static_cast<value_t>(out[i]));
+      expected += i % 7;
+    }
+  }
+  out.barrier();
+}
+
+TEST_F(ScanTest, InclusiveSubrangeMax)
+{
+  typedef int value_t;
+  size_t num_elem = 29 * dash::size();
+  dash::Array<value_t> in(num_elem,  dash::BLOCKCYCLIC(3));
+  // Output distribution differs from input distribution:
+  dash::Array<value_t> out(num_elem, dash::BLOCKED);
+  for (auto li = 0; li < in.lsize(); ++li) {
+    auto gi = in.pattern().global(li);
+    in.local[li] = (gi * 37) % 101;
+  }
+  if (dash::myid() == 0) {
+    for (size_t i = 0; i < num_elem; ++i) {
+      out[i] = -1;
+    }
+  }
+  in.barrier();
+
+  size_t offset_first = 4;
+  size_t offset_last  = num_elem - 5;
+  dash::inclusive_scan(in.begin() + offset_first,
+                       in.begin() + offset_last,
+                       out.begin() + offset_first,
+                       dash::max<value_t>(),
+                       20);
+
+  if (dash::myid() == 0) {
+    value_t expected = 20;
+    for (size_t i = 0; i < num_elem; ++i) {
+      if (i < offset_first || i >= offset_last) {
+        EXPECT_EQ_U(-1, static_cast<value_t>(out[i]));
+        continue;
+      }
+      expected = std::max<value_t>(expected, (i * 37) % 101);
+      EXPECT_EQ_U(expected, static_cast<value_t>(out[i]));
+    }
+  }
+  out.barrier();
+}
+
+TEST_F(ScanTest, InclusiveCyclicNonCommutative)
+{
+  size_t num_elem = 37 * dash::size() + 2;
+  dash::Array<affine_t> array(num_elem, dash::CYCLIC);
+  for (auto li = 0; li < array.lsize(); ++li) {
+    long gi = array.pattern().global(li);
+    array.local[li].a = gi % 7 + 2;
+    array.local[li].b = gi % 11;
+  }
+  array.barrier();
+
+  dash::inclusive_scan(array.begin() + 1, array.end(), array.begin() + 1,
+                       affine_compose());
+
+  affine_t expected;
+  expected.a = 1;
+  expected.b = 0;
+  for (size_t i = 1; i < num_elem; ++i) {
+    affine_t elem;
+    elem.a   = i % 7 + 2;
+    elem.b   = i % 11;
+    expected = affine_compose()(expected, elem);
+    if (array.pattern().unit_at(i) == dash::myid()) {
+      affine_t actual = array.local[array.pattern().local(i).index];
+      EXPECT_EQ_U(expected.a, actual.a);
+      EXPECT_EQ_U(expected.b, actual.b);
+    }
+  }
+  array.barrier();
+}
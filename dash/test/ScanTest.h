@@ -0,0 +1,26 @@
+#ifndef DASH__TEST__SCAN_TEST_H_
+#define DASH__TEST__SCAN_TEST_H_
+
+#include <gtest/gtest.h>
+#include <libdash.h>
+
+/**
+ * Test fixture for algorithms dash::inclusive_scan and dash::exclusive_scan
+ */
+class ScanTest : public ::testing::Test {
+protected:
+
+  ScanTest() {
+  }
+
+  virtual ~ScanTest() {
+  }
+
+  virtual void SetUp() {
+  }
+
+  virtual void TearDown() {
+  }
+};
+
+#endif // DASH__TEST__SCAN_TEST_H_
@@ -0,0 +1,65 @@
+#include <libdash.h>
+#include <gtest/gtest.h>
+
+#include "TestBase.h"
+#include "SharedCounterTest.h"
+
+#include <algorithm>
+#include <vector>
+
+TEST_F(SharedCounterTest, IncDecGet)
+{
+  dash::SharedCounter<long> counter;
+  EXPECT_EQ_U(0, counter.get());
+
+  counter.inc(10);
+  counter.dec(3);
+  // Only own contributions are known without communication:
+  EXPECT_EQ_U(7, counter.get_approx());
+  dash::barrier();
+
+  long expected = 7 * dash::size();
+  EXPECT_EQ_U(expected, counter.get());
+  // Reading without recording the observed value:
+  EXPECT_EQ_U(7, counter.get_approx());
+  EXPECT_EQ_U(expected, counter.load());
+  EXPECT_EQ_U(expected, counter.get_collective());
+  EXPECT_EQ_U(expected, counter.get_approx());
+  dash::barrier();
+}
+
+TEST_F(SharedCounterTest, FetchAddTickets)
+{
+  typedef size_t value_t;
+  const value_t num_tickets = 50;
+  dash::SharedCounter<value_t> counter;
+  // Units draw tickets until all tickets are handed out:
+  std::vector<value_t> my_tickets;
+  for (value_t t = counter.fetch_add(1); t < num_tickets;
+       t = counter.fetch_add(1)) {
+    my_tickets.push_back(t);
+    EXPECT_LE_U(t + 1, counter.get_approx());
+  }
+  dash::barrier();
+  // Every unit drew one ticket beyond the last valid one:
+  EXPECT_EQ_U(num_tickets + dash::size(), counter.get_collective());
+
+  // Tickets are distinct across all units:
+  dash::Array<value_t> count_per_ticket(num_tickets * dash::size());
+  dash::fill(count_per_ticket.begin(), count_per_ticket.end(), value_t(0));
+  count_per_ticket.barrier();
+  for (auto t : my_tickets) {
+    count_per_ticket[t * dash::size() + dash::myid()] = 1;
+  }
+  dash::barrier();
+  if (dash::myid() == 0) {
+    for (value_t t = 0; t < num_tickets; ++t) {
+      value_t nholders = 0;
+      for (size_t u = 0; u < dash::size(); ++u) {
+        nholders += count_per_ticket[t * dash::size() + u];
+      }
+      EXPECT_EQ_U(1, nholders);
+    }
+  }
+  dash::barrier();
+}
@@ -0,0 +1,26 @@
+#ifndef DASH__TEST__SHARED_COUNTER_TEST_H_
+#define DASH__TEST__SHARED_COUNTER_TEST_H_
+
+#include <gtest/gtest.h>
+#include <libdash.h>
+
+/**
+ * Test fixture for class dash::SharedCounter
+ */
+class SharedCounterTest : public ::testing::Test {
+protected:
+
+  SharedCounterTest() {
+  }
+
+  virtual ~SharedCounterTest() {
+  }
+
+  virtual void SetUp() {
+  }
+
+  virtual void TearDown() {
+  }
+};
+
+#endif // DASH__TEST__SHARED_COUNTER_TEST_H_
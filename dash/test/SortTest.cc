@@ -0,0 +1,124 @@
+#include <libdash.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+#include "TestBase.h"
+#include "SortTest.h"
+
+namespace {
+
+/**
+ * Reads all elements in the global range [first, last) to a local
+ * vector.
+ */
+template<class GlobIt>
+std::vector<typename GlobIt::value_type> gather_range(
+  GlobIt first,
+  GlobIt last)
+{
+  std::vector<typename GlobIt::value_type> values(
+    dash::distance(first, last));
+  dash::copy(first, last, values.data());
+  return values;
+}
+
+} // namespace
+
+TEST_F(SortTest, BlockedRandom)
+{
+  typedef int value_t;
+  size_t num_elem = 1000 * dash::size() + 17;
+  dash::Array<value_t> array(num_elem, dash::BLOCKED);
+  std::srand(dash::myid() + 7);
+  for (auto li = 0; li < array.lsize(); ++li) {
+    array.local[li] = std::rand() % 500;
+  }
+  array.barrier();
+  auto unsorted = gather_range(array.begin(), array.end());
+  // Every unit must have read the unsorted values before sorting:
+  array.barrier();
+
+  dash::sort(array.begin(), array.end());
+
+  auto sorted = gather_range(array.begin(), array.end());
+  std::sort(unsorted.begin(), unsorted.end());
+  ASSERT_EQ_U(unsorted.size(), sorted.size());
+  EXPECT_TRUE_U(unsorted == sorted);
+  // Pattern and local sizes are unchanged:
+  EXPECT_EQ_U(num_elem, array.size());
+  array.barrier();
+}
+
+TEST_F(SortTest, BlockcyclicComparator)
+{
+  typedef long value_t;
+  size_t num_elem = 113 * dash::size();
+  dash::Array<value_t> array(num_elem, dash::BLOCKCYCLIC(7));
+  for (auto li = 0; li < array.lsize(); ++li) {
+    // Many duplicates across units:
+    array.local[li] = (li * 13 + dash::myid()) % 29;
+  }
+  array.barrier();
+  auto unsorted = gather_range(array.begin(), array.end());
+  array.barrier();
+
+  dash::sort(array.begin(), array.end(), std::greater<value_t>());
+
+  auto sorted = gather_range(array.begin(), array.end());
+  std::sort(unsorted.begin(), unsorted.end(), std::greater<value_t>());
+  EXPECT_TRUE_U(unsorted == sorted);
+  array.barrier();
+}
+
+TEST_F(SortTest, Subrange)
+{
+  typedef double value_t;
+  size_t num_elem = 50 * dash::size();
+  dash::Array<value_t> array(num_elem, dash::BLOCKED);
+  for (auto li = 0; li < array.lsize(); ++li) {
+    array.local[li] = static_cast<value_t>(array.lsize() - li) +
+                      0.5 * dash::myid();
+  }
+  array.barrier();
+  auto values = gather_range(array.begin(), array.end());
+  array.barrier();
+
+  // Range boundaries within the first and last unit's local range:
+  size_t offset_first = 20;
+  size_t offset_last  = num_elem - 10;
+  dash::sort(array.begin() + offset_first, array.begin() + offset_last);
+
+  auto sorted = gather_range(array.begin(), array.end());
+  std::sort(values.begin() + offset_first, values.begin() + offset_last);
+  EXPECT_TRUE_U(values == sorted);
+  array.barrier();
+}
+
+TEST_F(SortTest, AllEqual)
+{
+  typedef int value_t;
+  size_t num_elem = 200 * dash::size();
+  dash::Array<value_t> array(num_elem, dash::BLOCKCYCLIC(3));
+  for (auto li = 0; li < array.lsize(); ++li) {
+    array.local[li] = 42;
+  }
+  array.barrier();
+  // Single distinct element at the end of the range:
+  if (dash::myid() == 0) {
+    array[num_elem - 1] = 7;
+  }
+  array.barrier();
+
+  dash::sort(array.begin(), array.end());
+
+  auto sorted = gather_range(array.begin(), array.end());
+  ASSERT_EQ_U(num_elem, sorted.size());
+  EXPECT_EQ_U(7, sorted[0]);
+  EXPECT_EQ_U(num_elem - 1,
+              static_cast<size_t>(
+                std::count(sorted.begin(), sorted.end(), 42)));
+  array.barrier();
+}
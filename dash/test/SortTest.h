@@ -0,0 +1,26 @@
+#ifndef DASH__TEST__SORT_TEST_H_
+#define DASH__TEST__SORT_TEST_H_
+
+#include <gtest/gtest.h>
+#include <libdash.h>
+
+/**
+ * Test fixture for algorithm dash::sort
+ */
+class SortTest : public ::testing::Test {
+protected:
+
+  SortTest() {
+  }
+
+  virtual ~SortTest() {
+  }
+
+  virtual void SetUp() {
+  }
+
+  virtual void TearDown() {
+  }
+};
+
+#endif // DASH__TEST__SORT_TEST_H_
@@ -0,0 +1,154 @@
+#include <libdash.h>
+#include <gtest/gtest.h>
+
+#include "TestBase.h"
+#include "TasksTest.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace {
+
+std::atomic<long> _leaves(0);
+
+/**
+ * Binary tree of stealable tasks, leaves are counted at the unit
+ * executing them.
+ */
+struct tree_task {
+  void operator()(int depth, long work_us) {
+    std::this_thread::sleep_for(std::chrono::microseconds(work_us));
+    if (depth == 0) {
+      ++_leaves;
+      return;
+    }
+    dash::tasks::async_stealable<tree_task>(depth - 1, work_us);
+    dash::tasks::async_stealable<tree_task>(depth - 1, work_us);
+  }
+};
+
+long sum_of_units(long value)
+{
+  dash::Array<long> values(dash::size());
+  values.local[0] = value;
+  values.barrier();
+  long sum = 0;
+  for (size_t u = 0; u < dash::size(); ++u) {
+    sum += values[u];
+  }
+  values.barrier();
+  return sum;
+}
+
+} // namespace
+
+TEST_F(TasksTest, Dependencies)
+{
+  long nlocal = 8;
+  dash::Array<long> array(nlocal * dash::size());
+  for (long i = 0; i < nlocal; ++i) {
+    array.local[i] = i;
+  }
+  array.barrier();
+
+  // Chains of tasks on every local element, chains are independent:
+  long * lbegin = array.lbegin();
+  long   gbegin = dash::myid() * nlocal;
+  int    nsteps = 20;
+  for (int s = 0; s < nsteps; ++s) {
+    for (long i = 0; i < nlocal; ++i) {
+      dash::GlobPtr<long> elem((array.begin() + gbegin + i).dart_gptr());
+      dash::tasks::async(
+        [=]() { lbegin[i] = lbegin[i] * 3 % 1000003 + s; },
+        dash::tasks::out(elem));
+    }
+  }
+  // Reads all local elements after the chains:
+  long sum = 0;
+  dash::GlobPtr<long> first((array.begin() + gbegin).dart_gptr());
+  dash::tasks::async(
+    [&sum, lbegin, nlocal]() {
+      for (long i = 0; i < nlocal; ++i) {
+        sum += lbegin[i];
+      }
+    },
+    dash::tasks::in(first, first + nlocal));
+  dash::tasks::complete();
+
+  long expected_sum = 0;
+  for (long i = 0; i < nlocal; ++i) {
+    long expected = i;
+    for (int s = 0; s < nsteps; ++s) {
+      expected = expected * 3 % 1000003 + s;
+    }
+    EXPECT_EQ_U(expected, array.local[i]);
+    expected_sum += expected;
+  }
+  EXPECT_EQ_U(expected_sum, sum);
+  array.barrier();
+}
+
+TEST_F(TasksTest, StealableTree)
+{
+  int depth = 8;
+  _leaves   = 0;
+  dash::tasks::reset_statistics();
+  // All tasks are created by unit 0:
+  if (dash::myid() == 0) {
+    dash::tasks::async_stealable<tree_task>(depth, 20L);
+  }
+  dash::tasks::complete();
+
+  auto stats = dash::tasks::statistics();
+  EXPECT_EQ_U(1L << depth, sum_of_units(_leaves));
+  EXPECT_EQ_U((2L << depth) - 1,
+              sum_of_units(static_cast<long>(stats.executed)));
+  long nstolen = sum_of_units(stats.remote_tasks_stolen);
+  EXPECT_LE_U(nstolen, sum_of_units(stats.published));
+  if (dash::size() > 1) {
+    EXPECT_GT_U(nstolen, 0);
+  }
+}
+
+TEST_F(TasksTest, TraceHook)
+{
+  std::atomic<long> nbegin(0);
+  std::atomic<long> nend(0);
+  std::atomic<long> nremote(0);
+  dash::tasks::reset_statistics();
+  dash::tasks::set_trace_hook(
+    [&](dash::tasks::trace_event event, int thread, int victim) {
+      switch (event) {
+        case dash::tasks::trace_event::task_begin:
+          ++nbegin;
+          break;
+        case dash::tasks::trace_event::task_end:
+          ++nend;
+          break;
+        case dash::tasks::trace_event::remote_steal:
+        case dash::tasks::trace_event::remote_steal_failed:
+          ++nremote;
+          break;
+        default:
+          break;
+      }
+    });
+
+  std::atomic<long> nexecuted(0);
+  long ntasks = 100;
+  for (long t = 0; t < ntasks; ++t) {
+    dash::tasks::async([&nexecuted]() { ++nexecuted; });
+  }
+  dash::tasks::complete();
+  dash::tasks::set_trace_hook(dash::tasks::trace_hook_t());
+
+  auto stats = dash::tasks::statistics();
+  EXPECT_EQ_U(ntasks, nexecuted.load());
+  EXPECT_EQ_U(ntasks, static_cast<long>(stats.executed));
+  EXPECT_EQ_U(ntasks, nbegin.load());
+  EXPECT_EQ_U(ntasks, nend.load());
+  EXPECT_EQ_U(static_cast<long>(stats.remote_steal_attempts),
+              nremote.load());
+  dash::Team::All().barrier();
+}
@@ -0,0 +1,26 @@
+#ifndef DASH__TEST__TASKS_TEST_H_
+#define DASH__TEST__TASKS_TEST_H_
+
+#include <gtest/gtest.h>
+#include <libdash.h>
+
+/**
+ * Test fixture for the task runtime dash::tasks
+ */
+class TasksTest : public ::testing::Test {
+protected:
+
+  TasksTest() {
+  }
+
+  virtual ~TasksTest() {
+  }
+
+  virtual void SetUp() {
+  }
+
+  virtual void TearDown() {
+  }
+};
+
+#endif // DASH__TEST__TASKS_TEST_H_
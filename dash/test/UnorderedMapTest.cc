@@ -0,0 +1,165 @@
+#include <libdash.h>
+#include <gtest/gtest.h>
+
+#include "TestBase.h"
+#include "UnorderedMapTest.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+TEST_F(UnorderedMapTest, InsertFind)
+{
+  typedef dash::UnorderedMap<long, double> map_t;
+  long   nkeys_per_unit = 500;
+  long   nkeys          = nkeys_per_unit * dash::size();
+  map_t  map(2 * nkeys);
+  EXPECT_LE_U(2 * nkeys, map.bucket_count());
+
+  // Every unit inserts a contiguous range of keys:
+  std::vector< std::pair<long, double> > elements;
+  for (long k = 0; k < nkeys_per_unit; ++k) {
+    long key = dash::myid() * nkeys_per_unit + k;
+    elements.push_back(std::make_pair(key, key * 0.5));
+  }
+  auto fut = map.insert(elements.begin(), elements.end());
+  EXPECT_EQ_U(nkeys_per_unit, fut.get());
+  map.barrier();
+
+  EXPECT_EQ_U(nkeys, map.size());
+  // Local elements are owned by the calling unit:
+  size_t nlocal = 0;
+  for (auto & element : map.local) {
+    EXPECT_EQ_U(dash::myid(), map.unit_of(element.first));
+    EXPECT_EQ_U(element.first * 0.5, element.second);
+    ++nlocal;
+  }
+  EXPECT_EQ_U(map.local.size(), nlocal);
+
+  // Look up all keys of the next unit and keys that do not exist:
+  std::vector<long> keys;
+  long next = (dash::myid() + 1) % dash::size();
+  for (long k = 0; k < nkeys_per_unit; ++k) {
+    keys.push_back(next * nkeys_per_unit + k);
+  }
+  keys.push_back(-1);
+  keys.push_back(nkeys + 3);
+  std::vector<double>     values(keys.size(), -1);
+  std::unique_ptr<bool[]> found(new bool[keys.size()]);
+  auto nfound = map.find(keys.begin(), keys.end(), values.data(),
+                         found.get());
+  EXPECT_EQ_U(nkeys_per_unit, nfound);
+  for (long k = 0; k < nkeys_per_unit; ++k) {
+    EXPECT_TRUE_U(found[k]);
+    EXPECT_EQ_U(keys[k] * 0.5, values[k]);
+  }
+  EXPECT_FALSE(found[keys.size() - 2]);
+  EXPECT_FALSE(found[keys.size() - 1]);
+
+  double value;
+  EXPECT_TRUE_U(map.find(3, value));
+  EXPECT_EQ_U(1.5, value);
+  map.barrier();
+}
+
+TEST_F(UnorderedMapTest, InsertExisting)
+{
+  typedef dash::UnorderedMap<int, int> map_t;
+  map_t map(64 * dash::size());
+
+  // All units insert the same keys, every key is inserted once:
+  std::vector< std::pair<int, int> > elements;
+  for (int k = 0; k < 20; ++k) {
+    elements.push_back(std::make_pair(k, dash::myid()));
+  }
+  auto ninserted = map.insert(elements.begin(), elements.end()).get();
+  map.barrier();
+
+  size_t ninserted_total = 0;
+  dash::Array<size_t> counts(dash::size());
+  counts.local[0] = ninserted;
+  counts.barrier();
+  for (size_t u = 0; u < dash::size(); ++u) {
+    ninserted_total += counts[u];
+  }
+  EXPECT_EQ_U(20, ninserted_total);
+  EXPECT_EQ_U(20, map.size());
+  EXPECT_FALSE(map.insert(std::make_pair(3, 100)));
+  map.barrier();
+}
+
+TEST_F(UnorderedMapTest, InsertOrUpdate)
+{
+  typedef dash::UnorderedMap<long, long> map_t;
+  long  nkeys = 37;
+  map_t map(4 * nkeys);
+
+  // Count occurrences of keys at their owners:
+  std::vector< std::pair<long, long> > elements;
+  for (long k = 0; k < nkeys; ++k) {
+    for (long r = 0; r <= k % 3; ++r) {
+      elements.push_back(std::make_pair(k, 1L));
+    }
+  }
+  map.insert_or_update(elements.begin(), elements.end(),
+                       dash::plus<long>()).wait();
+  map.barrier();
+
+  EXPECT_EQ_U(nkeys, map.size());
+  for (auto & element : map.local) {
+    long expected = (element.first % 3 + 1) * dash::size();
+    EXPECT_EQ_U(expected, element.second);
+  }
+  map.barrier();
+}
+
+TEST_F(UnorderedMapTest, UpdateStatefulOperation)
+{
+  typedef dash::UnorderedMap<long, long> map_t;
+  long  nkeys = 50;
+  map_t map(4 * nkeys);
+
+  // Owners of remote and local elements apply the same weight:
+  long weight = 3;
+  std::vector< std::pair<long, long> > elements;
+  for (long k = 0; k < nkeys; ++k) {
+    elements.push_back(std::make_pair(k, 1L));
+  }
+  map.insert_or_update(elements.begin(), elements.end(),
+                       [weight](long lhs, long rhs) {
+                         return lhs + weight * rhs;
+                       }).wait();
+  map.barrier();
+
+  EXPECT_EQ_U(nkeys, map.size());
+  for (auto & element : map.local) {
+    long expected = 1 + weight * (dash::size() - 1);
+    EXPECT_EQ_U(expected, element.second);
+  }
+  map.barrier();
+}
+
+TEST_F(UnorderedMapTest, Rehash)
+{
+  typedef dash::UnorderedMap<long, long> map_t;
+  long  nkeys_per_unit = 100;
+  map_t map(nkeys_per_unit * dash::size());
+
+  std::vector< std::pair<long, long> > elements;
+  for (long k = 0; k < nkeys_per_unit / 2; ++k) {
+    long key = k * dash::size() + dash::myid();
+    elements.push_back(std::make_pair(key, -key));
+  }
+  map.insert(elements.begin(), elements.end()).wait();
+  map.rehash(8 * nkeys_per_unit * dash::size());
+  EXPECT_LE_U(8 * nkeys_per_unit * dash::size(), map.bucket_count());
+
+  long nkeys = nkeys_per_unit / 2 * dash::size();
+  EXPECT_EQ_U(nkeys, map.size());
+  for (long key = 0; key < nkeys; ++key) {
+    long value = 0;
+    EXPECT_TRUE_U(map.find(key, value));
+    EXPECT_EQ_U(-key, value);
+  }
+  map.barrier();
+}
@@ -0,0 +1,26 @@
+#ifndef DASH__TEST__UNORDERED_MAP_TEST_H_
+#define DASH__TEST__UNORDERED_MAP_TEST_H_
+
+#include <gtest/gtest.h>
+#include <libdash.h>
+
+/**
+ * Test fixture for class dash::UnorderedMap
+ */
+class UnorderedMapTest : public ::testing::Test {
+protected:
+
+  UnorderedMapTest() {
+  }
+
+  virtual ~UnorderedMapTest() {
+  }
+
+  virtual void SetUp() {
+  }
+
+  virtual void TearDown() {
+  }
+};
+
+#endif // DASH__TEST__UNORDERED_MAP_TEST_H_
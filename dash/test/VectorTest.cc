@@ -0,0 +1,90 @@
+#include <libdash.h>
+#include <gtest/gtest.h>
+
+#include "TestBase.h"
+#include "VectorTest.h"
+
+TEST_F(VectorTest, PushBackCommit)
+{
+  typedef dash::Vector<long> vector_t;
+  vector_t vec;
+  EXPECT_EQ_U(0, vec.size());
+  EXPECT_TRUE_U(vec.empty());
+
+  // Number of local elements differs between units and exceeds the
+  // initial local capacity:
+  long myid   = dash::myid();
+  long nlocal = 37 * (myid + 1);
+  for (long l = 0; l < nlocal; ++l) {
+    vec.local.push_back(myid * 1000 + l);
+  }
+  EXPECT_EQ_U(nlocal, vec.local.size());
+  EXPECT_EQ_U(0, vec.size());
+  vec.commit();
+
+  long nunits = dash::size();
+  long size   = 37 * nunits * (nunits + 1) / 2;
+  EXPECT_EQ_U(size, vec.size());
+  EXPECT_EQ_U(nlocal, vec.lsize());
+  EXPECT_EQ_U(37 * myid * (myid + 1) / 2, vec.pattern().lbegin());
+  EXPECT_EQ_U(nlocal, vec.lend() - vec.lbegin());
+
+  // Elements of all units in global index space:
+  long g = 0;
+  for (long u = 0; u < nunits; ++u) {
+    for (long l = 0; l < 37 * (u + 1); ++l, ++g) {
+      long value = vec[g];
+      EXPECT_EQ_U(u * 1000 + l, value);
+    }
+  }
+  vec.barrier();
+}
+
+TEST_F(VectorTest, AppendAfterCommit)
+{
+  typedef dash::Vector<int> vector_t;
+  vector_t vec(4);
+  int myid   = dash::myid();
+  int nunits = dash::size();
+
+  // First unit has no local elements in the first commit:
+  if (myid > 0) {
+    vec.local.push_back(myid);
+  }
+  vec.commit();
+  EXPECT_EQ_U(nunits - 1, vec.size());
+
+  // Elements appended by all units after reallocation of local memory:
+  for (int l = 0; l < 100; ++l) {
+    vec.local.push_back(myid);
+  }
+  vec.commit();
+  EXPECT_EQ_U(100 * nunits + nunits - 1, vec.size());
+  EXPECT_EQ_U(nunits * (nunits - 1) / 2 * 101,
+              dash::accumulate(vec.begin(), vec.end(), 0));
+
+  // Global writes to the local elements of the next unit:
+  auto next   = (myid + 1) % nunits;
+  auto gfirst = (next == 0) ? 0 : 100 * next + next - 1;
+  vec[gfirst] = -1;
+  vec.barrier();
+  EXPECT_EQ_U(-1, vec.local[0]);
+  vec.barrier();
+}
+
+TEST_F(VectorTest, Resize)
+{
+  typedef dash::Vector<double> vector_t;
+  vector_t vec;
+  vec.local.resize(dash::myid() % 2 == 0 ? 0 : 200);
+  vec.commit();
+  EXPECT_EQ_U((dash::size() / 2) * 200, vec.size());
+  for (auto & value : vec.local) {
+    EXPECT_EQ_U(0.0, value);
+  }
+
+  vec.local.clear();
+  vec.commit();
+  EXPECT_EQ_U(0, vec.size());
+  EXPECT_TRUE_U(vec.begin() == vec.end());
+}
@@ -0,0 +1,26 @@
+#ifndef DASH__TEST__VECTOR_TEST_H_
+#define DASH__TEST__VECTOR_TEST_H_
+
+#include <gtest/gtest.h>
+#include <libdash.h>
+
+/**
+ * Test fixture for class dash::Vector
+ */
+class VectorTest : public ::testing::Test {
+protected:
+
+  VectorTest() {
+  }
+
+  virtual ~VectorTest() {
+  }
+
+  virtual void SetUp() {
+  }
+
+  virtual void TearDown() {
+  }
+};
+
+#endif // DASH__TEST__VECTOR_TEST_H_
@@ -0,0 +1,61 @@
+#include <libdash.h>
+#include <gtest/gtest.h>
+#include "TestBase.h"
+#include "WriteCombiningIterTest.h"
+
+#include <vector>
+#include <algorithm>
+
+TEST_F(WriteCombiningIterTest, CopyToBlockcyclicArray)
+{
+  typedef int value_t;
+
+  size_t blocksize      = 7;
+  size_t num_local_elem = 23;
+  size_t num_elem       = dash::size() * num_local_elem;
+  size_t offset         = 3;
+  dash::Array<value_t> array(num_elem, dash::BLOCKCYCLIC(blocksize));
+
+  dash::fill(array.begin(), array.end(), -1);
+  array.barrier();
+
+  if (dash::myid() == 0) {
+    std::vector<value_t> values(num_elem - offset);
+    for (size_t i = 0; i < values.size(); ++i) {
+      values[i] = offset + i;
+    }
+    // Buffer smaller than blocks to test flush on full buffer:
+    auto out = std::copy(values.begin(), values.end(),
+                         dash::write_combining(array.begin() + offset, 5));
+    ASSERT_EQ_U(num_elem, out.pos().pos());
+    out.flush();
+  }
+  array.barrier();
+
+  for (size_t g = 0; g < num_elem; ++g) {
+    value_t expected = (g < offset) ? -1 : static_cast<value_t>(g);
+    ASSERT_EQ_U(expected, static_cast<value_t>(array[g]));
+  }
+  array.barrier();
+}
+
+TEST_F(WriteCombiningIterTest, GenerateOnDestruction)
+{
+  typedef int value_t;
+
+  size_t num_elem = dash::size() * 11;
+  dash::Array<value_t> array(num_elem);
+
+  if (dash::myid() == static_cast<dart_unit_t>(dash::size() - 1)) {
+    value_t next = 0;
+    // Values are written when the iterator is destroyed:
+    std::generate_n(dash::write_combining(array.begin()), num_elem,
+                    [&]() { return next++; });
+  }
+  array.barrier();
+
+  for (size_t g = 0; g < num_elem; ++g) {
+    ASSERT_EQ_U(g, static_cast<value_t>(array[g]));
+  }
+  array.barrier();
+}
@@ -0,0 +1,26 @@
+#ifndef DASH__TEST__WRITE_COMBINING_ITER_TEST_H_
+#define DASH__TEST__WRITE_COMBINING_ITER_TEST_H_
+
+#include <gtest/gtest.h>
+#include <libdash.h>
+
+/**
+ * Test fixture for class dash::WriteCombiningIter
+ */
+class WriteCombiningIterTest : public ::testing::Test {
+protected:
+
+  WriteCombiningIterTest() {
+  }
+
+  virtual ~WriteCombiningIterTest() {
+  }
+
+  virtual void SetUp() {
+  }
+
+  virtual void TearDown() {
+  }
+};
+
+#endif // DASH__TEST__WRITE_COMBINING_ITER_TEST_H_